@@ -0,0 +1,23 @@
+#ifndef TEST_CHECK_H
+#define TEST_CHECK_H
+
+/**
+ * @file TestCheck.h
+ * @brief Vérification des tests unitaires, active aussi avec NDEBUG
+ *
+ * Contrairement à assert, l'expression est toujours évaluée : les tests
+ * restent valides (et sans variable inutilisée) dans une compilation Release.
+ */
+
+#include <cstdlib>
+#include <iostream>
+
+#define CHECK(expr)                                                                      \
+    do {                                                                                 \
+        if (!(expr)) {                                                                   \
+            std::cerr << __FILE__ << ":" << __LINE__ << ": echec de " #expr << std::endl; \
+            std::abort();                                                                \
+        }                                                                                \
+    } while (0)
+
+#endif // TEST_CHECK_H
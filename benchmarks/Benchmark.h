@@ -0,0 +1,295 @@
+#ifndef BENCHMARK_H
+#define BENCHMARK_H
+
+/**
+ * @file Benchmark.h
+ * @brief Outils communs aux bancs d'essai (bench_*) : options, réseaux synthétiques, percentiles, JSON
+ *
+ * Chaque banc mesure une opération sur des réseaux synthétiques de taille
+ * croissante (CityGenerator : grille déformée par défaut, artères toutes
+ * les 10 rues), avec une graine fixe : deux exécutions mesurent exactement le même travail. Les
+ * résultats sont écrits en JSON (un objet par taille, percentiles des
+ * durées) pour être comparés d'une version à l'autre.
+ *
+ * Options communes :
+ *   --sizes 100,10000,1000000   nombres de nœuds (approchés par la forme complète la plus proche)
+ *   --layout grid|radial|planar forme des réseaux
+ *   --samples N                 mesures par taille
+ *   --budget S                  temps maximal par taille (s) : arrêt anticipé, au moins MIN_SAMPLES mesures
+ *   --seed S                    graine des réseaux et des tirages
+ *   --output fichier            "-" pour la sortie standard (par défaut : <banc>.json)
+ */
+
+#include "../include/CityGenerator.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace bench {
+
+constexpr size_t MIN_SAMPLES = 5;
+
+struct Options {
+    std::vector<int> sizes;
+    CityLayout layout = CityLayout::GRID;
+    int samples;
+    double budget;                  // s par taille
+    unsigned int seed;
+    std::string output;
+};
+
+/**
+ * @brief Lit les options communes ; les valeurs par défaut sont celles du banc
+ * @return Faux (après un message d'usage) si une option est inconnue ou invalide
+ */
+inline bool parseOptions(int argc, char** argv, Options& options) {
+    for (int i = 1; i < argc; i++) {
+        std::string option = argv[i];
+        if (i + 1 >= argc) {
+            std::cerr << "Option sans valeur: " << option << std::endl;
+            return false;
+        }
+        std::string value = argv[++i];
+        if (option == "--sizes") {
+            options.sizes.clear();
+            std::stringstream list(value);
+            std::string item;
+            while (std::getline(list, item, ',')) {
+                int size = std::atoi(item.c_str());
+                if (size < 4) {
+                    std::cerr << "Taille invalide: " << item << std::endl;
+                    return false;
+                }
+                options.sizes.push_back(size);
+            }
+        } else if (option == "--layout") {
+            if (!CityGenerator::parseLayout(value, options.layout)) {
+                std::cerr << "Forme inconnue: " << value << std::endl;
+                return false;
+            }
+        } else if (option == "--samples") {
+            options.samples = std::max(1, std::atoi(value.c_str()));
+        } else if (option == "--budget") {
+            options.budget = std::atof(value.c_str());
+        } else if (option == "--seed") {
+            options.seed = static_cast<unsigned int>(std::strtoul(value.c_str(), nullptr, 10));
+        } else if (option == "--output") {
+            options.output = value;
+        } else {
+            std::cerr << "Option inconnue: " << option << std::endl
+                      << "Usage: " << argv[0] << " [--sizes n1,n2,...] [--layout grid|radial|planar] [--samples N] [--budget s] [--seed S] [--output fichier|-]"
+                      << std::endl;
+            return false;
+        }
+    }
+    return !options.sizes.empty();
+}
+
+/**
+ * @brief Réseau d'environ nodeCount nœuds de la forme choisie
+ *
+ * Écart de 100 m entre nœuds (± 25 m), rues à 50 km/h, artères à
+ * 90 km/h toutes les 10 rues.
+ */
+inline std::shared_ptr<RoadNetwork> buildSyntheticNetwork(int nodeCount, const Options& options) {
+    CityOptions city;
+    city.layout = options.layout;
+    city.nodeCount = nodeCount;
+    city.spacing = 100.0f;
+    city.jitter = 0.25f;
+    city.arterialInterval = 10;
+    city.local = {50.0f, 30};
+    city.arterial = {90.0f, 60};
+    city.seed = options.seed;
+    return CityGenerator::generate(city);
+}
+
+/**
+ * @struct Distribution
+ * @brief Résumé d'une série de mesures (percentiles au rang le plus proche)
+ */
+struct Distribution {
+    size_t count = 0;
+    double mean = 0.0;
+    double min = 0.0;
+    double p50 = 0.0;
+    double p90 = 0.0;
+    double p99 = 0.0;
+    double max = 0.0;
+};
+
+inline Distribution summarize(std::vector<double> values) {
+    Distribution result;
+    if (values.empty()) {
+        return result;
+    }
+    std::sort(values.begin(), values.end());
+    auto rank = [&values](double q) {
+        size_t index = static_cast<size_t>(std::ceil(q * values.size()));
+        return values[std::min(values.size(), std::max<size_t>(1, index)) - 1];
+    };
+    double sum = 0.0;
+    for (double value : values) {
+        sum += value;
+    }
+    result.count = values.size();
+    result.mean = sum / values.size();
+    result.min = values.front();
+    result.p50 = rank(0.50);
+    result.p90 = rank(0.90);
+    result.p99 = rank(0.99);
+    result.max = values.back();
+    return result;
+}
+
+inline double elapsedMicroseconds(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+}
+
+// Vrai tant qu'il faut mesurer : moins de samples mesures et budget non épuisé (au moins MIN_SAMPLES)
+inline bool keepSampling(size_t done, const Options& options, std::chrono::steady_clock::time_point start) {
+    if (done >= static_cast<size_t>(options.samples)) {
+        return false;
+    }
+    double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    return done < MIN_SAMPLES || elapsed < options.budget;
+}
+
+/**
+ * @class JsonWriter
+ * @brief Écriture d'un document JSON indenté, sans dépendance
+ *
+ * Les virgules sont placées automatiquement ; les clés et chaînes
+ * attendues sont de simples identifiants (pas d'échappement).
+ */
+class JsonWriter {
+public:
+    explicit JsonWriter(std::ostream& out) : out(out), depth(0), first(true) {}
+
+    void beginObject(const char* key = nullptr) { open(key, '{'); }
+    void endObject() { close('}'); }
+    void beginArray(const char* key = nullptr) { open(key, '['); }
+    void endArray() { close(']'); }
+
+    void value(const char* key, const std::string& text) { prefix(key); out << '"' << text << '"'; }
+    void value(const char* key, const char* text) { value(key, std::string(text)); }
+    void value(const char* key, double number) { prefix(key); out << (std::isfinite(number) ? number : 0.0); }
+    void value(const char* key, uint64_t number) { prefix(key); out << number; }
+    void value(const char* key, int number) { prefix(key); out << number; }
+
+    // Résumé de mesures en microsecondes
+    void distribution(const char* key, const Distribution& d) {
+        beginObject(key);
+        value("count", static_cast<uint64_t>(d.count));
+        value("mean_us", d.mean);
+        value("min_us", d.min);
+        value("p50_us", d.p50);
+        value("p90_us", d.p90);
+        value("p99_us", d.p99);
+        value("max_us", d.max);
+        endObject();
+    }
+
+    void finish() { out << '\n'; }
+
+private:
+    std::ostream& out;
+    int depth;
+    bool first;
+
+    void prefix(const char* key) {
+        if (!first) {
+            out << ',';
+        }
+        if (depth > 0) {
+            out << '\n' << std::string(depth * 2, ' ');
+        }
+        if (key) {
+            out << '"' << key << "\": ";
+        }
+        first = false;
+    }
+
+    void open(const char* key, char bracket) {
+        prefix(key);
+        out << bracket;
+        depth++;
+        first = true;
+    }
+
+    void close(char bracket) {
+        depth--;
+        if (!first) {
+            out << '\n' << std::string(depth * 2, ' ');
+        }
+        out << bracket;
+        first = false;
+    }
+};
+
+/**
+ * @class QuietStdout
+ * @brief Fait taire std::cout (messages de la simulation) le temps d'une portée
+ */
+class QuietStdout {
+public:
+    QuietStdout() : saved(std::cout.rdbuf(nullptr)) {}
+    ~QuietStdout() { std::cout.rdbuf(saved); }
+
+    QuietStdout(const QuietStdout&) = delete;
+    QuietStdout& operator=(const QuietStdout&) = delete;
+
+private:
+    std::streambuf* saved;
+};
+
+/**
+ * @brief Document JSON d'un banc : en-tête commun puis results (un objet par taille, écrit par fill)
+ * @return Code de sortie du programme
+ *
+ * Le document est assemblé en mémoire et écrit à la fin : la sortie
+ * standard ne contient que le JSON, la progression va sur std::cerr.
+ */
+template<typename Fill>
+int writeReport(const std::string& benchmark, const Options& options, Fill fill) {
+    std::ostringstream document;
+    JsonWriter json(document);
+    json.beginObject();
+    json.value("benchmark", benchmark);
+    json.value("seed", static_cast<uint64_t>(options.seed));
+    json.value("layout", CityGenerator::getLayoutName(options.layout));
+#ifdef NDEBUG
+    json.value("build", "release");
+#else
+    json.value("build", "debug");
+#endif
+    json.beginArray("results");
+    fill(json);
+    json.endArray();
+    json.endObject();
+    json.finish();
+
+    if (options.output == "-") {
+        std::cout << document.str();
+        return std::cout ? 0 : 1;
+    }
+    std::ofstream file(options.output);
+    file << document.str();
+    if (!file) {
+        std::cerr << "Impossible d'ecrire " << options.output << std::endl;
+        return 1;
+    }
+    std::cerr << "Resultats: " << options.output << std::endl;
+    return 0;
+}
+
+} // namespace bench
+
+#endif // BENCHMARK_H
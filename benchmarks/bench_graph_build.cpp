@@ -0,0 +1,57 @@
+#include "Benchmark.h"
+#include "../include/Graph.h"
+#include <memory>
+#include <vector>
+
+// Construction d'un réseau : topologie (nœuds, routes, index), graphe sur une topologie
+// partagée (état dynamique des routes) et copie profonde de la topologie
+int main(int argc, char** argv) {
+    bench::Options options;
+    options.sizes = {50, 1000, 10000, 100000, 1000000};
+    options.samples = 20;
+    options.budget = 20.0;
+    options.seed = 42;
+    options.output = "bench_graph_build.json";
+    if (!bench::parseOptions(argc, argv, options)) {
+        return 2;
+    }
+
+    return bench::writeReport("graph_build", options, [&options](bench::JsonWriter& json) {
+        for (int size : options.sizes) {
+            std::cerr << "bench_graph_build: " << size << " noeuds" << std::endl;
+            std::vector<double> topologyTimes;
+            std::vector<double> graphTimes;
+            std::vector<double> copyTimes;
+            size_t nodeCount = 0;
+            size_t routeCount = 0;
+            auto start = std::chrono::steady_clock::now();
+            while (bench::keepSampling(topologyTimes.size(), options, start)) {
+                auto stepStart = std::chrono::steady_clock::now();
+                std::shared_ptr<const RoadNetwork> topology = bench::buildSyntheticNetwork(size, options);
+                topologyTimes.push_back(bench::elapsedMicroseconds(stepStart));
+
+                stepStart = std::chrono::steady_clock::now();
+                {
+                    Graph graph(topology);
+                    graphTimes.push_back(bench::elapsedMicroseconds(stepStart));
+                }
+
+                stepStart = std::chrono::steady_clock::now();
+                {
+                    RoadNetwork copy(*topology);
+                    copyTimes.push_back(bench::elapsedMicroseconds(stepStart));
+                }
+                nodeCount = topology->getNodes().size();
+                routeCount = topology->getRouteCount();
+            }
+
+            json.beginObject();
+            json.value("nodes", static_cast<uint64_t>(nodeCount));
+            json.value("routes", static_cast<uint64_t>(routeCount));
+            json.distribution("topology", bench::summarize(topologyTimes));
+            json.distribution("graph", bench::summarize(graphTimes));
+            json.distribution("copy", bench::summarize(copyTimes));
+            json.endObject();
+        }
+    });
+}
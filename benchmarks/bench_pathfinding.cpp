@@ -0,0 +1,69 @@
+#include "Benchmark.h"
+#include "../include/Graph.h"
+#include "../include/PathfindingStrategy.h"
+#include <memory>
+#include <random>
+#include <utility>
+#include <vector>
+
+// Recherches de chemin entre paires origine-destination tirées au hasard, A* puis Dijkstra
+// sur les mêmes paires ; durée de chaque recherche et compteurs moyens (SearchStats)
+int main(int argc, char** argv) {
+    bench::Options options;
+    options.sizes = {50, 1000, 10000, 100000, 1000000};
+    options.samples = 200;
+    options.budget = 10.0;
+    options.seed = 42;
+    options.output = "bench_pathfinding.json";
+    if (!bench::parseOptions(argc, argv, options)) {
+        return 2;
+    }
+
+    return bench::writeReport("pathfinding", options, [&options](bench::JsonWriter& json) {
+        for (int size : options.sizes) {
+            std::cerr << "bench_pathfinding: " << size << " noeuds" << std::endl;
+            Graph graph(bench::buildSyntheticNetwork(size, options));
+            int nodeCount = static_cast<int>(graph.getNodes().size());
+
+            std::mt19937 rng(options.seed + static_cast<unsigned int>(size));
+            std::uniform_int_distribution<int> node(0, nodeCount - 1);
+            std::vector<std::pair<int, int>> pairs(options.samples);
+            for (auto& pair : pairs) {
+                pair.first = node(rng);
+                do {
+                    pair.second = node(rng);
+                } while (pair.second == pair.first);
+            }
+
+            std::unique_ptr<PathfindingStrategy> strategies[] = {
+                std::make_unique<AStarStrategy>(), std::make_unique<DijkstraStrategy>()};
+            const char* names[] = {"astar", "dijkstra"};
+            for (int s = 0; s < 2; s++) {
+                std::vector<double> times;
+                SearchStats stats;
+                size_t found = 0;
+                auto start = std::chrono::steady_clock::now();
+                while (bench::keepSampling(times.size(), options, start)) {
+                    const auto& pair = pairs[times.size()];
+                    auto searchStart = std::chrono::steady_clock::now();
+                    std::vector<int> path = strategies[s]->findPath(graph, pair.first, pair.second, &stats);
+                    times.push_back(bench::elapsedMicroseconds(searchStart));
+                    found += path.empty() ? 0 : 1;
+                }
+
+                double perSearch = stats.searches > 0 ? 1.0 / stats.searches : 0.0;
+                json.beginObject();
+                json.value("nodes", nodeCount);
+                json.value("routes", static_cast<uint64_t>(graph.getRoutes().size()));
+                json.value("strategy", names[s]);
+                json.value("found", static_cast<uint64_t>(found));
+                json.distribution("search", bench::summarize(times));
+                json.value("nodes_settled", stats.nodesSettled * perSearch);
+                json.value("edges_relaxed", stats.edgesRelaxed * perSearch);
+                json.value("heap_pushes", stats.heapPushes * perSearch);
+                json.value("heap_pops", stats.heapPops * perSearch);
+                json.endObject();
+            }
+        }
+    });
+}
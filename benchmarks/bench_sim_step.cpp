@@ -0,0 +1,64 @@
+#include "Benchmark.h"
+#include "../include/Simulation.h"
+#include <vector>
+
+// Durée d'un tick (Simulation::update, pas de 0,1 s) par modèle de trafic, un véhicule pour deux nœuds
+int main(int argc, char** argv) {
+    bench::Options options;
+    options.sizes = {100, 1000, 10000, 100000};
+    options.samples = 300;
+    options.budget = 10.0;
+    options.seed = 42;
+    options.output = "bench_sim_step.json";
+    if (!bench::parseOptions(argc, argv, options)) {
+        return 2;
+    }
+
+    const int WARMUP_STEPS = 20;
+    const TrafficModel models[] = {TrafficModel::CONTINUOUS, TrafficModel::MESOSCOPIC, TrafficModel::MICROSCOPIC};
+    const char* names[] = {"continuous", "mesoscopic", "microscopic"};
+
+    return bench::writeReport("sim_step", options, [&](bench::JsonWriter& json) {
+        for (int size : options.sizes) {
+            std::cerr << "bench_sim_step: " << size << " noeuds" << std::endl;
+            std::shared_ptr<const RoadNetwork> topology = bench::buildSyntheticNetwork(size, options);
+            for (int m = 0; m < 3; m++) {
+                std::vector<double> times;
+                size_t vehicles = 0;
+                unsigned int threads = 0;
+                {
+                    // La simulation écrit sa progression sur la sortie standard
+                    bench::QuietStdout quiet;
+                    Simulation simulation;
+                    simulation.setSeed(options.seed);
+                    simulation.initialize(topology);
+                    simulation.setTrafficModel(models[m]);
+                    simulation.setVehicleCount(std::max(10, size / 2));
+                    for (int step = 0; step < WARMUP_STEPS; step++) {
+                        simulation.update(0.1f);
+                    }
+
+                    auto start = std::chrono::steady_clock::now();
+                    while (bench::keepSampling(times.size(), options, start)) {
+                        auto stepStart = std::chrono::steady_clock::now();
+                        simulation.update(0.1f);
+                        times.push_back(bench::elapsedMicroseconds(stepStart));
+                    }
+                    vehicles = simulation.getVehicles().size();
+                    threads = simulation.getThreadCount();
+                }
+
+                bench::Distribution step = bench::summarize(times);
+                json.beginObject();
+                json.value("nodes", static_cast<uint64_t>(topology->getNodes().size()));
+                json.value("routes", static_cast<uint64_t>(topology->getRouteCount()));
+                json.value("model", names[m]);
+                json.value("vehicles", static_cast<uint64_t>(vehicles));
+                json.value("threads", static_cast<uint64_t>(threads));
+                json.distribution("step", step);
+                json.value("ticks_per_second", step.mean > 0.0 ? 1e6 / step.mean : 0.0);
+                json.endObject();
+            }
+        }
+    });
+}
@@ -0,0 +1,41 @@
+#include "../include/BatchRunner.h"
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+// Campagne sans rendu : compare les modes Normal et Dynamique sur plusieurs graines
+// Usage : RoutageBatch [resultats.csv] [duree simulee (s)] [nombre de graines]
+int main(int argc, char** argv) {
+    std::string resultsPath = argc > 1 ? argv[1] : "resultats.csv";
+    float duration = argc > 2 ? static_cast<float>(std::atof(argv[2])) : 300.0f;
+    int seedCount = argc > 3 ? std::atoi(argv[3]) : 5;
+    
+    ScenarioGrid grid;
+    grid.vehicleCounts = {50, 150};
+    grid.eventIntervals = {10.0f, 30.0f};
+    grid.modes = {SimulationMode::NORMAL, SimulationMode::DYNAMIC};
+    grid.strategies = {PathfindingAlgorithm::ASTAR, PathfindingAlgorithm::DIJKSTRA};
+    for (int seed = 1; seed <= seedCount; seed++) {
+        grid.seeds.push_back(static_cast<unsigned int>(seed));
+    }
+    std::vector<ScenarioParameters> scenarios = BatchRunner::expandGrid(grid);
+    
+    BatchRunner runner;
+    runner.setDuration(duration);
+    std::cout << "Campagne: " << scenarios.size() << " simulations de " << duration << " s" << std::endl;
+    auto start = std::chrono::steady_clock::now();
+    runner.run(scenarios);
+    double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    std::cout << "Termine en " << elapsed << " s" << std::endl;
+    
+    // Résultats agrégés et détail par simulation
+    std::string runsPath = resultsPath;
+    size_t extension = runsPath.rfind(".csv");
+    runsPath = (extension != std::string::npos ? runsPath.substr(0, extension) : runsPath) + "_runs.csv";
+    if (!runner.writeResults(resultsPath) || !runner.writeRuns(runsPath)) {
+        return 1;
+    }
+    std::cout << "Resultats: " << resultsPath << " (detail: " << runsPath << ")" << std::endl;
+    return 0;
+}
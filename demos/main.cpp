@@ -1,11 +1,52 @@
 #include "../include/Simulation.h"
 #include "../include/Renderer.h"
+#include "../include/SimulationRunner.h"
+#include "../include/TraceRecorder.h"
+#include "../include/TraceReplayer.h"
+#include "../include/MetricsExporter.h"
+#include "../include/Tracing.h"
+#include "../include/CityGenerator.h"
 #include "../include/Event.h"
 #include <raylib.h>
 #include <iostream>
 #include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <string>
 
-int main() {
+int main(int argc, char** argv) {
+    // --record <fichier> : enregistre l'exécution ; --replay <fichier> : relit une trace sans simuler
+    // --metrics <fichier> : séries temporelles des routes (CSV si l'extension est .csv, binaire compressé sinon)
+    // --trace <fichier> : zones de traçage au format Chrome trace (compilé avec ROUTAGE_TRACING)
+    // --city grid|radial|planar, --nodes <n> : ville générée au lieu du réseau de démonstration 6x6
+    // --config <fichier> : réseau et paramètres lus dans une configuration JSON (config/config.json)
+    std::string recordPath;
+    std::string replayPath;
+    std::string metricsPath;
+    std::string tracePath = "trace.json";
+    std::string configPath;
+    CityOptions city;
+    bool generateCity = false;
+    for (int i = 1; i + 1 < argc; i++) {
+        std::string option = argv[i];
+        if (option == "--record") {
+            recordPath = argv[++i];
+        } else if (option == "--replay") {
+            replayPath = argv[++i];
+        } else if (option == "--metrics") {
+            metricsPath = argv[++i];
+        } else if (option == "--trace") {
+            tracePath = argv[++i];
+        } else if (option == "--config") {
+            configPath = argv[++i];
+        } else if (option == "--city") {
+            generateCity = CityGenerator::parseLayout(argv[++i], city.layout);
+        } else if (option == "--nodes") {
+            city.nodeCount = std::max(4, std::atoi(argv[++i]));
+            generateCity = true;
+        }
+    }
+    
     // Forcer l'affichage immédiat
     std::cout << "=== DEBUT DU PROGRAMME ===" << std::endl;
     std::cout << "Initialisation de la simulation..." << std::endl;
@@ -17,12 +58,24 @@ int main() {
         Simulation simulation;
         std::cout << "Creation du graphe..." << std::endl;
         std::cout.flush();
-        simulation.initialize(""); // Utilise le graphe de test
-        
-        // Configuration
-        simulation.setVehicleCount(50); // Plus de véhicules pour ville dynamique
-        simulation.setEventCount(2);
-        simulation.setMode(SimulationMode::DYNAMIC);
+        if (!configPath.empty()) {
+            // Nombre de véhicules, événements et mode viennent de la configuration
+            simulation.initialize(configPath);
+        } else {
+            if (generateCity) {
+                city.jitter = city.layout == CityLayout::RADIAL ? 0.0f : 0.15f;
+                city.arterialInterval = 4;
+                simulation.initialize(CityGenerator::generate(city));
+            } else {
+                simulation.initialize(""); // Utilise le graphe de test
+            }
+            
+            // Configuration
+            simulation.setVehicleCount(50); // Plus de véhicules pour ville dynamique
+            simulation.setEventCount(2);
+            simulation.setMode(SimulationMode::DYNAMIC);
+        }
+        simulation.setFixedTimeStep(0.1f); // Ticks à 10 Hz, le rendu interpole entre deux ticks
         std::cout << "Simulation configuree." << std::endl;
         
         // Vérifier qu'il y a des véhicules après création
@@ -58,6 +111,7 @@ int main() {
         std::cout << "Controles:" << std::endl;
         std::cout << "  SPACE - Declencher un evenement aleatoire" << std::endl;
         std::cout << "  R - Basculer entre mode Normal et Dynamique" << std::endl;
+        std::cout << "  P - Apercu de l'impact d'une fermeture de route (15 min simulees)" << std::endl;
         std::cout << "  +/- - Augmenter/Reduire le nombre de vehicules" << std::endl;
         std::cout << "  Fleches/WASD - Deplacer la camera" << std::endl;
         std::cout << "  Molette - Zoom" << std::endl;
@@ -83,16 +137,62 @@ int main() {
             std::cin.get();
         }
         
+        // Relecture : les instantanés viennent de la trace, la simulation ne tourne pas
+        TraceReplayer replayer(*graph);
+        FrameSnapshot replayFrame;
+        float replayTime = 0.0f;
+        bool replaying = !replayPath.empty() && replayer.open(replayPath);
+        if (!replayPath.empty()) {
+            std::cout << (replaying ? "Relecture de la trace: " : "ERREUR: trace illisible: ") << replayPath << std::endl;
+            replayTime = replayer.getStartTime();
+        }
+        
+        TraceRecorder recorder;
+        if (!replaying && !recordPath.empty()) {
+            std::cout << (recorder.start(recordPath, simulation) ? "Enregistrement de la trace: " :
+                          "ERREUR: enregistrement impossible: ") << recordPath << std::endl;
+        }
+        
+        MetricsExporter metrics;
+        if (!replaying && !metricsPath.empty()) {
+            bool csv = metricsPath.size() >= 4 && metricsPath.compare(metricsPath.size() - 4, 4, ".csv") == 0;
+            bool started = metrics.start(metricsPath, simulation, csv ? MetricsFormat::CSV : MetricsFormat::COLUMNAR_COMPRESSED);
+            std::cout << (started ? "Export des metriques: " : "ERREUR: export des metriques impossible: ")
+                      << metricsPath << std::endl;
+        }
+        
+        // La simulation tourne sur son propre thread ; le rendu dessine ses instantanés
+        SimulationRunner runner(simulation);
+        if (!replaying) {
+            runner.start();
+        }
+        int notifiedEvents = 0;
+        int notifiedPreviews = 0;
+        TRACE_THREAD_NAME("rendu");
+        
         while (!WindowShouldClose()) {
             frameCount++;
             
+            // Dernier état publié par le thread de simulation (ou état de la trace, relue en boucle)
+            if (replaying) {
+                replayTime += GetFrameTime();
+                if (replayTime > replayer.getEndTime()) {
+                    replayTime = replayer.getStartTime();
+                }
+                replayer.frameAt(replayTime, replayFrame);
+            }
+            const FrameSnapshot& frame = replaying ? replayFrame : runner.acquireSnapshot();
+            if (runner.hasFailed()) {
+                break;
+            }
+            
             // Diagnostic toutes les 60 frames
             if (frameCount % 60 == 0) {
                 std::cout << "Frame " << frameCount << " - Fenetre active" << std::endl;
                 std::cout << "  WindowShouldClose: " << (WindowShouldClose() ? "true" : "false") << std::endl;
                 std::cout << "  IsWindowReady: " << (IsWindowReady() ? "true" : "false") << std::endl;
-                std::cout << "  Nombre de vehicules: " << simulation.getVehicles().size() << std::endl;
-                std::cout << "  Nombre d'evenements: " << simulation.getEvents().size() << std::endl;
+                std::cout << "  Nombre de vehicules: " << frame.vehicleCount << std::endl;
+                std::cout << "  Nombre d'evenements: " << frame.events.size() << std::endl;
                 std::cout.flush();
             }
             
@@ -129,16 +229,19 @@ int main() {
             
             // Gestion des entrées
             if (IsKeyPressed(KEY_SPACE)) {
-                simulation.triggerRandomEvent();
+                runner.post(SimulationCommand::make(CommandType::TRIGGER_EVENT));
                 std::cout << "Evenement declenche!" << std::endl;
-                
-                // Notification visuelle
-                const auto& events = simulation.getEvents();
+            }
+            
+            // Notification visuelle dès que l'instantané contient l'événement déclenché
+            if (frame.triggeredEvents != notifiedEvents) {
+                notifiedEvents = frame.triggeredEvents;
+                const auto& events = frame.events;
                 if (!events.empty()) {
                     const auto& lastEvent = events.back();
                     std::string eventName;
                     Color eventColor;
-                    switch (lastEvent->getType()) {
+                    switch (lastEvent.type) {
                         case EventType::ACCIDENT:
                             eventName = "ACCIDENT detecte!";
                             eventColor = RED;
@@ -160,48 +263,93 @@ int main() {
                 }
             }
             
+            // Aperçu calculé sur des copies de la simulation : la fermeture n'est pas appliquée
+            if (IsKeyPressed(KEY_P) && !replaying && !graph->getRoutes().empty()) {
+                int index = GetRandomValue(0, static_cast<int>(graph->getRoutes().size()) - 1);
+                int routeId = graph->getRoutes()[index]->getId();
+                runner.post(SimulationCommand::make(CommandType::PREVIEW_CLOSURE, routeId, 300.0f));
+                std::cout << "Apercu de la fermeture de la route " << routeId << "..." << std::endl;
+            }
+            if (frame.completedPreviews != notifiedPreviews) {
+                notifiedPreviews = frame.completedPreviews;
+                std::string message = "Fermeture route " + std::to_string(frame.previewRouteId) + " : " +
+                                      (frame.previewDelay >= 0.0f ? "+" : "") +
+                                      std::to_string(static_cast<int>(std::round(frame.previewDelay))) + " s/trajet, " +
+                                      std::to_string(frame.previewLostTrips) + " trajets en moins";
+                std::cout << message << std::endl;
+                renderer.addNotification(message, frame.previewDelay > 0.0f ? ORANGE : GREEN, 6.0f);
+            }
+            
             if (IsKeyPressed(KEY_R)) {
-                SimulationMode currentMode = simulation.getMode();
+                SimulationMode currentMode = frame.mode;
                 SimulationMode newMode = (currentMode == SimulationMode::DYNAMIC) ? 
                                         SimulationMode::NORMAL : SimulationMode::DYNAMIC;
-                simulation.setMode(newMode);
+                runner.post(SimulationCommand::make(CommandType::SET_MODE, static_cast<int>(newMode)));
                 std::cout << "Mode change: " << 
                     (newMode == SimulationMode::DYNAMIC ? "Dynamique" : "Normal") << std::endl;
             }
             
+            if (IsKeyPressed(KEY_F5)) {
+                runner.post(SimulationCommand::make(CommandType::SAVE_CHECKPOINT));
+                std::cout << "Point de reprise sauvegarde" << std::endl;
+            }
+            
+            if (IsKeyPressed(KEY_F9)) {
+                runner.post(SimulationCommand::make(CommandType::LOAD_CHECKPOINT));
+                std::cout << "Point de reprise restaure" << std::endl;
+            }
+            
+            if (IsKeyPressed(KEY_F3)) {
+                renderer.toggleProfiler();
+            }
+            
+            if (IsKeyPressed(KEY_F8) && Tracer::isCompiledIn()) {
+                // Zones enregistrées jusqu'ici ; l'enregistrement continue
+                bool written = Tracer::writeChromeTrace(tracePath);
+                std::cout << (written ? "Trace ecrite: " : "ERREUR: trace impossible a ecrire: ") << tracePath << std::endl;
+                renderer.addNotification(written ? "Trace ecrite" : "Trace impossible a ecrire", YELLOW, 2.0f);
+            }
+            
+            if (IsKeyPressed(KEY_T)) {
+                // Avance rapide : autant de pas fixes que le budget de chaque image le permet
+                runner.post(SimulationCommand::make(CommandType::TOGGLE_FAST_FORWARD));
+                std::cout << "Avance rapide: " << (frame.fastForward ? "OFF" : "ON") << std::endl;
+                renderer.addNotification(frame.fastForward ? "Vitesse normale" : "AVANCE RAPIDE", YELLOW, 2.0f);
+            }
+            
+            if (IsKeyPressed(KEY_M)) {
+                // Continu -> Mésoscopique -> Microscopique -> Hybride -> Continu
+                TrafficModel currentModel = frame.trafficModel;
+                TrafficModel newModel = (currentModel == TrafficModel::CONTINUOUS) ? TrafficModel::MESOSCOPIC :
+                                        (currentModel == TrafficModel::MESOSCOPIC) ? TrafficModel::MICROSCOPIC :
+                                        (currentModel == TrafficModel::MICROSCOPIC) ? TrafficModel::HYBRID :
+                                        TrafficModel::CONTINUOUS;
+                runner.post(SimulationCommand::make(CommandType::SET_TRAFFIC_MODEL, static_cast<int>(newModel)));
+                std::cout << "Modele de trafic: " <<
+                    (newModel == TrafficModel::MESOSCOPIC ? "Mesoscopique" :
+                     newModel == TrafficModel::MICROSCOPIC ? "Microscopique" :
+                     newModel == TrafficModel::HYBRID ? "Hybride" : "Continu") << std::endl;
+            }
+            
             if (IsKeyPressed(KEY_EQUAL) || IsKeyPressed(KEY_KP_ADD)) {
-                int currentCount = simulation.getVehicles().size();
-                simulation.setVehicleCount(currentCount + 5);
+                int currentCount = static_cast<int>(frame.vehicleCount);
+                runner.post(SimulationCommand::make(CommandType::SET_VEHICLE_COUNT, currentCount + 5));
                 std::cout << "Nombre de vehicules: " << currentCount + 5 << std::endl;
             }
             
             if (IsKeyPressed(KEY_MINUS) || IsKeyPressed(KEY_KP_SUBTRACT)) {
-                int currentCount = simulation.getVehicles().size();
+                int currentCount = static_cast<int>(frame.vehicleCount);
                 if (currentCount > 5) {
-                    simulation.setVehicleCount(currentCount - 5);
+                    runner.post(SimulationCommand::make(CommandType::SET_VEHICLE_COUNT, currentCount - 5));
                     std::cout << "Nombre de vehicules: " << currentCount - 5 << std::endl;
                 }
             }
             
-            // Mise à jour de la simulation
-            try {
-                simulation.update(deltaTime);
-            } catch (const std::exception& e) {
-                std::cout << "ERREUR dans simulation.update (Frame " << frameCount << "): " << e.what() << std::endl;
-                std::cout.flush();
-                errorCount++;
-                if (errorCount >= MAX_ERRORS) {
-                    std::cout << "Trop d'erreurs dans simulation.update, arret." << std::endl;
-                    break;
-                }
-            } catch (...) {
-                std::cout << "ERREUR inconnue dans simulation.update (Frame " << frameCount << ")" << std::endl;
-                std::cout.flush();
-                errorCount++;
-                if (errorCount >= MAX_ERRORS) {
-                    std::cout << "Trop d'erreurs inconnues, arret." << std::endl;
-                    break;
-                }
+            // Modèle hybride : simulation fine de la partie visible de la carte
+            if (frame.trafficModel == TrafficModel::HYBRID) {
+                SimulationCommand focus = SimulationCommand::make(CommandType::SET_FOCUS_AREA);
+                renderer.getVisibleArea(focus.area[0], focus.area[1], focus.area[2], focus.area[3]);
+                runner.post(focus);
             }
             
             // Mise à jour de la caméra
@@ -215,7 +363,7 @@ int main() {
             renderer.updateMusic();
             
             // Gestion des clics sur les boutons
-            renderer.handleButtonClicks(simulation);
+            renderer.handleButtonClicks(runner, frame);
             
             // Mise à jour des notifications
             renderer.updateNotifications(deltaTime);
@@ -223,7 +371,7 @@ int main() {
             // Rendu
             try {
                 renderer.beginFrame();
-                renderer.renderSimulation(simulation);
+                renderer.renderSimulation(frame, *graph);
                 renderer.endFrame();
             } catch (const std::exception& e) {
                 std::cout << "ERREUR dans le rendu (Frame " << frameCount << "): " << e.what() << std::endl;
@@ -271,7 +419,15 @@ int main() {
             }
         }
         
-        // Nettoyage
+        // Nettoyage : arrêt du thread de simulation avant de relire la simulation
+        runner.stop();
+        recorder.stop();
+        metrics.stop();
+        if (Tracer::isCompiledIn()) {
+            Tracer::writeChromeTrace(tracePath);
+            std::cout << "Trace: " << Tracer::getEventCount() << " zones (" << Tracer::getDroppedCount()
+                      << " perdues) -> " << tracePath << std::endl;
+        }
         std::cout << "Fermeture de la fenetre..." << std::endl;
         renderer.cleanup();
         
@@ -0,0 +1,133 @@
+#ifndef BATCH_RUNNER_H
+#define BATCH_RUNNER_H
+
+/**
+ * @file BatchRunner.h
+ * @brief Campagnes de simulations sans rendu (Monte-Carlo sur une grille de paramètres)
+ *
+ * Chaque scénario est une simulation indépendante, exécutée sur un seul
+ * thread ; les scénarios sont répartis sur les cœurs par l'ordonnanceur.
+ * Toutes les simulations partagent la même topologie du réseau, chargée
+ * une seule fois.
+ * Les indicateurs (trajets terminés, temps de parcours, reroutages,
+ * congestion) sont relevés à chaque tick par un observateur, puis agrégés
+ * sur les graines : moyenne et demi-largeur de l'intervalle de confiance
+ * à 95 %. Le résultat d'un scénario ne dépend que de ses paramètres (pas
+ * du nombre de threads ni de l'ordre d'exécution).
+ */
+
+#include "Simulation.h"
+#include <memory>
+#include <string>
+#include <vector>
+
+/**
+ * @enum PathfindingAlgorithm
+ * @brief Stratégie de planification des trajets d'un scénario
+ */
+enum class PathfindingAlgorithm {
+    ASTAR,
+    DIJKSTRA
+};
+
+/**
+ * @struct ScenarioParameters
+ * @brief Paramètres d'une simulation de la campagne
+ */
+struct ScenarioParameters {
+    int vehicleCount;
+    float eventInterval;             // Intervalle entre événements aléatoires (s)
+    SimulationMode mode;
+    PathfindingAlgorithm strategy;
+    unsigned int seed;
+};
+
+/**
+ * @struct ScenarioGrid
+ * @brief Grille de paramètres : un scénario par combinaison
+ */
+struct ScenarioGrid {
+    std::vector<int> vehicleCounts;
+    std::vector<float> eventIntervals;
+    std::vector<SimulationMode> modes;
+    std::vector<PathfindingAlgorithm> strategies;
+    std::vector<unsigned int> seeds;
+};
+
+/**
+ * @struct ScenarioResult
+ * @brief Indicateurs d'une simulation
+ */
+struct ScenarioResult {
+    ScenarioParameters parameters;
+    int completedTrips;              // Véhicules arrivés à destination
+    float meanTravelTime;            // Temps de parcours moyen des trajets terminés (s)
+    float maxTravelTime;
+    float throughput;                // Trajets terminés par minute simulée
+    int reroutings;
+    float meanActiveVehicles;        // Véhicules en circulation, moyenne sur les ticks
+    float congestedShare;            // Part des routes hors état normal, moyenne sur les ticks
+    double wallTime;                 // Durée réelle de la simulation (s), seul indicateur non reproductible
+};
+
+/**
+ * @class BatchRunner
+ * @brief Exécution parallèle d'une campagne et écriture des résultats
+ */
+class BatchRunner {
+public:
+    /**
+     * @param configPath Configuration du réseau (vide = réseau de test)
+     */
+    explicit BatchRunner(const std::string& configPath = "");
+    
+    /**
+     * @param topology Réseau partagé par toutes les simulations de la campagne
+     */
+    explicit BatchRunner(std::shared_ptr<const RoadNetwork> topology);
+
+    void setThreadCount(unsigned int count) { threadCount = count; }   // 0 = nombre de cœurs
+    void setDuration(float seconds) { duration = seconds; }            // Temps simulé par scénario
+    void setTimeStep(float seconds) { timeStep = seconds; }
+
+    /**
+     * @brief Produit cartésien de la grille (les graines varient le plus vite)
+     */
+    static std::vector<ScenarioParameters> expandGrid(const ScenarioGrid& grid);
+
+    /**
+     * @brief Exécute les scénarios en parallèle
+     * @return Un résultat par scénario, dans l'ordre des scénarios
+     */
+    const std::vector<ScenarioResult>& run(const std::vector<ScenarioParameters>& scenarios);
+
+    /**
+     * @brief Simule un scénario sur le thread appelant
+     */
+    ScenarioResult runScenario(const ScenarioParameters& parameters) const;
+
+    const std::vector<ScenarioResult>& getResults() const { return results; }
+
+    /**
+     * @brief Écrit les indicateurs agrégés sur les graines (CSV, une ligne par combinaison)
+     * @return Faux en cas d'erreur d'écriture
+     *
+     * Colonnes : paramètres, nombre de graines, puis pour chaque indicateur
+     * sa moyenne et la demi-largeur de son intervalle de confiance à 95 %.
+     */
+    bool writeResults(const std::string& path) const;
+
+    /**
+     * @brief Écrit les indicateurs de chaque simulation (CSV, une ligne par scénario)
+     */
+    bool writeRuns(const std::string& path) const;
+
+private:
+    std::shared_ptr<const RoadNetwork> topology;
+    unsigned int threadCount;
+    float duration;
+    float timeStep;
+    std::vector<ScenarioResult> results;
+};
+
+#endif // BATCH_RUNNER_H
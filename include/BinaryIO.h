@@ -0,0 +1,219 @@
+#ifndef BINARY_IO_H
+#define BINARY_IO_H
+
+/**
+ * @file BinaryIO.h
+ * @brief Encodage binaire compact (points de reprise, enregistrements)
+ *
+ * Les entiers sont écrits en longueur variable (7 bits par octet, LEB128) :
+ * identifiants, compteurs et écarts entre valeurs voisines tiennent en un
+ * ou deux octets. Les entiers signés passent par le codage zigzag (petites
+ * valeurs négatives -> petits entiers). Les flottants sont écrits tels
+ * quels (4 octets) ; tout est en petit-boutiste quelle que soit la machine.
+ */
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+/**
+ * @class BinaryWriter
+ * @brief Écriture dans un tampon mémoire extensible
+ */
+class BinaryWriter {
+public:
+    void reserve(size_t bytes) { buffer.reserve(bytes); }
+    void clear() { buffer.clear(); }
+
+    void writeU8(uint8_t value) { buffer.push_back(value); }
+
+    void writeU32(uint32_t value) {
+        for (int i = 0; i < 4; i++) {
+            buffer.push_back(static_cast<unsigned char>(value >> (8 * i)));
+        }
+    }
+
+    void writeU64(uint64_t value) {
+        for (int i = 0; i < 8; i++) {
+            buffer.push_back(static_cast<unsigned char>(value >> (8 * i)));
+        }
+    }
+
+    void writeFloat(float value) {
+        uint32_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        writeU32(bits);
+    }
+
+    void writeDouble(double value) {
+        uint64_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        writeU64(bits);
+    }
+
+    void writeVarint(uint64_t value) {
+        while (value >= 0x80) {
+            buffer.push_back(static_cast<unsigned char>(value | 0x80));
+            value >>= 7;
+        }
+        buffer.push_back(static_cast<unsigned char>(value));
+    }
+
+    void writeSigned(int64_t value) {
+        writeVarint((static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63));
+    }
+
+    void writeString(const std::string& value) {
+        writeVarint(value.size());
+        buffer.insert(buffer.end(), value.begin(), value.end());
+    }
+
+    // Réécrit un entier 64 bits déjà réservé (en-tête complété après coup)
+    void patchU64(size_t offset, uint64_t value) {
+        for (int i = 0; i < 8; i++) {
+            buffer[offset + i] = static_cast<unsigned char>(value >> (8 * i));
+        }
+    }
+
+    const std::vector<unsigned char>& data() const { return buffer; }
+    size_t size() const { return buffer.size(); }
+
+    // Récupère le contenu écrit (le tampon repart vide)
+    std::vector<unsigned char> take() {
+        std::vector<unsigned char> out;
+        out.swap(buffer);
+        return out;
+    }
+
+private:
+    std::vector<unsigned char> buffer;
+};
+
+/**
+ * @class BinaryReader
+ * @brief Lecture d'un tampon écrit par BinaryWriter
+ *
+ * Une lecture au-delà de la fin (ou un entier mal formé) ne lève pas
+ * d'exception : elle renvoie 0 et marque le lecteur en échec (ok()), à
+ * vérifier une fois la lecture terminée.
+ */
+class BinaryReader {
+public:
+    BinaryReader(const unsigned char* data, size_t size) : data(data), size(size), offset(0), failed(false) {}
+
+    uint8_t readU8() {
+        if (!require(1)) {
+            return 0;
+        }
+        return data[offset++];
+    }
+
+    uint32_t readU32() {
+        if (!require(4)) {
+            return 0;
+        }
+        uint32_t value = 0;
+        for (int i = 0; i < 4; i++) {
+            value |= static_cast<uint32_t>(data[offset++]) << (8 * i);
+        }
+        return value;
+    }
+
+    uint64_t readU64() {
+        if (!require(8)) {
+            return 0;
+        }
+        uint64_t value = 0;
+        for (int i = 0; i < 8; i++) {
+            value |= static_cast<uint64_t>(data[offset++]) << (8 * i);
+        }
+        return value;
+    }
+
+    float readFloat() {
+        uint32_t bits = readU32();
+        float value;
+        std::memcpy(&value, &bits, sizeof(value));
+        return value;
+    }
+
+    double readDouble() {
+        uint64_t bits = readU64();
+        double value;
+        std::memcpy(&value, &bits, sizeof(value));
+        return value;
+    }
+
+    uint64_t readVarint() {
+        uint64_t value = 0;
+        for (int shift = 0; shift < 64; shift += 7) {
+            if (!require(1)) {
+                return 0;
+            }
+            unsigned char byte = data[offset++];
+            value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+            if (!(byte & 0x80)) {
+                return value;
+            }
+        }
+        failed = true;
+        return 0;
+    }
+
+    int64_t readSigned() {
+        uint64_t value = readVarint();
+        return static_cast<int64_t>(value >> 1) ^ -static_cast<int64_t>(value & 1);
+    }
+
+    std::string readString() {
+        uint64_t length = readVarint();
+        if (!require(length)) {
+            return std::string();
+        }
+        std::string value(reinterpret_cast<const char*>(data + offset), static_cast<size_t>(length));
+        offset += static_cast<size_t>(length);
+        return value;
+    }
+
+    // Nombre d'éléments annoncé, borné par les octets restants (au moins un par élément)
+    size_t readCount() {
+        uint64_t count = readVarint();
+        if (count > size - offset) {
+            failed = true;
+            return 0;
+        }
+        return static_cast<size_t>(count);
+    }
+
+    bool ok() const { return !failed; }
+    bool atEnd() const { return offset == size; }
+    size_t remaining() const { return size - offset; }
+
+private:
+    const unsigned char* data;
+    size_t size;
+    size_t offset;
+    bool failed;
+
+    bool require(uint64_t bytes) {
+        if (failed || bytes > size - offset) {
+            failed = true;
+            return false;
+        }
+        return true;
+    }
+};
+
+/**
+ * @brief Empreinte FNV-1a 64 bits (contrôle d'intégrité)
+ */
+inline uint64_t fnv1a64(const unsigned char* data, size_t size, uint64_t hash = 1469598103934665603ULL) {
+    for (size_t i = 0; i < size; i++) {
+        hash ^= data[i];
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+#endif // BINARY_IO_H
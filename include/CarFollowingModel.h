@@ -0,0 +1,128 @@
+#ifndef CAR_FOLLOWING_MODEL_H
+#define CAR_FOLLOWING_MODEL_H
+
+/**
+ * @file CarFollowingModel.h
+ * @brief Modèle de trafic microscopique à poursuite (Intelligent Driver Model)
+ *
+ * Chaque véhicule règle son accélération sur celle de son prédécesseur :
+ *   a = aMax * [1 - (v / v0)^4 - (s* / s)^2]
+ *   s* = s0 + v*T + v*dv / (2 * sqrt(aMax * b))
+ * où v0 est la vitesse courante de la route, s l'écart au véhicule de tête
+ * et dv la vitesse d'approche.
+ *
+ * Chaque route garde ses véhicules dans des tableaux contigus (structure de
+ * tableaux) triés par position décroissante : le prédécesseur de l'indice i
+ * est l'indice i - 1, et le calcul des accélérations est une boucle sans
+ * branchement vectorisable par le compilateur. Le premier véhicule d'une
+ * route suit le dernier de la route suivante de son chemin, ou s'arrête à
+ * la fin de la route si celle-ci est pleine (capacité) ou inutilisable.
+ */
+
+#include "Graph.h"
+#include "TrafficDynamics.h"
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @class CarFollowingModel
+ * @brief Voies triées par route et intégration IDM parallèle
+ */
+class CarFollowingModel : public TrafficDynamics {
+public:
+    // Paramètres IDM (voiture particulière)
+    static constexpr float MAX_ACCELERATION = 1.5f;    // aMax (m/s²)
+    static constexpr float COMFORT_BRAKING = 2.0f;     // b (m/s²)
+    static constexpr float MAX_BRAKING = 9.0f;         // Freinage physique maximal (m/s²)
+    static constexpr float TIME_HEADWAY = 1.2f;        // T (s)
+    static constexpr float MIN_GAP = 2.0f;             // s0 (m)
+    static constexpr float VEHICLE_LENGTH = 4.5f;      // Longueur d'un véhicule (m)
+
+    explicit CarFollowingModel(const Graph* graph);
+
+    void reset() override;
+
+    /**
+     * @brief Insère un véhicule sur sa route actuelle, à sa position, vitesse nulle
+     *
+     * L'entrée est toujours acceptée (apparition, reroutage) : seuls les
+     * transferts entre routes sont soumis à la capacité.
+     */
+    void enter(Vehicle* vehicle, float remainingFraction = 1.0f) override;
+    void remove(Vehicle* vehicle) override;
+
+    /**
+     * @brief Pas IDM : accélérations puis intégration (parallèles par route),
+     * puis transferts entre routes (séquentiels, dans l'ordre des routes)
+     */
+    void step(float deltaTime, std::vector<VehicleMove>& moves,
+              std::vector<Vehicle*>& blocked, TaskScheduler* scheduler = nullptr) override;
+
+    void refreshPositions(TaskScheduler* scheduler) override;
+
+    /**
+     * @brief Pour chaque voie : attente de la tête et véhicules (identifiant, position, vitesse)
+     */
+    void saveState(BinaryWriter& out) const override;
+    bool loadState(BinaryReader& in, const std::function<Vehicle*(int)>& findVehicle) override;
+
+    size_t getVehicleCount() const override { return laneByVehicle.size(); }
+
+    /**
+     * @brief Place libre sur la route et distance de sécurité derrière le dernier véhicule
+     */
+    bool canEnter(int routeIndex) const override;
+
+    /**
+     * @brief Insère un véhicule venant d'une route d'un autre modèle derrière le dernier de la voie
+     */
+    void acceptHandoff(Vehicle* vehicle, float speed) override;
+
+    /**
+     * @brief Véhicules d'une voie, du plus avancé au dernier
+     */
+    void getRouteVehicles(int routeIndex, std::vector<Vehicle*>& out) const;
+    size_t getLaneLength(int routeIndex) const { return lanes[routeIndex].vehicles.size(); }
+
+    // Accès en lecture à une voie (indice 0 = véhicule le plus avancé)
+    const std::vector<float>& getLanePositions(int routeIndex) const { return lanes[routeIndex].position; }
+    const std::vector<float>& getLaneSpeeds(int routeIndex) const { return lanes[routeIndex].speed; }
+
+    /**
+     * @brief Noyau IDM : accélérations d'une voie à partir des écarts et des vitesses d'approche
+     * @param speed Vitesses (m/s)
+     * @param gap Écarts au prédécesseur (m, > 0)
+     * @param approach Vitesse d'approche du prédécesseur (v - vLeader, m/s)
+     * @param desiredSpeed Vitesse désirée v0 (m/s, > 0)
+     * @param acceleration Sortie (m/s², bornée à [-MAX_BRAKING, MAX_ACCELERATION])
+     * @param count Nombre de véhicules
+     */
+    static void computeAccelerations(const float* speed, const float* gap, const float* approach,
+                                     float desiredSpeed, float* acceleration, size_t count);
+
+private:
+    // Voie d'une route : tableaux parallèles triés par position décroissante
+    struct Lane {
+        std::vector<Vehicle*> vehicles;
+        std::vector<float> position;        // Distance parcourue depuis le début de la route (m)
+        std::vector<float> speed;           // m/s
+        std::vector<float> acceleration;    // m/s² (calculée à chaque pas)
+        std::vector<float> gap;             // Tampons du noyau
+        std::vector<float> approach;
+        float headWait = 0.0f;              // Attente de la tête à l'arrêt devant une route pleine
+
+        void insert(Vehicle* vehicle, float atPosition, float atSpeed);
+        void erase(size_t index);
+    };
+
+    const Graph* graph;
+    std::vector<Lane> lanes;
+    std::unordered_map<const Vehicle*, int> laneByVehicle;
+
+    float desiredSpeed(int routeIndex) const;
+    bool nextRouteClosed(int nextRoute, const Lane& lane) const;
+    void computeLane(int routeIndex);
+    void integrateLane(int routeIndex, float deltaTime);
+};
+
+#endif // CAR_FOLLOWING_MODEL_H
@@ -0,0 +1,58 @@
+#ifndef CONFIG_LOADER_H
+#define CONFIG_LOADER_H
+
+/**
+ * @file ConfigLoader.h
+ * @brief Lecture en flux des fichiers de configuration JSON (config/config.json)
+ *
+ * Le fichier est lu par blocs dans un tampon de taille fixe et analysé en
+ * une seule passe, sans arbre intermédiaire : chaque nœud et chaque route
+ * sont ajoutés à la topologie dès leur accolade fermante, et l'analyse
+ * n'alloue rien par élément. Un fichier de plusieurs centaines de Mo se
+ * charge à la vitesse du disque.
+ *
+ * Schéma reconnu (clés inconnues ignorées, ordre libre) :
+ *   simulation : vehicleCount, eventCount, timeScale, mode ("NORMAL" | "DYNAMIC")
+ *   graph.nodes : [{id, x, y}]
+ *   graph.routes : [{id, from, to, length, speed, capacity}] (length absente : distance entre les nœuds)
+ *   events : interval, types (["ACCIDENT", "TRAFFIC_JAM", "ROAD_CLOSURE", "EMERGENCY"])
+ */
+
+#include "RoadNetwork.h"
+#include <string>
+#include <vector>
+
+/**
+ * @struct SimulationConfig
+ * @brief Paramètres des sections simulation et events (valeur négative ou vide : absent du fichier)
+ */
+struct SimulationConfig {
+    int vehicleCount = -1;
+    int eventCount = -1;
+    float timeScale = -1.0f;
+    std::string mode;
+    float eventInterval = -1.0f;
+    std::vector<std::string> eventTypes;
+};
+
+/**
+ * @class ConfigLoader
+ * @brief Analyse en flux d'une configuration vers une topologie et des paramètres
+ */
+class ConfigLoader {
+public:
+    static constexpr size_t BUFFER_SIZE = 1 << 20;     // Taille des blocs lus (octets)
+
+    /**
+     * @brief Charge un fichier de configuration
+     * @param path Fichier JSON
+     * @param network Topologie (vide) qui reçoit les nœuds et les routes
+     * @param settings Paramètres lus
+     * @param error Message (avec numéro de ligne) si le chargement échoue
+     * @return Faux si le fichier est illisible, mal formé, ou si une route
+     *         référence un nœud inconnu ; network est alors incomplet
+     */
+    static bool load(const std::string& path, RoadNetwork& network, SimulationConfig& settings, std::string& error);
+};
+
+#endif // CONFIG_LOADER_H
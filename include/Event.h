@@ -1,3 +1,6 @@
+#ifndef EVENT_H
+#define EVENT_H
+
 /**
  * @file Event.h
  * @brief Représentation d'un événement affectant le trafic
@@ -6,9 +9,6 @@
  * (accidents, embouteillages, fermetures de route, urgences).
  */
 
-#ifndef EVENT_H
-#define EVENT_H
-
 #include "Route.h"
 #include <string>
 #include <chrono>
@@ -56,6 +56,9 @@ public:
     // Mise à jour
     void update(float deltaTime);
     
+    // Restauration d'un point de reprise
+    void restoreState(float savedElapsedTime, bool savedActive);
+    
     // Application de l'événement à une route
     void applyToRoute(Route* route) const;
     
@@ -0,0 +1,144 @@
+#ifndef FRAME_PROFILER_H
+#define FRAME_PROFILER_H
+
+/**
+ * @file FrameProfiler.h
+ * @brief Temps par phase et compteurs de chaque image, pour l'affichage en surimpression
+ *
+ * Les phases de la simulation (tick complet, recherches de chemin, trafic,
+ * apparition des véhicules) sont mesurées en permanence par la simulation
+ * et arrivent cumulées dans l'instantané (SimulationProfile) ; les passes
+ * du rendu sont mesurées par le Renderer (ProfileTimer). À chaque image,
+ * le profileur range la différence avec l'image précédente dans un
+ * historique circulaire de HISTORY images.
+ *
+ * Le nombre d'allocations est compté par les opérateurs new globaux
+ * remplacés dans FrameProfiler.cpp (un incrément atomique par allocation,
+ * tous threads confondus ; les allocations sur-alignées ne sont pas
+ * comptées).
+ */
+
+#include "FrameSnapshot.h"
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @enum ProfilePhase
+ * @brief Phase mesurée par le profileur
+ */
+enum class ProfilePhase {
+    SIMULATION,             ///< Ticks complets
+    PATHFINDING,            ///< Recherches de chemin (somme sur les threads)
+    TRAFFIC,                ///< Véhicules et mise à jour du trafic
+    SPAWN,                  ///< Apparition des véhicules
+    RENDER_GRAPH,
+    RENDER_VEHICLES,
+    RENDER_EVENTS,
+    RENDER_UI,
+    RENDER_NOTIFICATIONS,
+    COUNT
+};
+
+/**
+ * @class FrameProfiler
+ * @brief Historique des temps par phase et des compteurs des dernières images
+ */
+class FrameProfiler {
+public:
+    static constexpr size_t PHASE_COUNT = static_cast<size_t>(ProfilePhase::COUNT);
+    static constexpr size_t HISTORY = 120;          // Images conservées (2 s à 60 images/s)
+
+    /**
+     * @struct Sample
+     * @brief Une image : temps par phase (ms) et compteurs
+     */
+    struct Sample {
+        std::array<float, PHASE_COUNT> phaseTime{};
+        uint32_t ticks = 0;
+        uint32_t searches = 0;
+        uint32_t reroutes = 0;
+        uint32_t allocations = 0;
+    };
+
+    FrameProfiler();
+
+    /**
+     * @brief Termine l'image en cours et en commence une nouvelle
+     * @param simulation Cumuls de la simulation (instantané affiché)
+     * @param totalReroutings Cumul des reroutages
+     *
+     * L'image terminée reçoit tout ce qui s'est passé depuis le début de
+     * la précédente. Un cumul qui diminue (nouvelle simulation) compte 0.
+     */
+    void beginFrame(const SimulationProfile& simulation, int totalReroutings);
+
+    // Temps passé dans une phase du rendu pendant l'image en cours
+    void addTime(ProfilePhase phase, uint64_t nanoseconds) {
+        current().phaseTime[static_cast<size_t>(phase)] += static_cast<float>(nanoseconds * 1e-6);
+    }
+
+    // Images terminées dans l'historique (au plus HISTORY)
+    size_t getFrameCount() const { return frameCount; }
+
+    // Image terminée : age 0 = la plus récente
+    const Sample& getFrame(size_t age) const {
+        return samples[(head + RING_SIZE - 1 - age) % RING_SIZE];
+    }
+
+    // Moyenne et maximum sur l'historique (ms)
+    float getAverage(ProfilePhase phase) const;
+    float getMax(ProfilePhase phase) const;
+
+    // Moyennes des compteurs par image sur l'historique
+    float getAverageSearches() const;
+    float getAverageReroutes() const;
+    float getAverageAllocations() const;
+
+    static const char* getPhaseName(ProfilePhase phase);
+
+    // Allocations effectuées par le processus depuis son lancement
+    static uint64_t getAllocationCount();
+
+private:
+    static constexpr size_t RING_SIZE = HISTORY + 1;   // Historique et image en cours
+
+    std::array<Sample, RING_SIZE> samples;
+    size_t head;                    // Image en cours
+    size_t frameCount;
+    bool started;
+    SimulationProfile lastSimulation;
+    int lastReroutings;
+    uint64_t lastAllocations;
+
+    Sample& current() { return samples[head]; }
+
+    template<typename Getter>
+    float average(Getter getter) const;
+};
+
+/**
+ * @class ProfileTimer
+ * @brief Mesure une portée et l'ajoute à une phase du profileur
+ */
+class ProfileTimer {
+public:
+    ProfileTimer(FrameProfiler& profiler, ProfilePhase phase)
+        : profiler(profiler), phase(phase), start(std::chrono::steady_clock::now()) {}
+
+    ~ProfileTimer() {
+        auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+        profiler.addTime(phase, static_cast<uint64_t>(elapsed.count()));
+    }
+
+    ProfileTimer(const ProfileTimer&) = delete;
+    ProfileTimer& operator=(const ProfileTimer&) = delete;
+
+private:
+    FrameProfiler& profiler;
+    ProfilePhase phase;
+    std::chrono::steady_clock::time_point start;
+};
+
+#endif // FRAME_PROFILER_H
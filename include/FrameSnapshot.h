@@ -0,0 +1,183 @@
+#ifndef FRAME_SNAPSHOT_H
+#define FRAME_SNAPSHOT_H
+
+/**
+ * @file FrameSnapshot.h
+ * @brief Instantané immuable de l'état de la simulation, échangé entre le thread de simulation et le rendu
+ *
+ * Le thread de simulation remplit un instantané après chaque cycle et le
+ * publie dans un triple tampon ; le rendu dessine le plus récent sans
+ * jamais lire la simulation en cours de mise à jour. Les trois tampons
+ * sont réutilisés : les tableaux gardent leur capacité d'un cycle à
+ * l'autre et la publication n'alloue pas.
+ *
+ * Chaque véhicule porte aussi sa position au tick précédent : le rendu
+ * interpole entre les deux selon le temps réel écoulé depuis le dernier
+ * tick, ce qui donne un mouvement fluide quelle que soit la fréquence de
+ * simulation (affichage en retard d'un tick).
+ */
+
+#include "Event.h"
+#include "Route.h"
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+enum class SimulationMode;
+enum class TrafficModel;
+
+/**
+ * @struct VehicleSnapshot
+ * @brief Position de rendu d'un véhicule en circulation, au dernier tick et au précédent
+ */
+struct VehicleSnapshot {
+    int id;
+    int type;
+    float x;
+    float y;
+    float angle;
+    float previousX;
+    float previousY;
+    float previousAngle;
+
+    /**
+     * @brief Position interpolée entre le tick précédent (alpha = 0) et le dernier (alpha = 1)
+     *
+     * L'angle suit le plus court chemin (pas de tour complet entre 350° et 10°).
+     */
+    void interpolate(float alpha, float& outX, float& outY, float& outAngle) const {
+        const float pi = 3.14159265359f;
+        outX = previousX + (x - previousX) * alpha;
+        outY = previousY + (y - previousY) * alpha;
+        float turn = std::remainder(angle - previousAngle, 2.0f * pi);
+        outAngle = previousAngle + turn * alpha;
+    }
+};
+
+/**
+ * @struct EventSnapshot
+ * @brief État d'un événement
+ */
+struct EventSnapshot {
+    int id;
+    EventType type;
+    int routeId;
+    float duration;
+    float elapsedTime;
+    bool active;
+};
+
+/**
+ * @struct SimulationProfile
+ * @brief Temps passé dans les phases du tick, cumulé depuis la création de la simulation
+ *
+ * Cumuls plutôt que valeurs du dernier tick : une image peut couvrir
+ * plusieurs ticks (ou aucun), le rendu fait la différence entre deux
+ * instantanés. Les recherches de chemin sont mesurées sur tous les
+ * threads : leur temps peut dépasser celui du tick.
+ */
+struct SimulationProfile {
+    uint64_t ticks = 0;
+    uint64_t updateTime = 0;        // ns, tick complet
+    uint64_t trafficTime = 0;       // ns, déplacement des véhicules et mise à jour du trafic
+    uint64_t spawnTime = 0;         // ns, planification et ajout des nouveaux véhicules
+    uint64_t pathfindingTime = 0;   // ns, somme des recherches (PathPlanner)
+    uint64_t searches = 0;
+};
+
+/**
+ * @struct FrameSnapshot
+ * @brief État de la simulation à la fin d'un cycle
+ */
+struct FrameSnapshot {
+    std::vector<VehicleSnapshot> vehicles;      // Véhicules en circulation
+    std::vector<RouteState> routeStates;        // Index dans Graph::getRoutes()
+    std::vector<EventSnapshot> events;
+
+    size_t vehicleCount = 0;                    // Véhicules gérés (y compris arrivés ce tick)
+    float simulationTime = 0.0f;
+    int totalReroutings = 0;
+    SimulationMode mode{};
+    TrafficModel trafficModel{};
+    bool paused = false;
+    float timeScale = 1.0f;
+    bool fastForward = false;
+    float effectiveTimeScale = 1.0f;
+    int triggeredEvents = 0;                    // Événements déclenchés par commande depuis le départ
+    int completedPreviews = 0;                  // Aperçus de fermeture terminés depuis le départ
+    int previewRouteId = -1;                    // Dernier aperçu : route, retard moyen par trajet (s), trajets perdus
+    float previewDelay = 0.0f;
+    int previewLostTrips = 0;
+    SimulationProfile profile;
+
+    double tickTime = 0.0;                      // Instant réel du dernier tick (snapshotClock)
+    float tickInterval = 0.0f;                  // Durée réelle entre les deux derniers ticks (s)
+
+    /**
+     * @brief Facteur d'interpolation à l'instant réel now (0 = tick précédent, 1 = dernier tick)
+     */
+    float interpolation(double now) const {
+        if (tickInterval <= 0.0f) {
+            return 1.0f;
+        }
+        float alpha = static_cast<float>(now - tickTime) / tickInterval;
+        return alpha < 0.0f ? 0.0f : (alpha > 1.0f ? 1.0f : alpha);
+    }
+};
+
+/**
+ * @brief Horloge commune au thread de simulation et au rendu (secondes)
+ */
+inline double snapshotClock() {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+/**
+ * @class TripleBuffer
+ * @brief Triple tampon sans verrou à un producteur et un consommateur
+ *
+ * Le producteur écrit dans son tampon puis l'échange avec le tampon
+ * « prêt » ; le consommateur échange son tampon avec le tampon prêt s'il
+ * est nouveau. Chacun garde un tampon à lui : aucun n'attend l'autre, et
+ * le consommateur obtient toujours le dernier état publié.
+ */
+template<typename T>
+class TripleBuffer {
+public:
+    // Producteur : tampon à remplir puis publier
+    T& writeBuffer() { return buffers[backIndex].value; }
+
+    void publish() {
+        unsigned char previous = ready.exchange(static_cast<unsigned char>(backIndex | FRESH),
+                                                std::memory_order_acq_rel);
+        backIndex = previous & INDEX_MASK;
+    }
+
+    // Consommateur : récupère le dernier tampon publié (faux si rien de nouveau)
+    bool update() {
+        if (!(ready.load(std::memory_order_acquire) & FRESH)) {
+            return false;
+        }
+        unsigned char previous = ready.exchange(frontIndex, std::memory_order_acq_rel);
+        frontIndex = previous & INDEX_MASK;
+        return true;
+    }
+
+    const T& readBuffer() const { return buffers[frontIndex].value; }
+
+private:
+    static constexpr unsigned char INDEX_MASK = 0x3;
+    static constexpr unsigned char FRESH = 0x4;
+
+    struct alignas(64) Slot {
+        T value;
+    };
+    Slot buffers[3];
+    std::atomic<unsigned char> ready{1};
+    unsigned char backIndex = 0;     // Propriété du producteur
+    unsigned char frontIndex = 2;    // Propriété du consommateur
+};
+
+#endif // FRAME_SNAPSHOT_H
@@ -1,75 +1,151 @@
+#ifndef GRAPH_H
+#define GRAPH_H
+
 /**
  * @file Graph.h
  * @brief Représentation du graphe du réseau routier
  * 
  * Cette classe modélise le réseau routier comme un graphe orienté
- * avec des nœuds (intersections) et des routes (arêtes).
+ * avec des nœuds (intersections) et des routes (arêtes). La topologie
+ * (RoadNetwork) est immuable et peut être partagée entre plusieurs graphes ;
+ * chaque graphe ne possède que l'état dynamique de ses routes.
  */
 
-#ifndef GRAPH_H
-#define GRAPH_H
-
+#include "RoadNetwork.h"
 #include "Route.h"
+#include <cstdint>
+#include <string>
 #include <vector>
 #include <unordered_map>
 #include <memory>
 
-/**
- * @struct Node
- * @brief Représente un nœud (intersection) dans le graphe
- */
-struct Node {
-    int id;        ///< Identifiant unique du nœud
-    float x, y;    ///< Position pour la visualisation
-    
-    /**
-     * @brief Constructeur du nœud
-     * @param id Identifiant unique
-     * @param x Coordonnée X
-     * @param y Coordonnée Y
-     */
-    Node(int id, float x, float y) : id(id), x(x), y(y) {}
-};
-
 /**
  * @class Graph
  * @brief Classe représentant le graphe du réseau routier
  * 
  * Gère les nœuds et routes du réseau, permet la recherche de chemins
  * et le chargement depuis un fichier de configuration JSON.
+ *
+ * Les nœuds et les attributs fixes des routes sont lus dans la topologie ;
+ * les Route du graphe n'en portent que l'état dynamique (vitesse,
+ * occupation, état). addNode/addRoute sur une topologie partagée en font
+ * d'abord une copie privée : les autres graphes ne voient jamais de
+ * modification.
  */
 class Graph {
 private:
-    std::vector<std::unique_ptr<Node>> nodes;
-    std::vector<std::unique_ptr<Route>> routes;
-    std::unordered_map<int, std::vector<int>> adjacencyList; // nodeId -> vector of route indices
+    std::shared_ptr<const RoadNetwork> network;
+    RoadNetwork* editableNetwork;                            // Topologie propre au graphe, nul si elle vient d'ailleurs
+    std::vector<std::unique_ptr<Route>> routes;              // État dynamique, une route par route de la topologie
+    std::vector<int> changedRoutes;                          // Routes modifiées depuis le dernier lot
+    std::vector<int> pendingVehicleDeltas;                   // Entrées - sorties de véhicules du tick, par route
+    std::vector<int> touchedRoutes;                          // Routes ayant un solde en attente
+    
+    // Copie privée de la topologie avant modification si elle est partagée
+    RoadNetwork& editTopology();
     
 public:
     Graph();
+    
+    /**
+     * @brief Graphe sur une topologie existante, routes à l'état initial
+     */
+    explicit Graph(std::shared_ptr<const RoadNetwork> topology);
     ~Graph();
     
+    // Les routes référencent changedRoutes : le graphe n'est ni copiable ni déplaçable
+    Graph(const Graph&) = delete;
+    Graph& operator=(const Graph&) = delete;
+    
     // Ajout de nœuds et routes
     void addNode(int id, float x, float y);
     void addRoute(int id, int fromNode, int toNode, float length, float speed, int capacity);
     
+    /**
+     * @brief Remplace la topologie ; l'état dynamique repart de zéro
+     * 
+     * Le graphe garde son adresse : les composants qui le référencent
+     * (planificateur, modèles de trafic) restent valides.
+     */
+    void setTopology(std::shared_ptr<const RoadNetwork> topology);
+    
+    /**
+     * @brief Topologie du graphe, à partager avec d'autres graphes
+     */
+    std::shared_ptr<const RoadNetwork> getTopology() const { return network; }
+    
     // Accès aux données
-    Node* getNode(int id) const;
+    const Node* getNode(int id) const { return network->getNode(id); }
     Route* getRoute(int id) const;
-    std::vector<int> getNeighbors(int nodeId) const;
-    std::vector<int> getRoutesFromNode(int nodeId) const;
+    std::vector<int> getNeighbors(int nodeId) const { return network->getNeighbors(nodeId); }
+    const std::vector<int>& getRoutesFromNode(int nodeId) const { return network->getRoutesFromNode(nodeId); }
+    
+    /**
+     * @brief Index (dans getRoutes()) de la route d'identifiant donné
+     * @return Index de la route, ou -1 si inconnue
+     */
+    int getRouteIndex(int routeId) const { return network->getRouteIndex(routeId); }
+    
+    /**
+     * @brief Index de la route reliant deux nœuds (dans un sens ou l'autre)
+     * 
+     * Parcourt uniquement les routes incidentes à fromNode (O(degré)).
+     * @return Index de la route, ou -1 si les nœuds ne sont pas reliés
+     */
+    int findRouteIndex(int fromNode, int toNode) const { return network->findRouteIndex(fromNode, toNode); }
     
     // Recherche de chemin
     std::vector<int> findPath(int start, int end) const;
     
-    // Mise à jour du trafic
+    /**
+     * @brief Enregistre l'entrée (+1) ou la sortie (-1) de véhicules sur une route
+     * 
+     * Les soldes sont cumulés et appliqués une seule fois par route dans updateTraffic().
+     * @param routeIndex Index de la route dans getRoutes()
+     * @param delta Variation du nombre de véhicules
+     */
+    void queueVehicleDelta(int routeIndex, int delta);
+    
+    // Mise à jour du trafic (applique les soldes de véhicules en attente)
     void updateTraffic();
     
+    /**
+     * @brief Récupère le lot de routes modifiées (setState/setCongestion)
+     * 
+     * Chaque route n'apparaît qu'une fois par lot, dans l'ordre de son
+     * premier changement. Le lot est vidé par l'appel.
+     * @return Index des routes modifiées depuis le dernier appel
+     */
+    std::vector<int> consumeRouteChanges();
+    
+    // Points de reprise : soldes d'occupation et lot de changements pas encore traités
+    int getPendingVehicleDelta(int routeIndex) const;
+    const std::vector<int>& getPendingRouteChanges() const { return changedRoutes; }
+    
+    /**
+     * @brief Remplace les soldes en attente et le lot de changements (restauration d'un point de reprise)
+     * @param vehicleDeltas Solde par index de route
+     * @param routeChanges Lot de changements, dans l'ordre d'origine
+     */
+    void restorePendingState(const std::vector<int>& vehicleDeltas, const std::vector<int>& routeChanges);
+    
+    /**
+     * @brief Empreinte de la topologie et de la géométrie (nœuds, routes, longueurs, capacités)
+     * 
+     * Permet de vérifier qu'un fichier (point de reprise, enregistrement) a été
+     * produit pour ce réseau.
+     */
+    uint64_t getFingerprint() const { return network->getFingerprint(); }
+    
     // Getters
-    const std::vector<std::unique_ptr<Node>>& getNodes() const { return nodes; }
+    const std::vector<std::unique_ptr<Node>>& getNodes() const { return network->getNodes(); }
     const std::vector<std::unique_ptr<Route>>& getRoutes() const { return routes; }
     
-    // Chargement depuis configuration
-    void loadFromConfig(const std::string& configPath);
+    /**
+     * @brief Remplace la topologie par celle d'un fichier de configuration (ConfigLoader)
+     * @return Faux (message affiché, graphe inchangé) si le fichier est illisible ou invalide
+     */
+    bool loadFromConfig(const std::string& configPath);
 };
 
 #endif // GRAPH_H
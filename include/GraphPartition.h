@@ -0,0 +1,109 @@
+#ifndef GRAPH_PARTITION_H
+#define GRAPH_PARTITION_H
+
+/**
+ * @file GraphPartition.h
+ * @brief Découpage spatial du réseau routier en régions
+ *
+ * Le graphe est découpé par bissections récursives selon les coordonnées
+ * des nœuds (toujours le long de l'axe le plus étendu), ce qui donne des
+ * régions compactes et de tailles équilibrées. Chaque route appartient à
+ * la région de son nœud de départ ; une route dont les extrémités sont dans
+ * deux régions différentes est une route frontière.
+ *
+ * Utilisé par la simulation pour la décomposition de domaine : un thread
+ * par région, propriétaire de ses routes et des véhicules qui y circulent.
+ */
+
+#include "Graph.h"
+#include <vector>
+
+/**
+ * @class GraphPartition
+ * @brief Affectation des nœuds et des routes d'un graphe à des régions
+ *
+ * Instantané du graphe au moment de la construction : à reconstruire si
+ * des nœuds ou des routes sont ajoutés.
+ */
+class GraphPartition {
+private:
+    int regionCount;
+    std::vector<int> nodeRegion;                 // Index de nœud -> région
+    std::unordered_map<int, int> nodeIndexById;  // ID de nœud -> index de nœud
+    std::vector<int> routeRegion;                // Index de route -> région
+    std::vector<bool> boundaryRoute;             // Index de route -> route frontière
+    std::vector<std::vector<int>> regionRoutes;  // Région -> index des routes possédées
+
+    void bisect(const Graph& graph, std::vector<int>& nodeIndices,
+                size_t begin, size_t end, int firstRegion, int count);
+
+public:
+    /**
+     * @brief Construit le découpage
+     * @param graph Graphe à découper
+     * @param regionCount Nombre de régions souhaité (au moins 1)
+     */
+    GraphPartition(const Graph& graph, int regionCount);
+
+    int getRegionCount() const { return regionCount; }
+
+    /**
+     * @brief Région d'un nœud à partir de son ID (-1 si inconnu)
+     */
+    int getNodeRegion(int nodeId) const;
+
+    /**
+     * @brief Région propriétaire d'une route (index dans Graph::getRoutes, -1 si invalide)
+     */
+    int getRouteRegion(int routeIndex) const {
+        return (routeIndex >= 0 && routeIndex < static_cast<int>(routeRegion.size())) ? routeRegion[routeIndex] : -1;
+    }
+
+    bool isBoundaryRoute(int routeIndex) const { return boundaryRoute[routeIndex]; }
+    const std::vector<int>& getRegionRoutes(int region) const { return regionRoutes[region]; }
+};
+
+/**
+ * @class RegionMailboxes
+ * @brief Boîtes aux lettres entre régions, échangées aux limites de tick
+ *
+ * Une boîte par couple (source, destination) : pendant la phase parallèle
+ * seule la région source écrit dans ses boîtes sortantes, et seule la
+ * région destination les vide après la barrière de fin de phase. Aucun
+ * verrou ni opération atomique n'est donc nécessaire. Le dépouillement
+ * suit l'ordre des régions sources, ce qui rend l'échange déterministe.
+ */
+template <typename T>
+class RegionMailboxes {
+private:
+    int regionCount = 0;
+    std::vector<std::vector<T>> boxes;  // boxes[source * regionCount + destination]
+
+public:
+    void resize(int count) {
+        regionCount = count;
+        boxes.assign(static_cast<size_t>(count) * count, std::vector<T>());
+    }
+
+    void post(int from, int to, const T& item) {
+        boxes[static_cast<size_t>(from) * regionCount + to].push_back(item);
+    }
+
+    /**
+     * @brief Vide les boîtes entrantes d'une région
+     * @param to Région destination
+     * @param receive Appelée pour chaque élément reçu
+     */
+    template <typename Receive>
+    void drain(int to, Receive&& receive) {
+        for (int from = 0; from < regionCount; from++) {
+            auto& box = boxes[static_cast<size_t>(from) * regionCount + to];
+            for (const T& item : box) {
+                receive(item);
+            }
+            box.clear();
+        }
+    }
+};
+
+#endif // GRAPH_PARTITION_H
@@ -0,0 +1,163 @@
+#ifndef HISTOGRAM_H
+#define HISTOGRAM_H
+
+/**
+ * @file Histogram.h
+ * @brief Histogramme log-linéaire à précision relative bornée (type HDR)
+ *
+ * Les valeurs entières sont rangées dans des seaux dont la largeur double à
+ * chaque puissance de deux, chaque puissance étant divisée en SUB_COUNT
+ * seaux égaux : l'erreur relative d'un percentile est au plus 1/SUB_COUNT
+ * (environ 3 %), quelle que soit l'échelle. Le tableau est de taille fixe,
+ * sans allocation : un enregistrement coûte quelques nanosecondes (un
+ * calcul de bit de poids fort et trois additions) et deux histogrammes se
+ * fusionnent par simple addition des seaux.
+ */
+
+#include "BinaryIO.h"
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @class Histogram
+ * @brief Distribution de valeurs entières positives (durées en ms, ns...)
+ *
+ * Les valeurs au-delà de 2^MAX_MAGNITUDE sont comptées dans le dernier seau
+ * (la moyenne et le maximum restent exacts).
+ */
+class Histogram {
+public:
+    static constexpr int SUB_BITS = 5;
+    static constexpr uint64_t SUB_COUNT = uint64_t(1) << SUB_BITS;     // Seaux par puissance de deux
+    static constexpr int MAX_MAGNITUDE = 40;
+    static constexpr size_t BUCKET_COUNT = (MAX_MAGNITUDE - SUB_BITS + 1) * SUB_COUNT;
+
+    Histogram() { clear(); }
+
+    void record(uint64_t value) {
+        counts[bucketIndex(value)]++;
+        count++;
+        sum += value;
+        max = std::max(max, value);
+    }
+
+    void merge(const Histogram& other) {
+        for (size_t i = 0; i < BUCKET_COUNT; i++) {
+            counts[i] += other.counts[i];
+        }
+        count += other.count;
+        sum += other.sum;
+        max = std::max(max, other.max);
+    }
+
+    void clear() {
+        counts.fill(0);
+        count = 0;
+        sum = 0;
+        max = 0;
+    }
+
+    uint64_t getCount() const { return count; }
+    uint64_t getSum() const { return sum; }
+    uint64_t getMax() const { return max; }
+    double getMean() const { return count > 0 ? static_cast<double>(sum) / count : 0.0; }
+
+    /**
+     * @brief Valeur sous laquelle se trouve la fraction quantile des échantillons
+     * @param quantile Entre 0 et 1 (0.99 = p99)
+     * @return Milieu du seau correspondant, borné par le maximum (0 si vide)
+     */
+    uint64_t percentile(double quantile) const {
+        if (count == 0) {
+            return 0;
+        }
+        quantile = std::max(0.0, std::min(1.0, quantile));
+        uint64_t rank = std::max<uint64_t>(1, static_cast<uint64_t>(quantile * count + 0.5));
+        uint64_t seen = 0;
+        for (size_t i = 0; i < BUCKET_COUNT; i++) {
+            seen += counts[i];
+            if (seen >= rank) {
+                return std::min(max, bucketLowest(i) + bucketWidth(i) / 2);
+            }
+        }
+        return max;
+    }
+
+    // Points de reprise : seaux non vides seulement (index codé par écart au précédent)
+    void write(BinaryWriter& out) const {
+        out.writeVarint(count);
+        out.writeVarint(sum);
+        out.writeVarint(max);
+        size_t used = BUCKET_COUNT - static_cast<size_t>(std::count(counts.begin(), counts.end(), uint64_t(0)));
+        out.writeVarint(used);
+        size_t previous = 0;
+        for (size_t i = 0; i < BUCKET_COUNT; i++) {
+            if (counts[i] != 0) {
+                out.writeVarint(i - previous);
+                out.writeVarint(counts[i]);
+                previous = i;
+            }
+        }
+    }
+
+    bool read(BinaryReader& in) {
+        clear();
+        count = in.readVarint();
+        sum = in.readVarint();
+        max = in.readVarint();
+        size_t used = in.readCount();
+        size_t index = 0;
+        for (size_t i = 0; i < used; i++) {
+            index += static_cast<size_t>(in.readVarint());
+            if (index >= BUCKET_COUNT) {
+                return false;
+            }
+            counts[index] = in.readVarint();
+        }
+        return in.ok();
+    }
+
+    static size_t bucketIndex(uint64_t value) {
+        if (value < SUB_COUNT) {
+            return static_cast<size_t>(value);
+        }
+        value = std::min(value, (uint64_t(1) << MAX_MAGNITUDE) - 1);
+        int shift = highestBit(value) - SUB_BITS;
+        return static_cast<size_t>((shift + 1) * SUB_COUNT + ((value >> shift) - SUB_COUNT));
+    }
+
+    static uint64_t bucketLowest(size_t index) {
+        if (index < SUB_COUNT) {
+            return index;
+        }
+        int shift = static_cast<int>(index / SUB_COUNT) - 1;
+        return (SUB_COUNT + index % SUB_COUNT) << shift;
+    }
+
+    static uint64_t bucketWidth(size_t index) {
+        return index < SUB_COUNT ? 1 : uint64_t(1) << (index / SUB_COUNT - 1);
+    }
+
+private:
+    std::array<uint64_t, BUCKET_COUNT> counts;
+    uint64_t count;
+    uint64_t sum;
+    uint64_t max;
+
+    // Position du bit de poids fort (value > 0)
+    static int highestBit(uint64_t value) {
+#if defined(__GNUC__) || defined(__clang__)
+        return 63 - __builtin_clzll(value);
+#else
+        int bit = 0;
+        while (value >>= 1) {
+            bit++;
+        }
+        return bit;
+#endif
+    }
+};
+
+#endif // HISTOGRAM_H
@@ -0,0 +1,93 @@
+#ifndef HYBRID_MODEL_H
+#define HYBRID_MODEL_H
+
+/**
+ * @file HybridModel.h
+ * @brief Modèle de trafic hybride : microscopique dans la zone observée, mésoscopique ailleurs
+ *
+ * Les routes situées dans la zone de focus (partie visible de la carte)
+ * sont simulées par le modèle à poursuite (CarFollowingModel), les autres
+ * par le modèle à files d'attente (QueueModel). Chaque route appartient à
+ * un seul des deux modèles ; un véhicule qui passe d'une route à une route
+ * de l'autre modèle lui est remis (TrafficDynamics::acceptHandoff), et
+ * chaque modèle consulte l'autre pour savoir si la route suivante peut
+ * accueillir un véhicule.
+ *
+ * Lorsque la zone de focus change, les véhicules des routes qui changent
+ * de modèle sont transférés en conservant leur progression.
+ */
+
+#include "CarFollowingModel.h"
+#include "QueueModel.h"
+#include <vector>
+
+/**
+ * @class HybridModel
+ * @brief Répartition des routes entre un modèle microscopique et un modèle mésoscopique
+ */
+class HybridModel : public TrafficDynamics {
+public:
+    explicit HybridModel(const Graph* graph);
+
+    /**
+     * @brief Définit la zone simulée finement (coordonnées du monde)
+     *
+     * Une route est microscopique si l'une de ses extrémités ou son milieu
+     * est dans le rectangle. Sans effet si la zone n'a pas changé.
+     */
+    void setFocusArea(float minX, float minY, float maxX, float maxY);
+
+    /**
+     * @brief Supprime la zone de focus : tout le réseau passe en mésoscopique
+     */
+    void clearFocusArea();
+
+    bool isMicroscopic(int routeIndex) const { return microRoutes[routeIndex] != 0; }
+    size_t getMicroRouteCount() const;
+
+    void reset() override;
+
+    /**
+     * @brief Place le véhicule dans le modèle qui gère sa route actuelle
+     */
+    void enter(Vehicle* vehicle, float remainingFraction = 1.0f) override;
+    void remove(Vehicle* vehicle) override;
+
+    /**
+     * @brief Pas microscopique puis pas mésoscopique
+     *
+     * Les remises d'un modèle à l'autre se font pendant ces pas ; les deux
+     * modèles étant séquentiels dans leurs transferts, le résultat reste
+     * déterministe.
+     */
+    void step(float deltaTime, std::vector<VehicleMove>& moves,
+              std::vector<Vehicle*>& blocked, TaskScheduler* scheduler = nullptr) override;
+
+    void refreshPositions(TaskScheduler* scheduler) override;
+
+    /**
+     * @brief Zone de focus, puis états des modèles mésoscopique et microscopique
+     */
+    void saveState(BinaryWriter& out) const override;
+    bool loadState(BinaryReader& in, const std::function<Vehicle*(int)>& findVehicle) override;
+
+    size_t getVehicleCount() const override { return micro.getVehicleCount() + meso.getVehicleCount(); }
+    bool canEnter(int routeIndex) const override;
+    void acceptHandoff(Vehicle* vehicle, float speed) override;
+
+    const CarFollowingModel& getMicroModel() const { return micro; }
+    const QueueModel& getMesoModel() const { return meso; }
+
+private:
+    const Graph* graph;
+    QueueModel meso;
+    CarFollowingModel micro;
+    std::vector<unsigned char> microRoutes;   // Masques complémentaires (index de route -> 1)
+    std::vector<unsigned char> mesoRoutes;
+    bool hasFocus;
+    float focus[4];                           // minX, minY, maxX, maxY
+
+    void applyFocus(const std::vector<unsigned char>& newMicroRoutes);
+};
+
+#endif // HYBRID_MODEL_H
@@ -0,0 +1,62 @@
+#ifndef KPI_COLLECTOR_H
+#define KPI_COLLECTOR_H
+
+/**
+ * @file KpiCollector.h
+ * @brief Indicateurs de trajets relevés à la fin de chaque tick
+ *
+ * Les véhicules sont triés par identifiant (jamais réutilisé) : une
+ * arrivée est un identifiant qui disparaît de la liste, le temps de
+ * parcours est mesuré depuis son apparition (ou le début du relevé).
+ */
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+class Simulation;
+
+/**
+ * @struct TripIndicators
+ * @brief Indicateurs agrégés sur la durée du relevé
+ */
+struct TripIndicators {
+    int completedTrips;              // Véhicules arrivés à destination
+    float meanTravelTime;            // Temps de parcours moyen des trajets terminés (s)
+    float maxTravelTime;
+    float throughput;                // Trajets terminés par minute simulée
+    float meanActiveVehicles;        // Véhicules en circulation, moyenne sur les ticks
+    float congestedShare;            // Part des routes hors état normal, moyenne sur les ticks
+};
+
+/**
+ * @class KpiCollector
+ * @brief Relevé incrémental, à brancher sur Simulation::addTickObserver
+ */
+class KpiCollector {
+public:
+    KpiCollector();
+
+    // Début du relevé : les véhicules présents partent de l'instant courant
+    void start(const Simulation& simulation);
+    void observe(const Simulation& simulation);
+
+    /**
+     * @param simulatedTime Durée couverte par le relevé (s), pour le débit
+     */
+    TripIndicators getIndicators(float simulatedTime) const;
+
+private:
+    std::vector<std::pair<int, float>> active;   // (identifiant, instant d'apparition)
+    std::vector<std::pair<int, float>> next;
+    int completed;
+    double travelSum;
+    float travelMax;
+    double activeSum;
+    double congestedSum;
+    size_t ticks;
+
+    void arrive(float travelTime);
+};
+
+#endif // KPI_COLLECTOR_H
@@ -0,0 +1,180 @@
+#ifndef METRICS_EXPORTER_H
+#define METRICS_EXPORTER_H
+
+/**
+ * @file MetricsExporter.h
+ * @brief Export de séries temporelles (routes et indicateurs) pour l'analyse
+ *
+ * À intervalle de temps simulé régulier, l'exportateur relève la vitesse,
+ * l'occupation et l'état de chaque route ainsi que les indicateurs globaux
+ * du tick (véhicules, trajets terminés, reroutages, congestion). Les
+ * échantillons sont rangés par colonnes dans des blocs préalloués qui
+ * tournent en anneau entre le thread de simulation et un thread
+ * d'écriture, seul à toucher au fichier. La simulation n'attend jamais :
+ * si l'écriture a pris tout l'anneau de retard, l'échantillon est
+ * abandonné et compté (getDroppedSamples).
+ *
+ * Formats :
+ * - CSV : une ligne par échantillon, trois colonnes par route ;
+ * - COLUMNAR : binaire, chaque bloc stocke ses colonnes l'une après l'autre ;
+ * - COLUMNAR_COMPRESSED : idem, colonnes codées par écart à la valeur
+ *   précédente (entiers), OU exclusif avec la précédente (flottants) et
+ *   plages de valeurs identiques (états) ; une route stable coûte un octet
+ *   par colonne et par échantillon.
+ *
+ * Format binaire : en-tête (METRICS_MAGIC, version, compression, empreinte
+ * du réseau, identifiants des routes), blocs (MetricsTag::CHUNK), puis
+ * MetricsTag::END et le nombre d'échantillons abandonnés. MetricsExporter::load
+ * le relit.
+ */
+
+#include "SpscQueue.h"
+#include <atomic>
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+class Simulation;
+class BinaryWriter;
+
+/**
+ * @enum MetricsFormat
+ * @brief Format du fichier de métriques
+ */
+enum class MetricsFormat {
+    CSV,
+    COLUMNAR,
+    COLUMNAR_COMPRESSED
+};
+
+/**
+ * @enum MetricsTag
+ * @brief Type d'un enregistrement du format binaire
+ */
+enum class MetricsTag : uint8_t {
+    END = 0,      ///< Fin du fichier : nombre d'échantillons abandonnés
+    CHUNK = 1     ///< Bloc : nombre d'échantillons puis colonnes
+};
+
+/**
+ * @struct MetricsTable
+ * @brief Contenu d'un fichier binaire de métriques, par colonnes
+ */
+struct MetricsTable {
+    std::vector<int> routeIds;
+    std::vector<float> time;                        // Temps simulé (s)
+    std::vector<uint32_t> vehicles;                 // Véhicules en circulation
+    std::vector<uint32_t> completedTrips;           // Cumul des trajets terminés
+    std::vector<uint32_t> reroutings;               // Cumul des reroutages
+    std::vector<float> meanTravelTime;              // Temps de parcours moyen (s)
+    std::vector<uint32_t> congestedRoutes;          // Routes hors état normal
+    std::vector<uint32_t> activeEvents;
+    std::vector<std::vector<float>> routeSpeed;     // [route][échantillon] (km/h)
+    std::vector<std::vector<uint32_t>> routeOccupancy;
+    std::vector<std::vector<uint8_t>> routeState;   // RouteState
+    uint64_t droppedSamples;
+
+    size_t getSampleCount() const { return time.size(); }
+};
+
+/**
+ * @class MetricsExporter
+ * @brief Échantillonne la simulation à la fin des ticks et écrit en arrière-plan
+ */
+class MetricsExporter {
+public:
+    static constexpr char METRICS_MAGIC[4] = {'T', 'S', 'M', 'X'};
+    static constexpr uint32_t METRICS_VERSION = 1;
+    static constexpr size_t CHUNK_ROWS = 64;        // Échantillons par bloc
+    static constexpr size_t CHUNK_COUNT = 16;       // Blocs de l'anneau
+
+    MetricsExporter();
+    ~MetricsExporter();
+
+    MetricsExporter(const MetricsExporter&) = delete;
+    MetricsExporter& operator=(const MetricsExporter&) = delete;
+
+    // Temps simulé entre deux échantillons (0 = chaque tick) ; à régler avant start
+    void setSampleInterval(float seconds) { sampleInterval = seconds > 0.0f ? seconds : 0.0f; }
+    float getSampleInterval() const { return sampleInterval; }
+
+    /**
+     * @brief Ouvre le fichier, prépare l'anneau et s'abonne aux ticks de la simulation
+     * @return Faux si le fichier ne peut pas être créé (ou si un export est en cours)
+     *
+     * À appeler quand la simulation n'est pas mise à jour par un autre
+     * thread (avant SimulationRunner::start). Le premier échantillon est
+     * l'état courant.
+     */
+    bool start(const std::string& path, Simulation& simulation, MetricsFormat format);
+
+    /**
+     * @brief Écrit les derniers échantillons et ferme le fichier
+     * @return Faux si une écriture a échoué
+     *
+     * Même contrainte que start (après SimulationRunner::stop).
+     */
+    bool stop();
+
+    bool isExporting() const { return simulation != nullptr; }
+    uint64_t getSampleCount() const { return sampleCount; }
+    uint64_t getDroppedSamples() const { return droppedSamples; }
+
+    /**
+     * @brief Relève un échantillon si l'intervalle est écoulé (appelé à la fin de chaque tick)
+     */
+    void sample(const Simulation& simulation);
+
+    /**
+     * @brief Relit un fichier écrit au format COLUMNAR ou COLUMNAR_COMPRESSED
+     * @return Faux si le fichier est illisible, d'une autre version ou tronqué
+     */
+    static bool load(const std::string& path, MetricsTable& table);
+
+private:
+    // Un bloc de CHUNK_ROWS échantillons ; colonnes des routes à la suite (route * CHUNK_ROWS + ligne)
+    struct Chunk {
+        size_t rows;
+        std::vector<float> time;
+        std::vector<uint32_t> vehicles;
+        std::vector<uint32_t> completedTrips;
+        std::vector<uint32_t> reroutings;
+        std::vector<float> meanTravelTime;
+        std::vector<uint32_t> congestedRoutes;
+        std::vector<uint32_t> activeEvents;
+        std::vector<float> routeSpeed;
+        std::vector<uint32_t> routeOccupancy;
+        std::vector<uint8_t> routeState;
+    };
+
+    Simulation* simulation;
+    int observerId;
+    MetricsFormat format;
+    float sampleInterval;
+    float nextSampleTime;
+    uint64_t sampleCount;
+    uint64_t droppedSamples;
+    std::vector<int> routeIds;
+    uint64_t fingerprint;
+
+    // Anneau : blocs libres vers la simulation, blocs pleins vers le thread d'écriture
+    std::vector<std::unique_ptr<Chunk>> chunks;
+    Chunk* current;
+    SpscQueue<Chunk*, CHUNK_COUNT> recycled;
+    SpscQueue<Chunk*, CHUNK_COUNT> filled;
+
+    std::ofstream file;
+    std::thread writer;
+    std::atomic<bool> finishing;
+    std::atomic<bool> writeFailed;
+
+    void writerLoop();
+    void writeHeader();
+    void writeChunk(const Chunk& chunk, BinaryWriter& out);
+    void writeChunkCsv(const Chunk& chunk);
+};
+
+#endif // METRICS_EXPORTER_H
@@ -11,8 +11,13 @@
 
 #include "Graph.h"
 #include "PathfindingStrategy.h"
+#include <atomic>
+#include <cstdint>
 #include <vector>
 #include <memory>
+#include <utility>
+
+class TaskScheduler;
 
 /**
  * @class PathPlanner
@@ -26,6 +31,17 @@ private:
     const Graph* graph;
     std::unique_ptr<PathfindingStrategy> strategy;  // Strategy Pattern
     
+    // Compteurs de toutes les recherches, ajoutés sans verrou (recherches parallèles)
+    struct SearchTotals {
+        std::atomic<uint64_t> searches{0};
+        std::atomic<uint64_t> nodesSettled{0};
+        std::atomic<uint64_t> edgesRelaxed{0};
+        std::atomic<uint64_t> heapPushes{0};
+        std::atomic<uint64_t> heapPops{0};
+        std::atomic<uint64_t> time{0};
+    };
+    mutable SearchTotals totals;
+    
 public:
     /**
      * @brief Constructeur avec stratégie par défaut (A*)
@@ -46,6 +62,11 @@ public:
      */
     void setStrategy(std::unique_ptr<PathfindingStrategy> strategy);
     
+    /**
+     * @brief Stratégie utilisée (nullptr si aucune)
+     */
+    const PathfindingStrategy* getStrategy() const { return strategy.get(); }
+    
     /**
      * @brief Planification du chemin optimal tenant compte du trafic
      * @param start Nœud de départ
@@ -63,6 +84,29 @@ public:
      * @return Nouveau chemin recalculé
      */
     std::vector<int> replanPath(int start, int end, const std::vector<int>& currentPath, int currentPosition) const;
+    
+    /**
+     * @brief Planification d'un lot de trajets indépendants
+     * 
+     * Les recherches ne font que lire le graphe : elles sont réparties sur
+     * l'ordonnanceur si fourni. Le résultat ne dépend pas du nombre de threads.
+     * @param requests Paires (départ, destination)
+     * @param scheduler Ordonnanceur à utiliser (nullptr = séquentiel)
+     * @return Un chemin par requête, dans le même ordre (vide si aucun chemin)
+     */
+    std::vector<std::vector<int>> planPaths(const std::vector<std::pair<int, int>>& requests,
+                                            TaskScheduler* scheduler) const;
+    
+    /**
+     * @brief Compteurs cumulés des recherches depuis la création ou resetSearchStats
+     * 
+     * Lus pendant des recherches parallèles, les compteurs peuvent
+     * appartenir à des recherches différentes (un instantané exact
+     * suppose qu'aucune recherche ne soit en cours).
+     */
+    SearchStats getSearchStats() const;
+    
+    void resetSearchStats();
 };
 
 #endif // PATHPLANNER_H
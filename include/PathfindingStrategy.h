@@ -10,8 +10,36 @@
  */
 
 #include "Graph.h"
+#include <cstdint>
+#include <memory>
 #include <vector>
 
+/**
+ * @struct SearchStats
+ * @brief Compteurs d'une ou plusieurs recherches de chemin
+ *
+ * Un nœud est fixé quand il sort du tas pour la première fois ; les
+ * sorties suivantes (entrées périmées) ne comptent que dans heapPops. Une
+ * arête est relâchée quand elle améliore le coût de son extrémité.
+ */
+struct SearchStats {
+    uint64_t searches = 0;
+    uint64_t nodesSettled = 0;
+    uint64_t edgesRelaxed = 0;
+    uint64_t heapPushes = 0;
+    uint64_t heapPops = 0;
+    uint64_t time = 0;          // ns (temps réel, somme des recherches)
+    
+    void add(const SearchStats& other) {
+        searches += other.searches;
+        nodesSettled += other.nodesSettled;
+        edgesRelaxed += other.edgesRelaxed;
+        heapPushes += other.heapPushes;
+        heapPops += other.heapPops;
+        time += other.time;
+    }
+};
+
 /**
  * @class PathfindingStrategy
  * @brief Interface pour les stratégies de pathfinding
@@ -28,9 +56,16 @@ public:
      * @param graph Graphe du réseau routier
      * @param start Nœud de départ
      * @param end Nœud de destination
+     * @param stats Compteurs auxquels ajouter ceux de la recherche (nullptr = aucun)
      * @return Vecteur d'IDs de nœuds représentant le chemin
      */
-    virtual std::vector<int> findPath(const Graph& graph, int start, int end) const = 0;
+    virtual std::vector<int> findPath(const Graph& graph, int start, int end,
+                                      SearchStats* stats = nullptr) const = 0;
+    
+    /**
+     * @brief Copie de la stratégie (simulation dupliquée par Simulation::fork)
+     */
+    virtual std::unique_ptr<PathfindingStrategy> clone() const = 0;
 };
 
 /**
@@ -56,7 +91,10 @@ public:
     /**
      * @brief Calcule un chemin optimal avec A*
      */
-    std::vector<int> findPath(const Graph& graph, int start, int end) const override;
+    std::vector<int> findPath(const Graph& graph, int start, int end,
+                              SearchStats* stats = nullptr) const override;
+    
+    std::unique_ptr<PathfindingStrategy> clone() const override { return std::make_unique<AStarStrategy>(*this); }
 };
 
 /**
@@ -71,7 +109,10 @@ public:
     /**
      * @brief Calcule un chemin avec Dijkstra
      */
-    std::vector<int> findPath(const Graph& graph, int start, int end) const override;
+    std::vector<int> findPath(const Graph& graph, int start, int end,
+                              SearchStats* stats = nullptr) const override;
+    
+    std::unique_ptr<PathfindingStrategy> clone() const override { return std::make_unique<DijkstraStrategy>(*this); }
 };
 
 #endif // PATHFINDING_STRATEGY_H
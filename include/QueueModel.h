@@ -0,0 +1,130 @@
+#ifndef QUEUE_MODEL_H
+#define QUEUE_MODEL_H
+
+/**
+ * @file QueueModel.h
+ * @brief Modèle de trafic mésoscopique à files d'attente
+ *
+ * Chaque route est une file FIFO de véhicules. Un véhicule qui entre sur
+ * une route ne peut en sortir qu'après le temps de parcours à la vitesse
+ * courante de la route, et seulement lorsqu'il est en tête de file. Les
+ * sorties sont limitées par :
+ * - le débit de la route (véhicules par seconde, crédit accumulé à chaque tick)
+ * - la place disponible sur la route suivante (remontée de file / spillback)
+ *
+ * Seules les têtes de file sont examinées à chaque tick : le coût dépend du
+ * nombre de routes et de mouvements, pas du nombre de véhicules.
+ */
+
+#include "Graph.h"
+#include "TrafficDynamics.h"
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @class QueueModel
+ * @brief Files d'attente par route et avancement des véhicules en tête de file
+ *
+ * Les files contiennent des identifiants compacts (emplacements dans une
+ * table de véhicules) plutôt que des pointeurs. Le modèle fait avancer les
+ * véhicules (Vehicle::advanceToNextRoute) ; la mise à jour de l'occupation
+ * des routes et de l'index de la simulation reste à la charge de l'appelant,
+ * à partir de la liste des mouvements renvoyée par step.
+ */
+class QueueModel : public TrafficDynamics {
+public:
+    explicit QueueModel(const Graph* graph);
+
+    /**
+     * @brief Vide toutes les files et les redimensionne selon le graphe
+     */
+    void reset() override;
+
+    /**
+     * @brief Place un véhicule en queue de la file de sa route actuelle
+     * @param vehicle Véhicule (chemin déjà résolu)
+     * @param remainingFraction Part du temps de parcours restant à effectuer (1 = entrée sur la route)
+     *
+     * L'entrée est toujours acceptée (apparition, reroutage) : seuls les
+     * transferts entre routes sont soumis à la place disponible.
+     */
+    void enter(Vehicle* vehicle, float remainingFraction = 1.0f) override;
+
+    /**
+     * @brief Retire un véhicule de sa file (à appeler avant de changer son chemin)
+     */
+    void remove(Vehicle* vehicle) override;
+
+    /**
+     * @brief Avance l'horloge du modèle et fait sortir les têtes de file prêtes
+     *
+     * Séquentiel (routes dans l'ordre des index) : seules les têtes de file
+     * sont examinées, le travail est proportionnel au nombre de mouvements.
+     */
+    void step(float deltaTime, std::vector<VehicleMove>& moves,
+              std::vector<Vehicle*>& blocked, TaskScheduler* scheduler = nullptr) override;
+
+    /**
+     * @brief Recalcule la progression et la position de rendu de tous les véhicules en file
+     *
+     * Les véhicules sont répartis entre le temps écoulé sur la route et leur
+     * rang dans la file. Parallélisé par route si scheduler est non nul.
+     */
+    void refreshPositions(TaskScheduler* scheduler) override;
+
+    /**
+     * @brief Horloge, puis pour chaque route : crédit de débit et file (identifiant, entrée, sortie possible)
+     */
+    void saveState(BinaryWriter& out) const override;
+    bool loadState(BinaryReader& in, const std::function<Vehicle*(int)>& findVehicle) override;
+
+    size_t getVehicleCount() const override { return slotByVehicle.size(); }
+    bool canEnter(int routeIndex) const override { return queues[routeIndex].count < storageCapacity(*graph->getRoutes()[routeIndex]); }
+
+    size_t getQueueLength(int routeIndex) const { return queues[routeIndex].count; }
+
+    /**
+     * @brief Véhicules d'une file, de la tête à la queue
+     */
+    void getRouteVehicles(int routeIndex, std::vector<Vehicle*>& out) const;
+    float getClock() const { return clock; }
+
+private:
+    // Véhicule en file : identifiant compact = index dans slots
+    struct Slot {
+        Vehicle* vehicle;
+        int routeIndex;
+        float enterTime;        // Début du parcours de la route
+        float readyTime;        // Sortie possible à partir de cet instant
+    };
+
+    // File circulaire d'identifiants compacts (capacité doublée si pleine)
+    struct RouteQueue {
+        std::vector<uint32_t> ring;
+        size_t head = 0;
+        size_t count = 0;
+        float flowCredit = 0.0f;    // Sorties autorisées accumulées
+
+        void push(uint32_t slot);
+        uint32_t front() const { return ring[head]; }
+        void pop();
+        uint32_t at(size_t rank) const { return ring[(head + rank) % ring.size()]; }
+        bool erase(uint32_t slot);
+    };
+
+    const Graph* graph;
+    float clock;
+    std::vector<RouteQueue> queues;
+    std::vector<float> flowCapacity;            // Débit de sortie par route (véhicules/s)
+    std::vector<Slot> slots;
+    std::vector<uint32_t> freeSlots;
+    std::unordered_map<const Vehicle*, uint32_t> slotByVehicle;
+
+    uint32_t allocateSlot(Vehicle* vehicle);
+    void releaseSlot(uint32_t slot);
+    float travelTime(int routeIndex) const;
+    void push(uint32_t slot, int routeIndex, float remainingFraction);
+};
+
+#endif // QUEUE_MODEL_H
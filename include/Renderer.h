@@ -1,9 +1,14 @@
 #ifndef RENDERER_H
 #define RENDERER_H
 
-#include "Simulation.h"
+#include "SimulationRunner.h"
+#include "FrameProfiler.h"
 #include "raylib.h"
+#include <memory>
 #include <unordered_map>
+#include <vector>
+
+class RoadNetwork;
 
 // Classe de rendu utilisant Raylib
 class Renderer {
@@ -11,6 +16,7 @@ private:
     int screenWidth;
     int screenHeight;
     Camera2D camera;
+    static constexpr float MIN_ZOOM = 0.001f;   // Vue d'ensemble d'une grille d'un million de nœuds
     
     // Couleurs
     Color routeNormalColor;
@@ -70,6 +76,15 @@ private:
     Music backgroundMusic;
     bool musicLoaded;
     
+    // Centres des îlots (maisons), recalculés quand la topologie change
+    std::vector<Vector2> blockCenters;
+    std::shared_ptr<const RoadNetwork> blockTopology;
+    const std::vector<Vector2>& getBlockCenters(const Graph& graph);
+    
+    // Profileur : mesuré à chaque image, affiché à la demande
+    FrameProfiler profiler;
+    bool profilerVisible;
+    
 public:
     Renderer(int width = 1280, int height = 720);
     ~Renderer();
@@ -81,14 +96,21 @@ public:
     // Rendu
     void beginFrame();
     void endFrame();
-    void renderSimulation(const Simulation& simulation);
-    void renderGraph(const Graph& graph);
-    void renderVehicles(const std::vector<std::unique_ptr<Vehicle>>& vehicles);
-    void renderEvents(const std::vector<std::unique_ptr<Event>>& events, const Graph& graph);
-    void renderUI(const Simulation& simulation);
-    
-    // Gestion des boutons
-    void handleButtonClicks(Simulation& simulation);
+    // Rendu d'un instantané publié par le thread de simulation (le graphe ne sert qu'à la géométrie)
+    void renderSimulation(const FrameSnapshot& frame, const Graph& graph);
+    void renderGraph(const Graph& graph, const std::vector<RouteState>& routeStates);
+    // alpha : facteur d'interpolation entre le tick précédent (0) et le dernier (1)
+    void renderVehicles(const std::vector<VehicleSnapshot>& vehicles, float alpha = 1.0f);
+    void renderEvents(const std::vector<EventSnapshot>& events, const Graph& graph);
+    void renderUI(const FrameSnapshot& frame);
+    // Temps par phase des dernières images et compteurs par image (à côté du panneau de renderUI)
+    void renderProfiler();
+    void toggleProfiler() { profilerVisible = !profilerVisible; }
+    bool isProfilerVisible() const { return profilerVisible; }
+    const FrameProfiler& getProfiler() const { return profiler; }
+    
+    // Gestion des boutons (actions transmises au thread de simulation)
+    void handleButtonClicks(SimulationRunner& runner, const FrameSnapshot& frame);
     
     // Gestion de la musique
     void loadMusic();
@@ -104,6 +126,7 @@ public:
     // Utilitaires
     Vector2 worldToScreen(float x, float y) const;
     Vector2 screenToWorld(int x, int y) const;
+    void getVisibleArea(float& minX, float& minY, float& maxX, float& maxY) const;
     
     // Notifications
     void addNotification(const std::string& text, Color color, float duration = 3.0f);
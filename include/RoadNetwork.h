@@ -0,0 +1,108 @@
+#ifndef ROAD_NETWORK_H
+#define ROAD_NETWORK_H
+
+/**
+ * @file RoadNetwork.h
+ * @brief Topologie immuable du réseau routier
+ *
+ * Nœuds, attributs fixes des routes (extrémités, longueur, vitesse de base,
+ * capacité) et index de recherche. Une fois construite, la topologie n'est
+ * plus modifiée : elle peut être partagée (std::shared_ptr<const RoadNetwork>)
+ * entre plusieurs graphes, chacun ne portant que l'état dynamique de ses
+ * routes (vitesse, occupation, état).
+ */
+
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @struct Node
+ * @brief Représente un nœud (intersection) dans le graphe
+ */
+struct Node {
+    int id;        ///< Identifiant unique du nœud
+    float x, y;    ///< Position pour la visualisation
+
+    /**
+     * @brief Constructeur du nœud
+     * @param id Identifiant unique
+     * @param x Coordonnée X
+     * @param y Coordonnée Y
+     */
+    Node(int id, float x, float y) : id(id), x(x), y(y) {}
+};
+
+/**
+ * @struct RouteAttributes
+ * @brief Attributs fixes d'une route, partagés par tous les graphes d'une même topologie
+ */
+struct RouteAttributes {
+    int id;
+    int fromNode;
+    int toNode;
+    float length;           // Longueur de la route
+    float baseSpeed;        // Vitesse de base (km/h)
+    int capacity;           // Capacité maximale de véhicules
+};
+
+/**
+ * @class RoadNetwork
+ * @brief Nœuds, routes et listes d'adjacence du réseau
+ *
+ * Construit par Graph (addNode/addRoute) ; les adresses des nœuds et des
+ * attributs de routes restent stables quand le réseau grandit.
+ */
+class RoadNetwork {
+private:
+    std::vector<std::unique_ptr<Node>> nodes;
+    std::deque<RouteAttributes> routes;                      // Adresses stables, référencées par les Route
+    std::unordered_map<int, std::vector<int>> adjacencyList; // nodeId -> vector of route indices
+    // Tant que les identifiants valent leur index (0, 1, 2...), ces index restent vides
+    std::unordered_map<int, int> routeIndexById;             // routeId -> index dans routes
+    std::unordered_map<int, int> nodeIndexById;              // nodeId -> index dans nodes
+    bool denseRouteIds = true;
+    bool denseNodeIds = true;
+    // Empreintes FNV-1a des nœuds et des routes, complétées à chaque ajout
+    uint64_t nodeHash = 1469598103934665603ULL;
+    uint64_t routeHash = 1469598103934665603ULL;
+
+public:
+    RoadNetwork() = default;
+
+    // Copie profonde (un graphe qui modifie une topologie partagée en fait sa propre copie)
+    RoadNetwork(const RoadNetwork& other);
+    RoadNetwork& operator=(const RoadNetwork&) = delete;
+
+    // Prépare la place pour nodeCount nœuds et routeCount routes (construction de grands réseaux)
+    void reserve(size_t nodeCount, size_t routeCount);
+
+    void addNode(int id, float x, float y);
+    void addRoute(int id, int fromNode, int toNode, float length, float speed, int capacity);
+
+    const Node* getNode(int id) const;
+    const std::vector<std::unique_ptr<Node>>& getNodes() const { return nodes; }
+    size_t getRouteCount() const { return routes.size(); }
+    const RouteAttributes& getRoute(size_t index) const { return routes[index]; }
+
+    int getRouteIndex(int routeId) const;
+    int findRouteIndex(int fromNode, int toNode) const;
+    std::vector<int> getNeighbors(int nodeId) const;
+
+    /**
+     * @brief Index des routes incidentes à un nœud (vide si le nœud est isolé ou inconnu)
+     */
+    const std::vector<int>& getRoutesFromNode(int nodeId) const;
+
+    /**
+     * @brief Empreinte de la topologie et de la géométrie (identifiants et positions des
+     *        nœuds ; extrémités, longueurs, vitesses de base et capacités des routes)
+     *
+     * Tenue à jour pendant la construction : la lire ne coûte rien.
+     */
+    uint64_t getFingerprint() const;
+};
+
+#endif // ROAD_NETWORK_H
@@ -1,3 +1,6 @@
+#ifndef ROUTE_H
+#define ROUTE_H
+
 /**
  * @file Route.h
  * @brief Représentation d'une route dans le réseau routier
@@ -6,9 +9,7 @@
  * Elle gère le trafic, les états de la route et calcule les temps de parcours.
  */
 
-#ifndef ROUTE_H
-#define ROUTE_H
-
+#include "RoadNetwork.h"
 #include <string>
 #include <vector>
 #include <memory>
@@ -29,33 +30,47 @@ enum class RouteState {
  * @brief Classe représentant une route/arête dans le graphe
  * 
  * Modélise une route entre deux nœuds avec gestion du trafic,
- * des états et calcul des temps de parcours dynamiques.
+ * des états et calcul des temps de parcours dynamiques. Seul l'état
+ * dynamique est porté par la route ; ses attributs fixes sont lus dans la
+ * topologie (RouteAttributes), partagée entre les graphes qui l'utilisent.
  */
 class Route {
 private:
-    int id;
-    int fromNode;
-    int toNode;
-    float length;           // Longueur de la route
-    float baseSpeed;        // Vitesse de base (km/h)
+    const RouteAttributes* attributes;                // Attributs fixes (topologie)
+    std::unique_ptr<RouteAttributes> ownAttributes;   // Route isolée, hors de toute topologie
     float currentSpeed;     // Vitesse actuelle (prend en compte le trafic)
     int vehicleCount;       // Nombre de véhicules actuellement sur la route
-    int capacity;           // Capacité maximale de véhicules
+    int inducedLoad;        // Charge supplémentaire imposée par les événements (setCongestion)
     RouteState state;       // État de la route
     
+    // Flux de changements d'état (voir Graph::consumeRouteChanges)
+    unsigned int version;             // Incrémenté à chaque changement d'état ou de charge
+    std::vector<int>* changeLog;      // Liste de changements du graphe propriétaire (peut être nul)
+    int changeLogIndex;               // Index de la route dans ce graphe
+    bool changePending;               // Déjà présente dans changeLog pour ce lot
+    
+    void notifyChange();
+    
 public:
+    // Route isolée, propriétaire de ses attributs
     Route(int id, int from, int to, float len, float speed, int cap);
     
+    // Route d'une topologie : attributes doit survivre à la route
+    explicit Route(const RouteAttributes& attributes);
+    
     // Getters
-    int getId() const { return id; }
-    int getFromNode() const { return fromNode; }
-    int getToNode() const { return toNode; }
-    float getLength() const { return length; }
-    float getBaseSpeed() const { return baseSpeed; }
+    int getId() const { return attributes->id; }
+    int getFromNode() const { return attributes->fromNode; }
+    int getToNode() const { return attributes->toNode; }
+    float getLength() const { return attributes->length; }
+    float getBaseSpeed() const { return attributes->baseSpeed; }
     float getCurrentSpeed() const { return currentSpeed; }
     int getVehicleCount() const { return vehicleCount; }
-    int getCapacity() const { return capacity; }
+    int getInducedLoad() const { return inducedLoad; }
+    int getCapacity() const { return attributes->capacity; }
+    const RouteAttributes& getAttributes() const { return *attributes; }
     RouteState getState() const { return state; }
+    unsigned int getVersion() const { return version; }
     
     // Calcul du temps de parcours
     float getTravelTime() const;
@@ -65,12 +80,38 @@ public:
     void removeVehicle();
     void updateSpeed();
     
+    /**
+     * @brief Applique un solde d'entrées/sorties de véhicules sans recalculer la vitesse
+     * 
+     * Utilisé par Graph::updateTraffic qui regroupe les mouvements d'un tick
+     * et n'appelle updateSpeed qu'une fois par route modifiée.
+     */
+    void applyVehicleDelta(int delta);
+    
     // Gestion des événements
     void setState(RouteState newState);
     void setCongestion(float congestionLevel); // 0.0 à 1.0
     
     // Vérification si la route est utilisable
     bool isUsable() const;
+    
+    /**
+     * @brief Rattache la route à des attributs identiques d'une autre copie de la topologie
+     */
+    void rebindAttributes(const RouteAttributes& copy) { attributes = &copy; }
+    
+    // Branchement sur le flux de changements d'un graphe
+    void attachChangeLog(std::vector<int>* log, int index);
+    void clearChangePending() { changePending = false; }
+    void markChangePending() { changePending = true; }
+    
+    /**
+     * @brief Restaure l'état dynamique tel quel (point de reprise)
+     * 
+     * Ni recalcul de vitesse ni notification : la vitesse sauvegardée peut
+     * différer de celle que donnerait updateSpeed (soldes en attente).
+     */
+    void restoreState(RouteState savedState, int savedVehicleCount, int savedInducedLoad, float savedSpeed);
 };
 
 #endif // ROUTE_H
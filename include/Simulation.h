@@ -1,3 +1,6 @@
+#ifndef SIMULATION_H
+#define SIMULATION_H
+
 /**
  * @file Simulation.h
  * @brief Classe principale de gestion de la simulation de routage dynamique
@@ -6,17 +9,27 @@
  * planification de trajets et reroutage dynamique.
  */
 
-#ifndef SIMULATION_H
-#define SIMULATION_H
-
 #include "Graph.h"
 #include "Vehicle.h"
 #include "PathPlanner.h"
 #include "Event.h"
+#include "TaskScheduler.h"
+#include "GraphPartition.h"
+#include "QueueModel.h"
+#include "CarFollowingModel.h"
+#include "HybridModel.h"
+#include "BinaryIO.h"
+#include "StatisticsEngine.h"
+#include "FrameSnapshot.h"
+#include <cstdint>
+#include <functional>
 #include <vector>
 #include <memory>
 #include <random>
 
+struct FrameSnapshot;
+struct SimulationConfig;
+
 /**
  * @enum SimulationMode
  * @brief Mode de fonctionnement de la simulation
@@ -26,6 +39,17 @@ enum class SimulationMode {
     DYNAMIC         ///< Mode dynamique avec reroutage automatique
 };
 
+/**
+ * @enum TrafficModel
+ * @brief Modèle de déplacement des véhicules
+ */
+enum class TrafficModel {
+    CONTINUOUS,     ///< Progression continue à la vitesse de la route, sans interaction
+    MESOSCOPIC,     ///< Files d'attente par route (débit limité, remontée de file)
+    MICROSCOPIC,    ///< Poursuite IDM sur des voies triées par position
+    HYBRID          ///< Microscopique dans la zone de focus, mésoscopique ailleurs
+};
+
 /**
  * @class Simulation
  * @brief Classe principale de gestion de la simulation
@@ -41,43 +65,194 @@ private:
     std::vector<std::unique_ptr<Vehicle>> vehicles;
     std::vector<std::unique_ptr<Event>> events;
     
+    // Index inverse : route (index dans le graphe) -> véhicules qui prévoient de l'emprunter,
+    // avec l'arête correspondante de leur chemin (le véhicule y garde son rang dans la liste)
+    struct RouteUser {
+        Vehicle* vehicle;
+        uint32_t edge;
+    };
+    std::vector<std::vector<RouteUser>> routeVehicles;
+    
+    // Mise à jour parallèle des véhicules : résultat de la phase 1 par véhicule
+    struct VehicleStep {
+        bool valid;              // Mise à jour effectuée sans erreur
+        int edgeBefore;          // Arête du chemin avant la mise à jour
+        int edgeAfter;           // Arête du chemin après la mise à jour
+        bool replanned;          // Un nouveau chemin a été calculé
+        std::vector<int> newPath;
+    };
+    static constexpr size_t VEHICLE_GRAIN = 256;  // Véhicules par bloc de travail
+    std::unique_ptr<TaskScheduler> scheduler;
+    std::vector<VehicleStep> vehicleSteps;
+    
+    // Décomposition de domaine : une tâche par région, propriétaire de ses routes
+    // et des véhicules qui y circulent (désactivée si regionCount <= 1)
+    struct Handoff {
+        Vehicle* vehicle;
+        int routeIndex;          // Route d'entrée dans la région destination (-1 si aucune)
+    };
+    struct alignas(64) RegionState {
+        std::vector<Vehicle*> vehicles;                       // Véhicules sur les routes de la région
+        std::vector<std::pair<int, int>> occupancyDeltas;     // (route, solde) locaux au tick
+        std::vector<std::pair<Vehicle*, std::vector<int>>> reroutes;
+    };
+    int regionCount;
+    std::unique_ptr<GraphPartition> partition;
+    std::vector<RegionState> regions;
+    RegionMailboxes<Handoff> handoffs;
+    
+    // Modèle de trafic (dynamique nulle en mode continu : Vehicle::update)
+    TrafficModel trafficModel;
+    std::unique_ptr<TrafficDynamics> dynamics;
+    std::vector<VehicleMove> vehicleMoves;
+    std::vector<Vehicle*> rerouteCandidates;   // Véhicules en attente de reroutage (hors mode continu)
+    bool hasFocusArea;
+    float focusArea[4];                        // Zone microscopique du modèle hybride (minX, minY, maxX, maxY)
+    mutable bool positionsStale;               // Position de rendu en retard sur le modèle de trafic
+    
     SimulationMode mode;
     float simulationTime;
     float timeScale;        // Facteur d'accélération du temps
     bool isPaused;          // État pause/play
     
+    // Avance rapide : pas fixes enchaînés dans la limite d'un budget de temps réel par image
+    bool fastForward;
+    float fixedTimeStep;        // Durée simulée d'un tick de advance (s)
+    float pendingTime;          // Temps simulé restant à couvrir (moins d'un pas fixe)
+    float frameBudget;          // Temps réel maximal consacré aux pas d'une image (s)
+    float effectiveTimeScale;   // Facteur réellement atteint, mesuré sur une fenêtre de temps réel
+    float measuredRealTime;
+    float measuredSimulatedTime;
+    
     // Paramètres configurables
     int vehicleCount;
     int eventCount;
     bool reroutingEnabled;
+    bool verbose;               // Messages d'information sur la console
     
     // Gestion des événements
     std::mt19937 rng;
     float nextEventTime;
     float eventInterval;
+    std::vector<EventType> eventTypes;  // Types tirés pour les événements aléatoires
     
     // Statistiques
     int totalReroutings;
     float averageTravelTime;
+    StatisticsEngine statistics;    // Un accumulateur par thread de l'ordonnanceur
+    SimulationProfile profile;      // Temps des phases du tick (toujours mesurés)
+    
+    // Identifiant du prochain véhicule créé (jamais réutilisé : suivi des véhicules par identifiant)
+    int nextVehicleId;
+    
+    // Phases d'un tick sous forme de graphe de dépendances (construit au premier update)
+    TaskGraph tickGraph;
+    float tickDelta;
+    
+    // Apparition de véhicules : paires tirées puis trajets planifiés en parallèle
+    std::vector<int> connectedNodes;
+    std::vector<std::pair<int, int>> spawnRequests;
+    std::vector<std::vector<int>> spawnPaths;
+    
+    // Sauvegarde en arrière-plan : processus fils en cours (0 si aucun)
+    long checkpointProcess;
+    bool checkpointSaved;       // Résultat de la dernière sauvegarde synchrone de repli
+    
+    // Observateurs appelés à la fin de chaque tick (enregistrement, analyse)
+    std::vector<std::pair<int, std::function<void(const Simulation&)>>> tickObservers;
+    int nextObserverId;
     
 public:
-    Simulation();
+    // Ordonnanceur de threadCount threads (0 = nombre de cœurs)
+    explicit Simulation(unsigned int threadCount = 0);
     ~Simulation();
     
     // Initialisation
     void initialize(const std::string& configPath);
+    
+    /**
+     * @brief Initialise la simulation sur une topologie partagée
+     * 
+     * La topologie n'est pas copiée : seul l'état dynamique des routes est
+     * propre à cette simulation. Plusieurs simulations (campagnes, variantes)
+     * peuvent ainsi partager un grand réseau en mémoire.
+     */
+    void initialize(std::shared_ptr<const RoadNetwork> topology);
+    
+    /**
+     * @brief Construit la topologie décrite par une configuration (vide = réseau de test)
+     */
+    static std::shared_ptr<const RoadNetwork> loadTopology(const std::string& configPath);
+    std::shared_ptr<const RoadNetwork> getTopology() const { return graph->getTopology(); }
     void setMode(SimulationMode mode);
+    // Nombre de véhicules : recréés tout de suite si un réseau est chargé, sinon à initialize
     void setVehicleCount(int count);
     void setEventCount(int count);
+    void setEventInterval(float seconds) { eventInterval = std::max(0.1f, seconds); }
+    float getEventInterval() const { return eventInterval; }
+    // Types des événements aléatoires (liste vide : inchangée)
+    void setEventTypes(const std::vector<EventType>& types);
+    const std::vector<EventType>& getEventTypes() const { return eventTypes; }
+    int getVehicleCount() const { return vehicleCount; }
+    int getEventCount() const { return eventCount; }
+    
+    // Algorithme de planification des trajets (A* par défaut)
+    void setPathfindingStrategy(std::unique_ptr<PathfindingStrategy> strategy);
     void setPaused(bool paused) { isPaused = paused; }
     void togglePause() { isPaused = !isPaused; }
     bool getIsPaused() const { return isPaused; }
-    void setTimeScale(float scale) { timeScale = std::max(0.1f, std::min(5.0f, scale)); }
+    void setTimeScale(float scale) { timeScale = std::max(0.1f, std::min(MAX_TIME_SCALE, scale)); }
     float getTimeScale() const { return timeScale; }
     
-    // Mise à jour de la simulation
+    // Avance rapide (facteur MAX_TIME_SCALE ou le plus rapide possible dans le budget par image)
+    void setFastForward(bool enabled) { fastForward = enabled; }
+    void toggleFastForward() { fastForward = !fastForward; }
+    bool isFastForward() const { return fastForward; }
+    void setFrameBudget(float seconds) { frameBudget = std::max(0.001f, seconds); }
+    float getEffectiveTimeScale() const { return effectiveTimeScale; }
+    void setSeed(unsigned int seed) { rng.seed(seed); }
+    // Messages d'information (création des véhicules) ; les campagnes de scénarios les coupent
+    void setVerbose(bool enabled) { verbose = enabled; }
+    
+    // Parallélisme de la mise à jour des véhicules (0 = nombre de cœurs)
+    void setThreadCount(unsigned int count);
+    unsigned int getThreadCount() const;
+    
+    // Découpage du réseau en régions simulées chacune par une tâche (0 ou 1 = sans découpage)
+    void setRegionCount(int count);
+    int getRegionCount() const { return regionCount; }
+    const GraphPartition* getPartition() const { return partition.get(); }
+    
+    // Modèle de trafic (les véhicules en circulation sont conservés au changement)
+    void setTrafficModel(TrafficModel model);
+    TrafficModel getTrafficModel() const { return trafficModel; }
+    const TrafficDynamics* getTrafficDynamics() const { return dynamics.get(); }
+    
+    // Zone simulée en microscopique par le modèle hybride (en général la partie visible)
+    void setFocusArea(float minX, float minY, float maxX, float maxY);
+    
+    // Pas de simulation fixe par défaut de l'avance en temps réel (s)
+    static constexpr float FIXED_TIME_STEP = 0.05f;
+    static constexpr float MAX_TIME_SCALE = 1000.0f;
+    
+    // Fréquence de simulation : le rendu interpole entre les ticks (0.1 s = 10 Hz)
+    void setFixedTimeStep(float seconds) { fixedTimeStep = std::max(0.01f, std::min(1.0f, seconds)); }
+    float getFixedTimeStep() const { return fixedTimeStep; }
+    
+    // Mise à jour de la simulation : un tick de deltaTime secondes simulées
     void update(float deltaTime);
     
+    /**
+     * @brief Fait avancer la simulation de realDeltaTime secondes réelles multipliées par le facteur de temps
+     * @return Nombre de ticks exécutés (0 si le temps accumulé est inférieur à un pas)
+     *
+     * Le temps est couvert par des ticks de durée fixe (setFixedTimeStep) ;
+     * le reste inférieur à un pas est reporté à l'appel suivant. Les ticks
+     * s'arrêtent à épuisement du budget de temps réel (setFrameBudget) : le
+     * retard au-delà du budget est abandonné pour que l'affichage reste fluide.
+     */
+    int advance(float realDeltaTime);
+    
     // Gestion des événements
     void triggerRandomEvent();
     void addEvent(EventType type, int routeId, float severity, float duration);
@@ -92,15 +267,157 @@ public:
     SimulationMode getMode() const { return mode; }
     float getSimulationTime() const { return simulationTime; }
     int getTotalReroutings() const { return totalReroutings; }
+    size_t getRerouteCandidateCount() const { return rerouteCandidates.size(); }
+    float getAverageTravelTime() const { return averageTravelTime; }
+    uint64_t getCompletedTrips() const { return statistics.getTripCount(); }
+    
+    // Temps cumulés des phases du tick et des recherches de chemin
+    SimulationProfile getProfile() const;
+    
+    // Copie de l'état affiché (positions, états des routes, événements) dans un instantané réutilisé
+    void captureSnapshot(FrameSnapshot& frame) const;
+    
+    /**
+     * @brief Recalcule la progression et la position de rendu des véhicules d'un modèle de trafic
+     *
+     * Les modèles ne tiennent que leurs files ou leurs voies à jour ; la position n'est
+     * calculée qu'à la demande (instantané, point de reprise, enregistrement), donc jamais
+     * sans affichage. Sans effet en mode continu ou si rien n'a changé.
+     */
+    void refreshVehiclePositions() const;
+    
+    /**
+     * @brief Appelle observer à la fin de chaque tick hors pause, dans le thread qui exécute update
+     * @return Identifiant à passer à removeTickObserver
+     * 
+     * L'observateur lit l'état complet du tick terminé (véhicules, routes,
+     * événements) ; il ne doit pas modifier la simulation.
+     */
+    int addTickObserver(std::function<void(const Simulation&)> observer);
+    void removeTickObserver(int observerId);
+    
+    /**
+     * @brief Écrit l'état complet de la simulation dans un point de reprise binaire
+     * @return Faux en cas d'erreur d'écriture
+     * 
+     * Contenu : état dynamique des routes (le réseau lui-même n'est représenté
+     * que par une empreinte), véhicules et chemins, événements, état interne
+     * du modèle de trafic, générateur aléatoire, horloges et paramètres.
+     * Format versionné (CHECKPOINT_VERSION) avec somme de contrôle.
+     */
+    bool saveCheckpoint(const std::string& path) const;
+    
+    /**
+     * @brief Sauvegarde depuis un processus fils (fork) : la simulation continue pendant l'écriture
+     * @return Faux si la sauvegarde n'a pas pu démarrer (ou si une autre est en cours)
+     * 
+     * Le point de reprise est encodé en mémoire avant le fork ; le fils ne fait
+     * qu'écrire et renommer le fichier (pas d'ordonnanceur, de flux ni de verrou
+     * tenus par les autres threads au moment du fork). Hors systèmes POSIX, la
+     * sauvegarde est synchrone.
+     */
+    bool saveCheckpointInBackground(const std::string& path);
+    
+    /**
+     * @brief Attend la fin de la sauvegarde en arrière-plan
+     * @return Vrai si elle a réussi (ou s'il n'y en avait pas)
+     */
+    bool waitForCheckpoint();
+    
+    /**
+     * @brief Restaure un point de reprise écrit par saveCheckpoint
+     * @return Faux si le fichier est illisible, d'une autre version, corrompu
+     *         ou écrit pour un autre réseau (la simulation est alors inchangée)
+     * 
+     * Le réseau doit avoir été chargé (initialize) avec la même configuration.
+     * Le nombre de threads et le découpage en régions restent ceux de cette
+     * simulation : la suite est identique à celle de la simulation sauvegardée.
+     */
+    bool loadCheckpoint(const std::string& path);
+    
+    static constexpr uint32_t CHECKPOINT_VERSION = 3;
+    
+    /**
+     * @brief Copie indépendante de l'état courant (simulation « et si »)
+     * @param threadCount Threads de la copie (1 = séquentielle, sans prendre de cœurs à l'originale)
+     * @return La copie, ou nullptr si l'état n'a pas pu être recopié
+     * 
+     * La topologie est partagée, pas copiée ; l'état dynamique (routes,
+     * véhicules, événements, modèle de trafic, générateur aléatoire) passe
+     * par un point de reprise en mémoire, quelques dizaines d'octets par
+     * véhicule. La copie ne reprend ni les observateurs ni la sauvegarde en
+     * cours, et n'est pas en pause. À appeler depuis le thread qui exécute
+     * update ; la copie peut ensuite avancer sur n'importe quel thread.
+     */
+    std::unique_ptr<Simulation> fork(unsigned int threadCount = 1) const;
     
     // Statistiques
     void updateStatistics();
     void printStatistics() const;
     
+    /**
+     * @brief Statistiques de trafic depuis l'initialisation (ou resetStatistics)
+     * 
+     * Temps de parcours et retard des trajets terminés, débit par route,
+     * durée de calcul des reroutages : moyenne et percentiles p50/p95/p99.
+     * Les accumulateurs par thread sont fusionnés à l'appel (quelques
+     * dizaines de microsecondes) ; à appeler entre deux ticks.
+     */
+    StatisticsReport getStatistics() const { return statistics.report(simulationTime); }
+    void resetStatistics() { statistics.reset(simulationTime); }
+    
+    /**
+     * @brief Compteurs des recherches de chemin (nœuds fixés, arêtes relâchées, tas, temps)
+     * 
+     * Cumulés par le PathPlanner depuis sa création ou resetSearchStats :
+     * comparaison des stratégies (setPathfindingStrategy) sur un même scénario.
+     */
+    SearchStats getSearchStats() const { return pathPlanner->getSearchStats(); }
+    void resetSearchStats() { pathPlanner->resetSearchStats(); }
+    
 private:
     // Méthodes privées
-    void createTestGraph();
+    void applyConfig(const SimulationConfig& settings);
     void createVehicles();
+    
+    // Maintenance de l'index route -> véhicules
+    void assignPath(Vehicle* vehicle, const std::vector<int>& path);
+    void depart(Vehicle* vehicle);   // Instant de départ et parcours à vide du chemin planifié
+    void indexVehicleRoutes(Vehicle* vehicle, size_t firstEdge, size_t lastEdge);
+    void unindexVehicleRoutes(Vehicle* vehicle, size_t firstEdge, size_t lastEdge);
+    void resetRouteIndex();
+    
+    // Occupation réelle des routes : entrée (+1) / sortie (-1) du véhicule sur l'arête edge de son chemin
+    void queueEdgeOccupancy(const Vehicle* vehicle, int edge, int delta);
+    void recordRouteExits(const Vehicle* vehicle, int firstEdge, int lastEdge);   // Arêtes [firstEdge, lastEdge) quittées
+    void clearVehicles();
+    
+    // Phases du tick
+    void buildTickGraph();
+    void updateEvents(float deltaTime);
+    void updateVehicles(float deltaTime);   // Deux phases : calcul parallèle, application séquentielle
+    void updateRegionVehicles(float deltaTime);
+    void updateRegion(int region, float deltaTime, bool allowRerouting);
+    void updateModelVehicles(float deltaTime);
+    void rerouteBlockedVehicles();
+    void removeArrivedVehicles();
+    void planSpawns();
+    void commitSpawns();
+    void refreshConnectedNodes();
+    
+    // Signale le reroutage aux véhicules dont le chemin restant emprunte une route devenue inutilisable
+    void processRouteChanges();
+    
+    // Points de reprise : fichier complet (en-tête et contenu), contenu seul, écriture sur disque
+    void encodeCheckpoint(BinaryWriter& out) const;
+    void writeCheckpoint(BinaryWriter& out) const;
+    static bool writeCheckpointFile(const std::string& path, const BinaryWriter& out);
+    bool readCheckpoint(BinaryReader& in);
+    
+    // Régions : découpage du graphe et appartenance des véhicules
+    void rebuildPartition();
+    int vehicleRegion(const Vehicle* vehicle) const;
+    void moveVehicleRegion(Vehicle* vehicle, int fromRegion, int toRegion);
 };
 
 #endif // SIMULATION_H
@@ -0,0 +1,137 @@
+#ifndef SIMULATION_RUNNER_H
+#define SIMULATION_RUNNER_H
+
+/**
+ * @file SimulationRunner.h
+ * @brief Exécution de la simulation sur son propre thread
+ *
+ * Le thread de simulation est le seul à modifier la simulation. Le thread
+ * de rendu lui transmet les actions de l'interface par une file de
+ * commandes sans verrou et dessine le dernier instantané publié (triple
+ * tampon) : un tick lent ne bloque jamais l'affichage, et un rendu lent
+ * ne ralentit pas la simulation.
+ */
+
+#include "Simulation.h"
+#include "FrameSnapshot.h"
+#include "SpscQueue.h"
+#include "WhatIfPreview.h"
+#include <atomic>
+#include <string>
+#include <thread>
+
+/**
+ * @enum CommandType
+ * @brief Actions de l'interface appliquées par le thread de simulation
+ */
+enum class CommandType {
+    TOGGLE_PAUSE,
+    SET_TIME_SCALE,       ///< value = facteur
+    TOGGLE_FAST_FORWARD,
+    SET_MODE,             ///< count = SimulationMode
+    SET_TRAFFIC_MODEL,    ///< count = TrafficModel
+    TRIGGER_EVENT,
+    SET_VEHICLE_COUNT,    ///< count = nombre de véhicules
+    SET_FOCUS_AREA,       ///< area = minX, minY, maxX, maxY
+    SAVE_CHECKPOINT,      ///< Sauvegarde en arrière-plan dans le fichier de points de reprise
+    LOAD_CHECKPOINT,      ///< Restauration du dernier point de reprise
+    PREVIEW_CLOSURE       ///< Aperçu d'une fermeture sans l'appliquer : count = ID de route, value = durée (s)
+};
+
+/**
+ * @struct SimulationCommand
+ * @brief Commande copiable (sans allocation) transmise au thread de simulation
+ */
+struct SimulationCommand {
+    CommandType type;
+    int count;
+    float value;
+    float area[4];
+
+    static SimulationCommand make(CommandType type, int count = 0, float value = 0.0f) {
+        return SimulationCommand{type, count, value, {0.0f, 0.0f, 0.0f, 0.0f}};
+    }
+};
+
+/**
+ * @class SimulationRunner
+ * @brief Boucle de simulation, file de commandes et publication des instantanés
+ */
+class SimulationRunner {
+public:
+    static constexpr size_t COMMAND_CAPACITY = 256;
+    static constexpr float LOOP_PERIOD = 1.0f / 120.0f;   // Cycle minimal du thread (s)
+    static constexpr int MAX_ERRORS = 10;                 // Erreurs consécutives avant arrêt
+    static constexpr float MAX_TICK_INTERVAL = 0.25f;     // Borne de l'intervalle d'interpolation (reprise après pause)
+
+    explicit SimulationRunner(Simulation& simulation);
+    ~SimulationRunner();
+
+    SimulationRunner(const SimulationRunner&) = delete;
+    SimulationRunner& operator=(const SimulationRunner&) = delete;
+
+    /**
+     * @brief Publie un premier instantané puis démarre le thread de simulation
+     */
+    void start();
+
+    /**
+     * @brief Arrête le thread (les commandes en attente sont ignorées)
+     */
+    void stop();
+
+    // Fichier des commandes SAVE_CHECKPOINT / LOAD_CHECKPOINT (à fixer avant start)
+    void setCheckpointPath(const std::string& path) { checkpointPath = path; }
+    
+    bool isRunning() const { return running.load(std::memory_order_acquire); }
+    bool hasFailed() const { return failed.load(std::memory_order_acquire); }
+
+    /**
+     * @brief Transmet une commande au thread de simulation (thread de rendu uniquement)
+     * @return Faux si la file est pleine (commande ignorée)
+     */
+    bool post(const SimulationCommand& command) { return commands.push(command); }
+
+    /**
+     * @brief Dernier instantané publié (thread de rendu uniquement)
+     *
+     * La référence reste valide jusqu'au prochain appel.
+     */
+    const FrameSnapshot& acquireSnapshot();
+
+    /**
+     * @brief Un cycle complet dans le thread appelant : commandes, avance, publication
+     *
+     * Un instantané n'est publié qu'après au moins un tick ou une commande :
+     * entre deux ticks, le rendu interpole à partir du dernier instantané.
+     * Utilisé par la boucle du thread ; permet aussi de piloter la simulation
+     * sans thread (tests).
+     */
+    void runOnce(float realDeltaTime);
+
+private:
+    Simulation& simulation;
+    SpscQueue<SimulationCommand, COMMAND_CAPACITY> commands;
+    TripleBuffer<FrameSnapshot> snapshots;
+    std::thread thread;
+    std::atomic<bool> running;
+    std::atomic<bool> failed;
+    int triggeredEvents;
+    std::string checkpointPath;
+    WhatIfPreview preview;
+    bool previewPending;
+    int completedPreviews;
+    WhatIfReport lastPreview;
+
+    // Positions des véhicules aux deux derniers ticks (ordre croissant des identifiants)
+    std::vector<VehicleSnapshot> previousTick;
+    std::vector<VehicleSnapshot> lastTick;
+    double lastTickTime;
+    float tickInterval;
+
+    void loop();
+    void apply(const SimulationCommand& command);
+    void publish(bool ticked);
+};
+
+#endif // SIMULATION_RUNNER_H
@@ -0,0 +1,71 @@
+#ifndef SPSC_QUEUE_H
+#define SPSC_QUEUE_H
+
+/**
+ * @file SpscQueue.h
+ * @brief File circulaire sans verrou à un producteur et un consommateur
+ */
+
+#include <atomic>
+#include <cstddef>
+#include <utility>
+
+/**
+ * @class SpscQueue
+ * @brief File bornée : push depuis un seul thread, pop depuis un seul autre thread
+ *
+ * Les deux compteurs ne font que croître ; chacun n'est écrit que par son
+ * propriétaire et lu par l'autre (acquire / release). Ils sont placés sur
+ * des lignes de cache distinctes pour éviter le faux partage.
+ */
+template<typename T, size_t Capacity>
+class SpscQueue {
+    static_assert(Capacity > 0 && (Capacity & (Capacity - 1)) == 0, "Capacity doit etre une puissance de 2");
+
+public:
+    /**
+     * @brief Ajoute un élément (producteur)
+     * @return Faux si la file est pleine
+     */
+    bool push(const T& item) {
+        size_t tail = tailIndex.load(std::memory_order_relaxed);
+        if (tail - headIndex.load(std::memory_order_acquire) == Capacity) {
+            return false;
+        }
+        slots[tail & (Capacity - 1)] = item;
+        tailIndex.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Variante par déplacement (éléments possédant de la mémoire : tampons)
+    bool push(T&& item) {
+        size_t tail = tailIndex.load(std::memory_order_relaxed);
+        if (tail - headIndex.load(std::memory_order_acquire) == Capacity) {
+            return false;
+        }
+        slots[tail & (Capacity - 1)] = std::move(item);
+        tailIndex.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Retire le plus ancien élément (consommateur)
+     * @return Faux si la file est vide
+     */
+    bool pop(T& item) {
+        size_t head = headIndex.load(std::memory_order_relaxed);
+        if (head == tailIndex.load(std::memory_order_acquire)) {
+            return false;
+        }
+        item = std::move(slots[head & (Capacity - 1)]);
+        headIndex.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+private:
+    T slots[Capacity];
+    alignas(64) std::atomic<size_t> headIndex{0};
+    alignas(64) std::atomic<size_t> tailIndex{0};
+};
+
+#endif // SPSC_QUEUE_H
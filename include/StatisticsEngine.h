@@ -0,0 +1,136 @@
+#ifndef STATISTICS_ENGINE_H
+#define STATISTICS_ENGINE_H
+
+/**
+ * @file StatisticsEngine.h
+ * @brief Statistiques de trafic accumulées en continu pendant la simulation
+ *
+ * Chaque thread de l'ordonnanceur écrit dans son propre accumulateur
+ * (histogrammes et compteurs par route, alignés sur une ligne de cache) :
+ * l'enregistrement ne prend ni verrou ni opération atomique et coûte
+ * quelques nanosecondes, il reste donc actif en permanence. Les
+ * accumulateurs ne sont fusionnés qu'à la demande d'un rapport.
+ *
+ * Mesures :
+ * - temps de parcours des trajets terminés ;
+ * - retard sur le parcours à vide (vitesse de base) du chemin planifié au départ ;
+ * - véhicules sortis de chaque route (débit par route) ;
+ * - durée de calcul des reroutages appliqués.
+ */
+
+#include "BinaryIO.h"
+#include "Histogram.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @struct DistributionSummary
+ * @brief Résumé d'une distribution (percentiles à environ 3 % près)
+ */
+struct DistributionSummary {
+    uint64_t count;
+    double mean;
+    double p50;
+    double p95;
+    double p99;
+    double max;
+};
+
+/**
+ * @struct StatisticsReport
+ * @brief Statistiques fusionnées depuis la dernière remise à zéro
+ */
+struct StatisticsReport {
+    float window;                          // Temps simulé couvert (s)
+    DistributionSummary travelTime;        // Temps de parcours (s)
+    DistributionSummary delay;             // Retard sur le parcours à vide (s)
+    DistributionSummary rerouteLatency;    // Calcul d'un nouveau chemin (µs)
+    std::vector<uint64_t> routeExits;      // Véhicules sortis de chaque route (index du graphe)
+
+    // Débit d'une route en véhicules par minute simulée
+    float getRouteThroughput(size_t routeIndex) const {
+        return window > 0.0f && routeIndex < routeExits.size() ? routeExits[routeIndex] * 60.0f / window : 0.0f;
+    }
+};
+
+/**
+ * @class StatisticsEngine
+ * @brief Accumulateurs par thread et fusion à la lecture
+ *
+ * Un accumulateur n'est écrit que par le thread dont il porte l'index
+ * (TaskScheduler::getThreadIndex) ; la lecture (report, getMeanTravelTime)
+ * se fait entre deux phases d'écriture.
+ */
+class StatisticsEngine {
+public:
+    StatisticsEngine();
+
+    /**
+     * @brief Nombre d'accumulateurs (un par thread de l'ordonnanceur)
+     *
+     * Les mesures déjà enregistrées sont conservées.
+     */
+    void setSlotCount(unsigned int count);
+    unsigned int getSlotCount() const { return static_cast<unsigned int>(slots.size()); }
+
+    // Nombre de routes suivies (les compteurs existants sont conservés)
+    void setRouteCount(size_t count);
+
+    // Remise à zéro, la fenêtre commence à l'instant now (s)
+    void reset(float now);
+    float getWindowStart() const { return windowStart; }
+
+    void recordTrip(unsigned int slot, float travelTime, float delay) {
+        Slot& target = slots[slot];
+        target.travelTime.record(toMilliseconds(travelTime));
+        target.delay.record(toMilliseconds(delay));
+    }
+
+    void recordRouteExit(unsigned int slot, int routeIndex) {
+        std::vector<uint64_t>& exits = slots[slot].routeExits;
+        if (routeIndex >= 0 && static_cast<size_t>(routeIndex) < exits.size()) {
+            exits[routeIndex]++;
+        }
+    }
+
+    void recordReroute(unsigned int slot, uint64_t nanoseconds) {
+        slots[slot].rerouteLatency.record(nanoseconds);
+    }
+
+    /**
+     * @brief Temps de parcours moyen (s), sans fusion des histogrammes
+     */
+    float getMeanTravelTime() const;
+    uint64_t getTripCount() const;
+
+    /**
+     * @brief Fusionne les accumulateurs
+     * @param now Instant courant (s), fin de la fenêtre
+     */
+    StatisticsReport report(float now) const;
+
+    // Points de reprise : accumulateurs fusionnés
+    void write(BinaryWriter& out) const;
+    bool read(BinaryReader& in);
+
+private:
+    struct alignas(64) Slot {
+        Histogram travelTime;        // ms
+        Histogram delay;             // ms
+        Histogram rerouteLatency;    // ns
+        std::vector<uint64_t> routeExits;
+    };
+
+    std::vector<Slot> slots;
+    size_t routeCount;
+    float windowStart;
+
+    static uint64_t toMilliseconds(float seconds) {
+        return seconds > 0.0f ? static_cast<uint64_t>(seconds * 1000.0f + 0.5f) : 0;
+    }
+
+    Slot merged() const;
+};
+
+#endif // STATISTICS_ENGINE_H
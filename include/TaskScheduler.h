@@ -0,0 +1,146 @@
+#ifndef TASK_SCHEDULER_H
+#define TASK_SCHEDULER_H
+
+/**
+ * @file TaskScheduler.h
+ * @brief Ordonnanceur de tâches à vol de travail (work-stealing)
+ *
+ * Runtime de concurrence unique de la simulation et du planificateur :
+ * chaque thread possède sa propre file de tâches (deque), traite ses
+ * tâches en LIFO et vole celles des autres threads en FIFO lorsqu'il
+ * n'a plus rien à faire. Deux modes d'utilisation :
+ * - parallelFor : boucle parallèle sur un intervalle d'index
+ * - run(TaskGraph) : exécution d'un graphe de dépendances (DAG) où les
+ *   tâches indépendantes se recouvrent
+ *
+ * Un thread qui attend (parallelFor, run) exécute lui-même des tâches en
+ * attente : les appels imbriqués ne bloquent donc jamais le pool.
+ */
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+/**
+ * @class TaskGraph
+ * @brief Graphe de tâches avec dépendances, exécuté par TaskScheduler::run
+ *
+ * Construit une fois puis réexécutable autant de fois que voulu.
+ */
+class TaskGraph {
+public:
+    /**
+     * @brief Ajoute une tâche au graphe
+     * @param name Nom de la tâche (diagnostic)
+     * @param work Travail à exécuter
+     * @return Identifiant de la tâche
+     */
+    int addTask(const std::string& name, std::function<void()> work);
+
+    /**
+     * @brief Déclare que before doit se terminer avant le début de after
+     */
+    void precede(int before, int after);
+
+    size_t size() const { return tasks.size(); }
+    const std::string& getName(int task) const { return tasks[task].name; }
+
+private:
+    friend class TaskScheduler;
+
+    struct Node {
+        std::string name;
+        std::function<void()> work;
+        std::vector<int> successors;
+        int dependencyCount;
+    };
+    std::vector<Node> tasks;
+};
+
+/**
+ * @class TaskScheduler
+ * @brief Pool de threads persistants avec une file de tâches par thread
+ *
+ * Les exceptions levées par une tâche sont propagées (la première) à
+ * l'appelant de parallelFor ou run, une fois toutes les tâches terminées.
+ */
+class TaskScheduler {
+public:
+    /**
+     * @brief Constructeur
+     * @param threadCount Nombre total de threads (appelant compris), 0 = nombre de cœurs
+     */
+    explicit TaskScheduler(unsigned int threadCount = 0);
+    ~TaskScheduler();
+
+    TaskScheduler(const TaskScheduler&) = delete;
+    TaskScheduler& operator=(const TaskScheduler&) = delete;
+
+    /**
+     * @brief Nombre total de threads utilisés (thread appelant compris)
+     */
+    unsigned int getThreadCount() const { return static_cast<unsigned int>(workers.size()) + 1; }
+
+    /**
+     * @brief Index du thread courant dans [0, getThreadCount())
+     *
+     * 0 pour le thread appelant (et tout thread extérieur au pool), i pour
+     * le worker i : permet d'indexer des données propres à chaque thread.
+     */
+    unsigned int getThreadIndex() const { return currentQueue(); }
+
+    /**
+     * @brief Exécute body sur [0, count) découpé en blocs d'au plus grain éléments
+     *
+     * Bloque jusqu'à la fin de tous les blocs. Exécuté directement sur le
+     * thread appelant si l'intervalle tient dans un seul bloc.
+     * @param count Nombre d'éléments
+     * @param grain Taille maximale d'un bloc
+     * @param body Fonction appelée avec chaque bloc [begin, end)
+     */
+    void parallelFor(size_t count, size_t grain, const std::function<void(size_t, size_t)>& body);
+
+    /**
+     * @brief Exécute toutes les tâches du graphe en respectant les dépendances
+     *
+     * Bloque jusqu'à la fin de la dernière tâche.
+     */
+    void run(const TaskGraph& graph);
+
+private:
+    using Task = std::function<void()>;
+
+    // Essais sans tâche à prendre avant qu'un thread qui attend un groupe ne s'endorme
+    static constexpr int SPIN_COUNT = 64;
+
+    // File de tâches d'un thread : le propriétaire dépile à l'arrière, les voleurs à l'avant
+    struct WorkerQueue {
+        std::mutex mutex;
+        std::deque<Task> tasks;
+    };
+
+    void push(Task task);
+    bool tryPop(Task& task);
+    void helpUntilZero(const std::atomic<size_t>& remaining);
+    void finishTask(std::atomic<size_t>& remaining);
+    void workerLoop(unsigned int index);
+    unsigned int currentQueue() const;
+
+    // queues[0] : threads extérieurs au pool ; queues[i] : worker i
+    std::vector<std::unique_ptr<WorkerQueue>> queues;
+    std::vector<std::thread> workers;
+
+    std::mutex sleepMutex;
+    std::condition_variable sleepCondition;
+    std::atomic<size_t> queuedTasks;
+    bool stopping;
+};
+
+#endif // TASK_SCHEDULER_H
@@ -0,0 +1,139 @@
+#ifndef TRACE_RECORDER_H
+#define TRACE_RECORDER_H
+
+/**
+ * @file TraceRecorder.h
+ * @brief Enregistrement compact d'une exécution de la simulation
+ *
+ * Après chaque tick, l'enregistreur compare l'état de la simulation à
+ * celui du tick précédent et n'écrit que les changements : apparition,
+ * changement d'arête, reroutage et arrivée des véhicules, changements
+ * d'état des routes, début et fin des événements. Les identifiants sont
+ * écrits en écart par rapport à l'enregistrement précédent et les chemins
+ * en écarts entre nœuds successifs (entiers de longueur variable) : un
+ * tick sans changement coûte 5 octets.
+ *
+ * L'encodage se fait dans le thread de simulation ; les blocs complets
+ * sont transmis par une file sans verrou à un thread d'écriture, seul à
+ * toucher au fichier. TraceReplayer relit le fichier sans exécuter la
+ * simulation.
+ *
+ * Format : en-tête (TRACE_MAGIC, version, empreinte du réseau, nombres de
+ * nœuds et de routes, modèle de trafic) puis une suite d'enregistrements
+ * (TraceTag) terminée par END.
+ */
+
+#include "BinaryIO.h"
+#include "SpscQueue.h"
+#include <atomic>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+class Simulation;
+class Vehicle;
+class Event;
+
+/**
+ * @enum TraceTag
+ * @brief Type d'un enregistrement de la trace
+ */
+enum class TraceTag : uint8_t {
+    END = 0,           ///< Fin de la trace
+    TICK = 1,          ///< Début d'un tick : temps simulé (float)
+    VEHICLE = 2,       ///< Apparition : écart d'id, type, arête, progression, chemin
+    EDGE = 3,          ///< Passage à une autre arête du chemin : écart d'id, arête
+    PATH = 4,          ///< Nouveau chemin (reroutage) : écart d'id, arête, progression, chemin
+    ARRIVE = 5,        ///< Sortie de la simulation : écart d'id
+    ROUTE = 6,         ///< Changement d'état : écart d'index de route, état
+    EVENT_START = 7,   ///< Début d'événement : id, type, route, durée, temps écoulé
+    EVENT_END = 8      ///< Fin d'événement : numéro (ordre des EVENT_START dans la trace)
+};
+
+/**
+ * @class TraceRecorder
+ * @brief Enregistre les changements de chaque tick dans un fichier binaire
+ */
+class TraceRecorder {
+public:
+    static constexpr char TRACE_MAGIC[4] = {'T', 'S', 'T', 'R'};
+    static constexpr uint32_t TRACE_VERSION = 1;
+    static constexpr float PROGRESS_SCALE = 65535.0f;     // Progression quantifiée sur 16 bits
+    static constexpr size_t BLOCK_SIZE = 64 * 1024;       // Taille des blocs transmis au thread d'écriture
+    static constexpr size_t BLOCK_QUEUE_CAPACITY = 64;
+
+    TraceRecorder();
+    ~TraceRecorder();
+
+    TraceRecorder(const TraceRecorder&) = delete;
+    TraceRecorder& operator=(const TraceRecorder&) = delete;
+
+    /**
+     * @brief Ouvre le fichier, écrit l'état initial et s'abonne aux ticks de la simulation
+     * @return Faux si le fichier ne peut pas être créé (ou si un enregistrement est en cours)
+     *
+     * À appeler quand la simulation n'est pas mise à jour par un autre
+     * thread (avant SimulationRunner::start).
+     */
+    bool start(const std::string& path, Simulation& simulation);
+
+    /**
+     * @brief Termine la trace, attend l'écriture des derniers blocs et ferme le fichier
+     * @return Faux si une écriture a échoué
+     *
+     * Même contrainte que start (après SimulationRunner::stop).
+     */
+    bool stop();
+
+    bool isRecording() const { return simulation != nullptr; }
+    size_t getTickCount() const { return tickCount; }
+    uint64_t getBytesRecorded() const { return bytesRecorded + block.size(); }
+
+    /**
+     * @brief Encode les changements depuis l'appel précédent (appelé à la fin de chaque tick)
+     */
+    void record(const Simulation& simulation);
+
+private:
+    struct TrackedVehicle {
+        int id;                     // Jamais réutilisé par la simulation
+        int edge;
+        unsigned int pathVersion;
+        const Vehicle* vehicle;     // Change si les véhicules sont restaurés (point de reprise)
+    };
+    struct TrackedEvent {
+        const Event* event;
+        int traceId;
+        int routeId;
+        float elapsedTime;
+    };
+
+    Simulation* simulation;
+    int observerId;
+
+    // État du tick précédent (véhicules par id croissant, comme dans la simulation)
+    std::vector<TrackedVehicle> trackedVehicles;
+    std::vector<TrackedVehicle> nextVehicles;
+    std::vector<uint8_t> routeStates;
+    std::vector<TrackedEvent> trackedEvents;
+    std::vector<TrackedEvent> nextEvents;
+    int nextEventTraceId;
+    size_t tickCount;
+
+    // Encodage dans le thread de simulation, écriture dans le thread dédié
+    BinaryWriter block;
+    uint64_t bytesRecorded;
+    SpscQueue<std::vector<unsigned char>, BLOCK_QUEUE_CAPACITY> blocks;
+    std::ofstream file;
+    std::thread writer;
+    std::atomic<bool> finishing;
+    std::atomic<bool> writeFailed;
+
+    void writeVehicle(TraceTag tag, const Vehicle& vehicle, int& lastId);
+    void flushBlock();
+    void writerLoop();
+};
+
+#endif // TRACE_RECORDER_H
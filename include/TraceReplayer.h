@@ -0,0 +1,122 @@
+#ifndef TRACE_REPLAYER_H
+#define TRACE_REPLAYER_H
+
+/**
+ * @file TraceReplayer.h
+ * @brief Relecture d'une trace écrite par TraceRecorder, sans exécuter la simulation
+ *
+ * La trace est indexée à l'ouverture : un parcours par véhicule (suite de
+ * tronçons horodatés sur les arêtes de ses chemins), l'historique d'état
+ * de chaque route et la période de chaque événement. Un instantané de
+ * rendu peut alors être reconstruit à n'importe quel instant, en avant
+ * comme en arrière ; les parcours servent aussi directement aux outils
+ * d'analyse (temps de trajet, reroutages, occupation des routes).
+ *
+ * Entre deux changements d'arête, la progression est interpolée
+ * linéairement : les positions sont celles d'un déplacement à vitesse
+ * constante sur chaque arête, les états (arête occupée, routes,
+ * événements) sont exacts à chaque tick.
+ */
+
+#include "Graph.h"
+#include "Event.h"
+#include "FrameSnapshot.h"
+#include "BinaryIO.h"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * @struct TraceLeg
+ * @brief Passage d'un véhicule sur une arête de son chemin
+ */
+struct TraceLeg {
+    int fromNode;
+    int toNode;
+    int route;               // Index dans Graph::getRoutes() (-1 si introuvable)
+    float startTime;
+    float endTime;
+    float startProgress;
+    float endProgress;
+};
+
+/**
+ * @struct VehicleTrack
+ * @brief Parcours complet d'un véhicule dans la trace
+ */
+struct VehicleTrack {
+    int id;
+    int type;
+    float startTime;
+    float endTime;           // Arrivée (infini si le véhicule circulait encore en fin de trace)
+    bool arrived;
+    int reroutings;
+    std::vector<TraceLeg> legs;
+};
+
+/**
+ * @struct TraceEvent
+ * @brief Période d'un événement dans la trace
+ */
+struct TraceEvent {
+    int id;
+    EventType type;
+    int routeId;
+    float duration;
+    float startElapsed;      // Temps déjà écoulé au premier tick enregistré
+    float startTime;
+    float endTime;           // Infini si l'événement était encore actif en fin de trace
+};
+
+/**
+ * @class TraceReplayer
+ * @brief Index d'une trace et reconstruction des instantanés
+ */
+class TraceReplayer {
+public:
+    explicit TraceReplayer(const Graph& graph);
+
+    /**
+     * @brief Charge et indexe une trace
+     * @return Faux si le fichier est illisible, d'une autre version ou
+     *         enregistré sur un autre réseau. Une trace interrompue (arrêt
+     *         brutal) est relue jusqu'au dernier enregistrement lisible.
+     */
+    bool open(const std::string& path);
+
+    float getStartTime() const { return tickTimes.empty() ? 0.0f : tickTimes.front(); }
+    float getEndTime() const { return tickTimes.empty() ? 0.0f : tickTimes.back(); }
+    const std::vector<float>& getTickTimes() const { return tickTimes; }
+    TrafficModel getTrafficModel() const { return trafficModel; }
+    bool isComplete() const { return complete; }
+
+    const std::vector<VehicleTrack>& getVehicleTracks() const { return tracks; }
+    const std::vector<TraceEvent>& getEvents() const { return events; }
+
+    // État d'une route à l'instant time (index dans Graph::getRoutes())
+    RouteState getRouteState(size_t route, float time) const;
+
+    /**
+     * @brief Remplit un instantané de rendu à l'instant time (borné à la durée de la trace)
+     *
+     * Les tableaux de frame sont réutilisés ; la position précédente est
+     * égale à la position courante (pas d'interpolation supplémentaire).
+     */
+    void frameAt(float time, FrameSnapshot& frame) const;
+
+private:
+    const Graph& graph;
+    std::vector<float> tickTimes;
+    std::vector<VehicleTrack> tracks;
+    std::vector<TraceEvent> events;
+    std::vector<std::vector<std::pair<float, RouteState>>> routeHistory;
+    std::vector<float> rerouteTimes;
+    TrafficModel trafficModel;
+    bool complete;
+
+    bool parse(BinaryReader& in);
+    TraceLeg makeLeg(const std::vector<int>& path, int edge, float time, float progress) const;
+    void closeOpenLeg(TraceLeg& leg) const;
+};
+
+#endif // TRACE_REPLAYER_H
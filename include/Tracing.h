@@ -0,0 +1,156 @@
+#ifndef TRACING_H
+#define TRACING_H
+
+/**
+ * @file Tracing.h
+ * @brief Zones de traçage exportées au format Chrome trace (chrome://tracing, Perfetto)
+ *
+ * TRACE_ZONE("nom") mesure la durée de la portée qui l'entoure ;
+ * TRACE_THREAD_NAME("nom") nomme le thread courant dans la trace. Les
+ * macros n'existent qu'avec ROUTAGE_TRACING défini (option CMake du même
+ * nom) : sans elle elles ne génèrent aucun code.
+ *
+ * Chaque thread écrit dans son propre tampon, une liste de blocs de taille
+ * fixe : l'enregistrement d'une zone ne prend aucun verrou (deux lectures
+ * d'horloge et une écriture), seul le premier événement d'un thread
+ * l'inscrit auprès du Tracer. Le compteur de chaque bloc est publié de
+ * façon atomique : writeChromeTrace peut lire les tampons pendant que les
+ * threads continuent d'enregistrer.
+ */
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+/**
+ * @class Tracer
+ * @brief Registre des tampons par thread et export JSON
+ */
+class Tracer {
+public:
+    static constexpr size_t BLOCK_EVENTS = 4096;        // Événements par bloc
+    static constexpr size_t MAX_BLOCKS = 256;           // Par thread (~1 million d'événements)
+
+    // Vrai si les zones sont compilées (ROUTAGE_TRACING)
+    static constexpr bool isCompiledIn() {
+#ifdef ROUTAGE_TRACING
+        return true;
+#else
+        return false;
+#endif
+    }
+
+    static uint64_t now() {
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count());
+    }
+
+    /**
+     * @brief Enregistre une zone terminée du thread courant
+     * @param name Chaîne statique (seul le pointeur est conservé)
+     */
+    static void record(const char* name, uint64_t start, uint64_t end) {
+        ThreadBuffer* buffer = currentBuffer();
+        TraceBlock* block = buffer->tail;
+        size_t count = block->count.load(std::memory_order_relaxed);
+        if (count == BLOCK_EVENTS) {
+            block = buffer->grow();
+            if (!block) {
+                return;
+            }
+            count = 0;
+        }
+        block->events[count] = TraceEvent{name, start, end - start};
+        block->count.store(count + 1, std::memory_order_release);
+    }
+
+    static void setThreadName(const std::string& name);
+
+    /**
+     * @brief Écrit toutes les zones enregistrées jusqu'ici (tous threads)
+     * @return Faux si le fichier ne peut pas être écrit
+     */
+    static bool writeChromeTrace(const std::string& path);
+
+    // Nombre de zones enregistrées et de zones perdues (tampon d'un thread plein)
+    static uint64_t getEventCount();
+    static uint64_t getDroppedCount();
+
+private:
+    struct TraceEvent {
+        const char* name;
+        uint64_t start;       // ns (horloge monotone)
+        uint64_t duration;
+    };
+
+    struct TraceBlock {
+        TraceEvent events[BLOCK_EVENTS];
+        std::atomic<size_t> count{0};
+        std::atomic<TraceBlock*> next{nullptr};
+    };
+
+    // Écrit par son seul thread ; lu par writeChromeTrace via les compteurs atomiques
+    struct ThreadBuffer {
+        int threadId;
+        std::string name;                 // Protégé par le verrou du registre
+        std::unique_ptr<TraceBlock> head;
+        TraceBlock* tail;
+        size_t blockCount;
+        std::atomic<uint64_t> dropped{0};
+
+        TraceBlock* grow();
+        ~ThreadBuffer();
+    };
+
+    static ThreadBuffer* currentBuffer() {
+        thread_local ThreadBuffer* buffer = nullptr;
+        if (!buffer) {
+            buffer = registerThread();
+        }
+        return buffer;
+    }
+
+    static ThreadBuffer* registerThread();
+
+    // Les tampons survivent à leur thread : ses zones restent dans la trace
+    static std::mutex registryMutex;
+    static std::vector<std::unique_ptr<ThreadBuffer>> buffers;
+};
+
+#ifdef ROUTAGE_TRACING
+
+/**
+ * @class TraceZone
+ * @brief Zone RAII : enregistrée à la sortie de la portée
+ */
+class TraceZone {
+public:
+    explicit TraceZone(const char* name) : name(name), start(Tracer::now()) {}
+    ~TraceZone() { Tracer::record(name, start, Tracer::now()); }
+
+    TraceZone(const TraceZone&) = delete;
+    TraceZone& operator=(const TraceZone&) = delete;
+
+private:
+    const char* name;
+    uint64_t start;
+};
+
+#define TRACE_CONCAT_INNER(a, b) a##b
+#define TRACE_CONCAT(a, b) TRACE_CONCAT_INNER(a, b)
+#define TRACE_ZONE(name) TraceZone TRACE_CONCAT(traceZone, __LINE__)(name)
+#define TRACE_THREAD_NAME(name) Tracer::setThreadName(name)
+
+#else
+
+#define TRACE_ZONE(name) ((void)0)
+#define TRACE_THREAD_NAME(name) ((void)0)
+
+#endif // ROUTAGE_TRACING
+
+#endif // TRACING_H
@@ -0,0 +1,141 @@
+#ifndef TRAFFIC_DYNAMICS_H
+#define TRAFFIC_DYNAMICS_H
+
+/**
+ * @file TrafficDynamics.h
+ * @brief Interface des modèles de déplacement des véhicules (pattern Strategy)
+ *
+ * Un modèle de dynamique prend en charge le mouvement des véhicules sur
+ * les routes à la place de Vehicle::update : il fait avancer les véhicules
+ * d'une arête à la suivante et calcule leur position de rendu. La
+ * simulation reste responsable de l'occupation des routes, de l'index
+ * route -> véhicules et du reroutage, à partir des mouvements signalés.
+ *
+ * Un modèle peut ne gérer qu'une partie des routes (modèle hybride) : les
+ * véhicules qui en sortent sont alors remis au modèle voisin (setPeer).
+ */
+
+#include "BinaryIO.h"
+#include "Route.h"
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <vector>
+
+class Vehicle;
+class TaskScheduler;
+
+/**
+ * @struct VehicleMove
+ * @brief Passage d'un véhicule de l'arête fromEdge à fromEdge + 1 de son chemin
+ */
+struct VehicleMove {
+    Vehicle* vehicle;
+    int fromEdge;
+};
+
+/**
+ * @class TrafficDynamics
+ * @brief Classe abstraite pour les modèles de trafic
+ */
+class TrafficDynamics {
+public:
+    virtual ~TrafficDynamics() = default;
+
+    /**
+     * @brief Retire tous les véhicules et se redimensionne selon le graphe
+     */
+    virtual void reset() = 0;
+
+    /**
+     * @brief Place un véhicule sur la route actuelle de son chemin
+     * @param vehicle Véhicule (chemin déjà résolu)
+     * @param remainingFraction Part de la route restant à parcourir (1 = entrée sur la route)
+     */
+    virtual void enter(Vehicle* vehicle, float remainingFraction = 1.0f) = 0;
+
+    /**
+     * @brief Retire un véhicule du modèle (à appeler avant de changer son chemin)
+     */
+    virtual void remove(Vehicle* vehicle) = 0;
+
+    /**
+     * @brief Fait avancer le modèle d'un pas de temps
+     * @param deltaTime Pas de temps (secondes)
+     * @param moves Mouvements effectués (ajoutés dans un ordre déterministe)
+     * @param blocked Véhicules arrêtés devant une route inutilisable (reroutage demandé)
+     * @param scheduler Ordonnanceur pour le calcul parallèle (nul = séquentiel)
+     */
+    virtual void step(float deltaTime, std::vector<VehicleMove>& moves,
+                      std::vector<Vehicle*>& blocked, TaskScheduler* scheduler = nullptr) = 0;
+
+    /**
+     * @brief Met à jour la progression et la position de rendu des véhicules
+     *
+     * Coût proportionnel au nombre de véhicules : appelée à la demande, pas à chaque pas.
+     */
+    virtual void refreshPositions(TaskScheduler* scheduler) = 0;
+
+    /**
+     * @brief Nombre de véhicules pris en charge
+     */
+    virtual size_t getVehicleCount() const = 0;
+
+    /**
+     * @brief Indique si un véhicule peut entrer maintenant sur la route (capacité, distance de sécurité)
+     */
+    virtual bool canEnter(int routeIndex) const = 0;
+
+    /**
+     * @brief Reçoit un véhicule venant d'une route gérée par un autre modèle
+     * @param vehicle Véhicule, déjà passé sur l'arête suivante de son chemin
+     * @param speed Vitesse en sortie de la route précédente (m/s)
+     */
+    virtual void acceptHandoff(Vehicle* vehicle, float speed) {
+        (void)speed;
+        enter(vehicle);
+    }
+
+    /**
+     * @brief Écrit l'état interne (ordre des véhicules, positions, horloges) dans un point de reprise
+     *
+     * Les véhicules sont désignés par leur identifiant.
+     */
+    virtual void saveState(BinaryWriter& out) const = 0;
+    
+    /**
+     * @brief Restaure l'état écrit par saveState dans un modèle vide
+     * @param findVehicle Véhicule d'identifiant donné (chemin et arête déjà restaurés ; nul si inconnu)
+     * @return Faux si les données sont incohérentes
+     */
+    virtual bool loadState(BinaryReader& in, const std::function<Vehicle*(int)>& findVehicle) = 0;
+    
+    /**
+     * @brief Restreint le modèle à une partie des routes
+     * @param other Modèle qui gère les autres routes
+     * @param ownedRoutes Masque des routes gérées (index de route -> 1), nul = toutes
+     */
+    void setPeer(TrafficDynamics* other, const std::vector<unsigned char>* ownedRoutes) {
+        peer = other;
+        owned = ownedRoutes;
+    }
+
+protected:
+    // Attente en tête de route au-delà de laquelle un véhicule force l'entrée sur une
+    // route pleine (évite les blocages circulaires définitifs) ; commune aux deux
+    // modèles pour qu'un transfert du modèle hybride suive la même règle des deux côtés
+    static constexpr float STUCK_TIME = 30.0f;
+
+    // Nombre de véhicules que la route peut contenir : la charge imposée par un
+    // événement occupe une partie de la place
+    static size_t storageCapacity(const Route& route) {
+        return static_cast<size_t>(std::max(1, route.getCapacity() - route.getInducedLoad()));
+    }
+
+    bool owns(int routeIndex) const { return !owned || (*owned)[routeIndex] != 0; }
+
+    TrafficDynamics* peer = nullptr;
+    const std::vector<unsigned char>* owned = nullptr;
+};
+
+#endif // TRAFFIC_DYNAMICS_H
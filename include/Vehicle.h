@@ -1,3 +1,6 @@
+#ifndef VEHICLE_H
+#define VEHICLE_H
+
 /**
  * @file Vehicle.h
  * @brief Représentation d'un véhicule dans la simulation
@@ -6,10 +9,8 @@
  * suit un chemin planifié et peut demander un reroutage dynamique.
  */
 
-#ifndef VEHICLE_H
-#define VEHICLE_H
-
 #include "Route.h"
+#include <cstdint>
 #include <vector>
 #include <memory>
 
@@ -26,10 +27,15 @@ private:
     int currentNode;           // Nœud actuel
     int targetNode;             // Nœud de destination
     std::vector<int> path;      // Chemin planifié
+    std::vector<int> pathRoutes; // Index des routes du chemin (pathRoutes[i] relie path[i] et path[i+1])
+    std::vector<uint32_t> routeSlots; // Rang dans l'index inverse de chaque route du chemin (tenu par Simulation)
+    unsigned int pathVersion;   // Incrémenté à chaque nouveau chemin (détection des reroutages)
     int currentRouteIndex;      // Index dans le chemin
     float progress;             // Progression sur la route actuelle (0.0 à 1.0)
     float speed;                // Vitesse actuelle
     bool needsRerouting;        // Flag indiquant si un reroutage est nécessaire
+    float departureTime;        // Instant d'apparition (s)
+    float freeFlowTime;         // Parcours à vide (vitesse de base) du chemin planifié au départ (s)
     
     // Position pour la visualisation
     float x, y;
@@ -49,9 +55,42 @@ public:
     int getVehicleType() const { return vehicleType; }
     bool needsReroutingCheck() const { return needsRerouting; }
     
+    int getCurrentRouteIndex() const { return currentRouteIndex; }
+    float getDepartureTime() const { return departureTime; }
+    float getFreeFlowTime() const { return freeFlowTime; }
+    
+    // Référence des statistiques de trajet (temps de parcours, retard)
+    void setDeparture(float time, float freeFlow) { departureTime = time; freeFlowTime = freeFlow; }
+    float getProgress() const { return progress; }
+    
+    /**
+     * @brief Fixe la progression sur la route actuelle (bornée à [0, 1])
+     * 
+     * Utilisé par les modèles de trafic qui gèrent eux-mêmes le mouvement (QueueModel).
+     */
+    void setProgress(float value);
+    
+    /**
+     * @brief Passe à l'arête suivante du chemin (progression remise à zéro)
+     */
+    void advanceToNextRoute();
+    
+    /**
+     * @brief Replace le véhicule sur l'arête edge de son chemin (restauration d'un point de reprise)
+     */
+    void restoreState(int node, int edge, float edgeProgress, bool rerouting);
+    void restorePosition(float savedX, float savedY, float savedAngle);
+    
     // Planification de trajet
     void setPath(const std::vector<int>& newPath);
+    void setPath(const std::vector<int>& newPath, const class Graph& graph);
     const std::vector<int>& getPath() const { return path; }
+    const std::vector<int>& getPathRoutes() const { return pathRoutes; }
+    unsigned int getPathVersion() const { return pathVersion; }
+    
+    // Rang du véhicule dans la liste des usagers de la route de l'arête edge (retrait en O(1))
+    uint32_t getRouteSlot(size_t edge) const { return routeSlots[edge]; }
+    void setRouteSlot(size_t edge, uint32_t slot) { routeSlots[edge] = slot; }
     
     // Mise à jour de la position
     void update(float deltaTime, const class Graph& graph);
@@ -65,6 +104,10 @@ public:
     
     // Calcul de la position visuelle
     void calculatePosition(const class Graph& graph);
+    
+private:
+    // Résolution des index de routes du chemin (une seule fois par chemin)
+    void resolvePathRoutes(const class Graph& graph);
 };
 
 #endif // VEHICLE_H
@@ -0,0 +1,102 @@
+#ifndef WHAT_IF_PREVIEW_H
+#define WHAT_IF_PREVIEW_H
+
+/**
+ * @file WhatIfPreview.h
+ * @brief Aperçu de l'impact d'un incident avant de l'appliquer
+ *
+ * Deux copies de la simulation (Simulation::fork) sont avancées sans rendu
+ * sur un thread de travail : l'une telle quelle, l'autre avec l'incident.
+ * Partant du même état et du même générateur aléatoire, sans nouvel
+ * événement aléatoire (les événements en cours suivent leur cours), elles
+ * ne diffèrent que par l'incident ; l'écart de leurs indicateurs en mesure
+ * l'impact.
+ * La simulation d'origine n'est lue qu'au lancement et continue pendant
+ * le calcul.
+ */
+
+#include "Event.h"
+#include "KpiCollector.h"
+#include <atomic>
+#include <memory>
+#include <thread>
+
+class Simulation;
+
+/**
+ * @struct IncidentSpec
+ * @brief Incident à évaluer (mêmes paramètres que Simulation::addEvent)
+ */
+struct IncidentSpec {
+    EventType type;
+    int routeId;
+    float severity;
+    float duration;
+};
+
+/**
+ * @struct WhatIfReport
+ * @brief Résultat d'un aperçu
+ */
+struct WhatIfReport {
+    IncidentSpec incident;
+    float horizon;                   // Temps simulé couvert (s)
+    TripIndicators baseline;         // Sans l'incident
+    TripIndicators withIncident;
+    int baselineReroutings;
+    int incidentReroutings;
+    float delayPerTrip;              // Écart de temps de parcours moyen (s), positif = plus lent
+    int lostTrips;                   // Trajets terminés en moins sur l'horizon
+    double setupTime;                // Copie de l'état, dans le thread appelant (s)
+    double runTime;                  // Calcul sur le thread de travail (s)
+    bool completed;                  // Faux si annulé ou si la copie a échoué
+};
+
+/**
+ * @class WhatIfPreview
+ * @brief Calcul d'un aperçu à la fois, sur son propre thread
+ */
+class WhatIfPreview {
+public:
+    static constexpr float DEFAULT_HORIZON = 900.0f;   // 15 minutes simulées
+
+    WhatIfPreview();
+    ~WhatIfPreview();
+
+    WhatIfPreview(const WhatIfPreview&) = delete;
+    WhatIfPreview& operator=(const WhatIfPreview&) = delete;
+
+    /**
+     * @brief Copie l'état courant puis lance le calcul en arrière-plan
+     * @return Faux si un aperçu est déjà en cours ou si la copie a échoué
+     *
+     * À appeler depuis le thread qui exécute Simulation::update.
+     */
+    bool start(const Simulation& simulation, const IncidentSpec& incident, float horizon = DEFAULT_HORIZON);
+
+    bool isRunning() const { return worker.joinable() && !done.load(std::memory_order_acquire); }
+
+    // Vrai une fois le calcul terminé, jusqu'au prochain start
+    bool isReady() const { return done.load(std::memory_order_acquire); }
+
+    /**
+     * @brief Attend la fin du calcul en cours
+     * @return Rapport du dernier aperçu (completed = faux s'il a été annulé)
+     */
+    const WhatIfReport& wait();
+
+    // Interrompt le calcul en cours au prochain tick des copies
+    void cancel();
+
+private:
+    std::thread worker;
+    std::atomic<bool> done;
+    std::atomic<bool> cancelled;
+    std::unique_ptr<Simulation> baseline;
+    std::unique_ptr<Simulation> incident;
+    WhatIfReport report;
+
+    void run();
+};
+
+#endif // WHAT_IF_PREVIEW_H
@@ -0,0 +1,188 @@
+#include "BatchRunner.h"
+#include "KpiCollector.h"
+#include "PathfindingStrategy.h"
+#include "TaskScheduler.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <fstream>
+#include <iostream>
+
+namespace {
+
+const char* modeName(SimulationMode mode) {
+    return mode == SimulationMode::DYNAMIC ? "DYNAMIC" : "NORMAL";
+}
+
+const char* strategyName(PathfindingAlgorithm strategy) {
+    return strategy == PathfindingAlgorithm::DIJKSTRA ? "DIJKSTRA" : "ASTAR";
+}
+
+std::unique_ptr<PathfindingStrategy> makeStrategy(PathfindingAlgorithm strategy) {
+    if (strategy == PathfindingAlgorithm::DIJKSTRA) {
+        return std::make_unique<DijkstraStrategy>();
+    }
+    return std::make_unique<AStarStrategy>();
+}
+
+// Moyenne et demi-largeur de l'intervalle de confiance à 95 % (approximation normale)
+void writeStatistic(std::ofstream& file, const std::vector<double>& values) {
+    double mean = 0.0;
+    for (double value : values) {
+        mean += value;
+    }
+    mean /= values.size();
+    double variance = 0.0;
+    for (double value : values) {
+        variance += (value - mean) * (value - mean);
+    }
+    double halfWidth = 0.0;
+    if (values.size() > 1) {
+        halfWidth = 1.96 * std::sqrt(variance / (values.size() - 1)) / std::sqrt(static_cast<double>(values.size()));
+    }
+    file << ',' << mean << ',' << halfWidth;
+}
+
+} // namespace
+
+BatchRunner::BatchRunner(const std::string& configPath)
+    : BatchRunner(Simulation::loadTopology(configPath)) {
+}
+
+BatchRunner::BatchRunner(std::shared_ptr<const RoadNetwork> topology)
+    : topology(std::move(topology)), threadCount(0), duration(600.0f), timeStep(Simulation::FIXED_TIME_STEP) {
+}
+
+std::vector<ScenarioParameters> BatchRunner::expandGrid(const ScenarioGrid& grid) {
+    std::vector<ScenarioParameters> scenarios;
+    for (int vehicleCount : grid.vehicleCounts) {
+        for (float eventInterval : grid.eventIntervals) {
+            for (SimulationMode mode : grid.modes) {
+                for (PathfindingAlgorithm strategy : grid.strategies) {
+                    for (unsigned int seed : grid.seeds) {
+                        scenarios.push_back(ScenarioParameters{vehicleCount, eventInterval, mode, strategy, seed});
+                    }
+                }
+            }
+        }
+    }
+    return scenarios;
+}
+
+const std::vector<ScenarioResult>& BatchRunner::run(const std::vector<ScenarioParameters>& scenarios) {
+    results.assign(scenarios.size(), ScenarioResult{});
+    // Un scénario par tâche : chaque simulation tourne sur un seul thread
+    TaskScheduler pool(threadCount);
+    pool.parallelFor(scenarios.size(), 1, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; i++) {
+            results[i] = runScenario(scenarios[i]);
+        }
+    });
+    return results;
+}
+
+ScenarioResult BatchRunner::runScenario(const ScenarioParameters& parameters) const {
+    auto wallStart = std::chrono::steady_clock::now();
+
+    // Un seul thread, véhicules créés une fois (au nombre du scénario), sans messages par scénario
+    Simulation simulation(1);
+    simulation.setVerbose(false);
+    simulation.setSeed(parameters.seed);
+    simulation.setMode(parameters.mode);
+    simulation.setEventInterval(parameters.eventInterval);
+    simulation.setPathfindingStrategy(makeStrategy(parameters.strategy));
+    simulation.setVehicleCount(parameters.vehicleCount);
+    simulation.initialize(topology);
+
+    KpiCollector collector;
+    collector.start(simulation);
+    simulation.addTickObserver([&collector](const Simulation& current) { collector.observe(current); });
+    int steps = static_cast<int>(std::ceil(duration / timeStep - 1e-3f));
+    for (int step = 0; step < steps; step++) {
+        simulation.update(timeStep);
+    }
+
+    TripIndicators indicators = collector.getIndicators(simulation.getSimulationTime());
+    ScenarioResult result{};
+    result.parameters = parameters;
+    result.completedTrips = indicators.completedTrips;
+    result.meanTravelTime = indicators.meanTravelTime;
+    result.maxTravelTime = indicators.maxTravelTime;
+    result.throughput = indicators.throughput;
+    result.meanActiveVehicles = indicators.meanActiveVehicles;
+    result.congestedShare = indicators.congestedShare;
+    result.reroutings = simulation.getTotalReroutings();
+    result.wallTime = std::chrono::duration<double>(std::chrono::steady_clock::now() - wallStart).count();
+    return result;
+}
+
+bool BatchRunner::writeResults(const std::string& path) const {
+    std::ofstream file(path, std::ios::trunc);
+    if (!file) {
+        std::cout << "ERREUR: impossible d'ecrire les resultats: " << path << std::endl;
+        return false;
+    }
+    file << "vehicle_count,event_interval,mode,strategy,runs";
+    for (const char* name : {"completed_trips", "mean_travel_time", "max_travel_time", "throughput",
+                             "reroutings", "mean_active_vehicles", "congested_share", "wall_time"}) {
+        file << ',' << name << ',' << name << "_ci95";
+    }
+    file << '\n';
+
+    // Regroupement des graines d'une même combinaison, dans l'ordre de première apparition
+    std::vector<bool> written(results.size(), false);
+    for (size_t i = 0; i < results.size(); i++) {
+        if (written[i]) {
+            continue;
+        }
+        const ScenarioParameters& key = results[i].parameters;
+        std::vector<const ScenarioResult*> group;
+        for (size_t j = i; j < results.size(); j++) {
+            const ScenarioParameters& other = results[j].parameters;
+            if (!written[j] && other.vehicleCount == key.vehicleCount && other.eventInterval == key.eventInterval &&
+                other.mode == key.mode && other.strategy == key.strategy) {
+                group.push_back(&results[j]);
+                written[j] = true;
+            }
+        }
+
+        file << key.vehicleCount << ',' << key.eventInterval << ',' << modeName(key.mode) << ','
+             << strategyName(key.strategy) << ',' << group.size();
+        auto column = [&group](auto field) {
+            std::vector<double> values;
+            for (const ScenarioResult* result : group) {
+                values.push_back(static_cast<double>(field(*result)));
+            }
+            return values;
+        };
+        writeStatistic(file, column([](const ScenarioResult& r) { return r.completedTrips; }));
+        writeStatistic(file, column([](const ScenarioResult& r) { return r.meanTravelTime; }));
+        writeStatistic(file, column([](const ScenarioResult& r) { return r.maxTravelTime; }));
+        writeStatistic(file, column([](const ScenarioResult& r) { return r.throughput; }));
+        writeStatistic(file, column([](const ScenarioResult& r) { return r.reroutings; }));
+        writeStatistic(file, column([](const ScenarioResult& r) { return r.meanActiveVehicles; }));
+        writeStatistic(file, column([](const ScenarioResult& r) { return r.congestedShare; }));
+        writeStatistic(file, column([](const ScenarioResult& r) { return r.wallTime; }));
+        file << '\n';
+    }
+    return static_cast<bool>(file);
+}
+
+bool BatchRunner::writeRuns(const std::string& path) const {
+    std::ofstream file(path, std::ios::trunc);
+    if (!file) {
+        std::cout << "ERREUR: impossible d'ecrire les resultats: " << path << std::endl;
+        return false;
+    }
+    file << "vehicle_count,event_interval,mode,strategy,seed,completed_trips,mean_travel_time,max_travel_time,"
+            "throughput,reroutings,mean_active_vehicles,congested_share,wall_time\n";
+    for (const ScenarioResult& result : results) {
+        const ScenarioParameters& p = result.parameters;
+        file << p.vehicleCount << ',' << p.eventInterval << ',' << modeName(p.mode) << ','
+             << strategyName(p.strategy) << ',' << p.seed << ',' << result.completedTrips << ','
+             << result.meanTravelTime << ',' << result.maxTravelTime << ',' << result.throughput << ','
+             << result.reroutings << ',' << result.meanActiveVehicles << ',' << result.congestedShare << ','
+             << result.wallTime << '\n';
+    }
+    return static_cast<bool>(file);
+}
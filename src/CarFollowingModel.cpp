@@ -0,0 +1,340 @@
+#include "CarFollowingModel.h"
+#include "Vehicle.h"
+#include "TaskScheduler.h"
+#include <algorithm>
+#include <cmath>
+#include <functional>
+
+void CarFollowingModel::Lane::insert(Vehicle* vehicle, float atPosition, float atSpeed) {
+    // Les entrants arrivent en général en fin de voie : recherche depuis la fin
+    size_t index = vehicles.size();
+    while (index > 0 && position[index - 1] < atPosition) {
+        index--;
+    }
+    vehicles.insert(vehicles.begin() + index, vehicle);
+    position.insert(position.begin() + index, atPosition);
+    speed.insert(speed.begin() + index, atSpeed);
+}
+
+void CarFollowingModel::Lane::erase(size_t index) {
+    vehicles.erase(vehicles.begin() + index);
+    position.erase(position.begin() + index);
+    speed.erase(speed.begin() + index);
+}
+
+CarFollowingModel::CarFollowingModel(const Graph* graph) : graph(graph) {
+    reset();
+}
+
+void CarFollowingModel::reset() {
+    lanes.assign(graph->getRoutes().size(), Lane());
+    laneByVehicle.clear();
+}
+
+float CarFollowingModel::desiredSpeed(int routeIndex) const {
+    return std::max(1.0f, graph->getRoutes()[routeIndex]->getCurrentSpeed() / 3.6f);
+}
+
+void CarFollowingModel::enter(Vehicle* vehicle, float remainingFraction) {
+    const auto& pathRoutes = vehicle->getPathRoutes();
+    size_t edge = vehicle->getCurrentRouteIndex();
+    if (edge >= pathRoutes.size() || pathRoutes[edge] < 0 || vehicle->hasReachedDestination()) {
+        return;
+    }
+    if (laneByVehicle.count(vehicle)) {
+        remove(vehicle);
+    }
+    int routeIndex = pathRoutes[edge];
+    float length = graph->getRoutes()[routeIndex]->getLength();
+    float fraction = 1.0f - std::max(0.0f, std::min(1.0f, remainingFraction));
+    lanes[routeIndex].insert(vehicle, fraction * length, 0.0f);
+    laneByVehicle[vehicle] = routeIndex;
+}
+
+bool CarFollowingModel::canEnter(int routeIndex) const {
+    const Lane& lane = lanes[routeIndex];
+    return lane.vehicles.size() < storageCapacity(*graph->getRoutes()[routeIndex]) &&
+           (lane.vehicles.empty() || lane.position.back() >= VEHICLE_LENGTH + MIN_GAP);
+}
+
+void CarFollowingModel::acceptHandoff(Vehicle* vehicle, float speed) {
+    const auto& pathRoutes = vehicle->getPathRoutes();
+    int routeIndex = pathRoutes[vehicle->getCurrentRouteIndex()];
+    Lane& lane = lanes[routeIndex];
+    float entry = 0.0f;
+    float entrySpeed = std::min(speed, desiredSpeed(routeIndex));
+    if (!lane.vehicles.empty()) {
+        // Entrée derrière le dernier véhicule (en amont du début de route si la file déborde)
+        entry = std::min(0.0f, lane.position.back() - VEHICLE_LENGTH - MIN_GAP);
+        entrySpeed = std::min(entrySpeed, lane.speed.back());
+    }
+    lane.insert(vehicle, entry, entrySpeed);
+    laneByVehicle[vehicle] = routeIndex;
+}
+
+void CarFollowingModel::getRouteVehicles(int routeIndex, std::vector<Vehicle*>& out) const {
+    const auto& vehicles = lanes[routeIndex].vehicles;
+    out.insert(out.end(), vehicles.begin(), vehicles.end());
+}
+
+void CarFollowingModel::remove(Vehicle* vehicle) {
+    auto it = laneByVehicle.find(vehicle);
+    if (it == laneByVehicle.end()) {
+        return;
+    }
+    Lane& lane = lanes[it->second];
+    auto found = std::find(lane.vehicles.begin(), lane.vehicles.end(), vehicle);
+    if (found != lane.vehicles.end()) {
+        if (found == lane.vehicles.begin()) {
+            lane.headWait = 0.0f;
+        }
+        lane.erase(found - lane.vehicles.begin());
+    }
+    laneByVehicle.erase(it);
+}
+
+bool CarFollowingModel::nextRouteClosed(int nextRoute, const Lane& lane) const {
+    if (lane.headWait >= STUCK_TIME) {
+        return false;
+    }
+    if (owns(nextRoute)) {
+        return lanes[nextRoute].vehicles.size() >= storageCapacity(*graph->getRoutes()[nextRoute]);
+    }
+    return !peer->canEnter(nextRoute);  // Route gérée par le modèle voisin
+}
+
+void CarFollowingModel::computeAccelerations(const float* speed, const float* gap, const float* approach,
+                                             float desiredSpeed, float* acceleration, size_t count) {
+    const float maxAcceleration = MAX_ACCELERATION;
+    const float maxBraking = -MAX_BRAKING;
+    const float inverseBraking = 1.0f / (2.0f * std::sqrt(MAX_ACCELERATION * COMFORT_BRAKING));
+    const float inverseDesired = 1.0f / desiredSpeed;
+    // Boucle sans branchement ni dépendance entre itérations : vectorisée par le compilateur
+    for (size_t i = 0; i < count; i++) {
+        float ratio = speed[i] * inverseDesired;
+        float ratio2 = ratio * ratio;
+        float dynamicGap = speed[i] * (TIME_HEADWAY + approach[i] * inverseBraking);
+        // max(0, x) écrit sans comparaison : une sélection avant la division empêcherait
+        // la vectorisation (la division ne peut pas être spéculée sans -fno-trapping-math)
+        float desiredGap = MIN_GAP + 0.5f * (dynamicGap + std::fabs(dynamicGap));
+        float gapRatio = desiredGap / gap[i];
+        float value = maxAcceleration * (1.0f - ratio2 * ratio2 - gapRatio * gapRatio);
+        value = value > maxBraking ? value : maxBraking;
+        acceleration[i] = value < maxAcceleration ? value : maxAcceleration;
+    }
+}
+
+void CarFollowingModel::computeLane(int routeIndex) {
+    Lane& lane = lanes[routeIndex];
+    size_t count = lane.vehicles.size();
+    lane.acceleration.resize(count);
+    if (count == 0) {
+        return;
+    }
+
+    const Route* route = graph->getRoutes()[routeIndex].get();
+    if (!route->isUsable()) {
+        // Route bloquée : arrêt de tous les véhicules
+        std::fill(lane.acceleration.begin(), lane.acceleration.end(), -MAX_BRAKING);
+        return;
+    }
+
+    lane.gap.resize(count);
+    lane.approach.resize(count);
+    const float farAway = 1.0e6f;
+    float length = route->getLength();
+
+    // Prédécesseur de la tête : dernier véhicule de la route suivante, ou obstacle en bout de route
+    const Vehicle* head = lane.vehicles[0];
+    const auto& pathRoutes = head->getPathRoutes();
+    int edge = head->getCurrentRouteIndex();
+    int nextRoute = (edge + 1 < static_cast<int>(pathRoutes.size())) ? pathRoutes[edge + 1] : -1;
+    float toEnd = length - lane.position[0];
+    lane.gap[0] = farAway;
+    lane.approach[0] = 0.0f;
+    if (nextRoute >= 0) {
+        const Lane& next = lanes[nextRoute];
+        bool closed = !graph->getRoutes()[nextRoute]->isUsable() || nextRouteClosed(nextRoute, lane);
+        if (closed) {
+            lane.gap[0] = toEnd;
+            lane.approach[0] = lane.speed[0];
+        } else if (owns(nextRoute) && !next.vehicles.empty()) {
+            lane.gap[0] = toEnd + next.position.back() - VEHICLE_LENGTH;
+            lane.approach[0] = lane.speed[0] - next.speed.back();
+        }
+    }
+
+    for (size_t i = 1; i < count; i++) {
+        lane.gap[i] = lane.position[i - 1] - lane.position[i] - VEHICLE_LENGTH;
+        lane.approach[i] = lane.speed[i] - lane.speed[i - 1];
+    }
+    for (size_t i = 0; i < count; i++) {
+        lane.gap[i] = std::max(0.1f, lane.gap[i]);
+    }
+
+    computeAccelerations(lane.speed.data(), lane.gap.data(), lane.approach.data(),
+                         desiredSpeed(routeIndex), lane.acceleration.data(), count);
+}
+
+void CarFollowingModel::integrateLane(int routeIndex, float deltaTime) {
+    Lane& lane = lanes[routeIndex];
+    size_t count = lane.vehicles.size();
+    for (size_t i = 0; i < count; i++) {
+        float newSpeed = std::max(0.0f, lane.speed[i] + lane.acceleration[i] * deltaTime);
+        // Pas balistique : distance parcourue à la vitesse moyenne du pas, jamais en arrière
+        lane.position[i] += 0.5f * (lane.speed[i] + newSpeed) * deltaTime;
+        lane.speed[i] = newSpeed;
+    }
+    // Pas de dépassement : l'ordre de la voie est conservé
+    for (size_t i = 1; i < count; i++) {
+        lane.position[i] = std::min(lane.position[i], lane.position[i - 1]);
+    }
+}
+
+void CarFollowingModel::step(float deltaTime, std::vector<VehicleMove>& moves,
+                             std::vector<Vehicle*>& blocked, TaskScheduler* scheduler) {
+    // Accélérations de toutes les voies (lecture seule des voies voisines), puis intégration
+    auto forEachLane = [&](const std::function<void(int)>& work) {
+        auto body = [&](size_t begin, size_t end) {
+            for (size_t r = begin; r < end; r++) {
+                work(static_cast<int>(r));
+            }
+        };
+        if (scheduler) {
+            scheduler->parallelFor(lanes.size(), 64, body);
+        } else {
+            body(0, lanes.size());
+        }
+    };
+    forEachLane([this](int r) { computeLane(r); });
+    forEachLane([this, deltaTime](int r) { integrateLane(r, deltaTime); });
+
+    // Transferts entre routes dans l'ordre des index : résultat déterministe
+    const auto& routes = graph->getRoutes();
+    for (size_t r = 0; r < lanes.size(); r++) {
+        Lane& lane = lanes[r];
+        if (lane.vehicles.empty()) {
+            lane.headWait = 0.0f;
+            continue;
+        }
+        if (!routes[r]->isUsable()) {
+            for (Vehicle* vehicle : lane.vehicles) {
+                if (!vehicle->needsReroutingCheck()) {
+                    vehicle->requestRerouting();
+                    blocked.push_back(vehicle);
+                }
+            }
+            continue;
+        }
+
+        float length = routes[r]->getLength();
+        while (!lane.vehicles.empty() && lane.position[0] >= length) {
+            Vehicle* vehicle = lane.vehicles[0];
+            const auto& pathRoutes = vehicle->getPathRoutes();
+            int edge = vehicle->getCurrentRouteIndex();
+            int nextRoute = (edge + 1 < static_cast<int>(pathRoutes.size())) ? pathRoutes[edge + 1] : -1;
+
+            if (nextRoute >= 0) {
+                bool usable = routes[nextRoute]->isUsable();
+                bool full = nextRouteClosed(nextRoute, lane);
+                if (!usable || full) {
+                    if (!usable && !vehicle->needsReroutingCheck()) {
+                        vehicle->requestRerouting();
+                        blocked.push_back(vehicle);
+                    }
+                    // Arrêt à la ligne de fin de route
+                    lane.position[0] = length;
+                    lane.speed[0] = 0.0f;
+                    break;
+                }
+            }
+
+            float overflow = lane.position[0] - length;
+            float speed = lane.speed[0];
+            lane.erase(0);
+            lane.headWait = 0.0f;
+            vehicle->advanceToNextRoute();
+            moves.push_back(VehicleMove{vehicle, edge});
+
+            if (nextRoute >= 0 && !vehicle->hasReachedDestination() && !owns(nextRoute)) {
+                laneByVehicle.erase(vehicle);
+                peer->acceptHandoff(vehicle, speed);
+            } else if (nextRoute >= 0 && !vehicle->hasReachedDestination()) {
+                Lane& next = lanes[nextRoute];
+                float entry = next.vehicles.empty() ? overflow : std::min(overflow, next.position.back());
+                next.insert(vehicle, entry, speed);
+                laneByVehicle[vehicle] = nextRoute;
+            } else {
+                laneByVehicle.erase(vehicle);  // Arrivé (ou fin de chemin résolu)
+            }
+        }
+
+        // Temps d'arrêt de la tête en bout de route (blocage par une route pleine) ;
+        // au-delà de STUCK_TIME il continue de courir jusqu'au transfert
+        bool atEnd = !lane.vehicles.empty() && lane.position[0] >= length - MIN_GAP - 1.0f;
+        if (atEnd && (lane.speed[0] < 0.1f || lane.headWait >= STUCK_TIME)) {
+            lane.headWait += deltaTime;
+        } else {
+            lane.headWait = 0.0f;
+        }
+    }
+}
+
+void CarFollowingModel::saveState(BinaryWriter& out) const {
+    out.writeVarint(lanes.size());
+    for (const Lane& lane : lanes) {
+        out.writeFloat(lane.headWait);
+        out.writeVarint(lane.vehicles.size());
+        for (size_t i = 0; i < lane.vehicles.size(); i++) {
+            out.writeVarint(lane.vehicles[i]->getId());
+            out.writeFloat(lane.position[i]);
+            out.writeFloat(lane.speed[i]);
+        }
+    }
+}
+
+bool CarFollowingModel::loadState(BinaryReader& in, const std::function<Vehicle*(int)>& findVehicle) {
+    if (in.readCount() != lanes.size()) {
+        return false;
+    }
+    for (size_t r = 0; r < lanes.size(); r++) {
+        Lane& lane = lanes[r];
+        lane.headWait = in.readFloat();
+        size_t count = in.readCount();
+        for (size_t i = 0; i < count; i++) {
+            Vehicle* vehicle = findVehicle(static_cast<int>(in.readVarint()));
+            float position = in.readFloat();
+            float speed = in.readFloat();
+            if (!vehicle || laneByVehicle.count(vehicle)) {
+                return false;
+            }
+            // Ordre sauvegardé = ordre de la voie (positions décroissantes, égalités comprises)
+            lane.vehicles.push_back(vehicle);
+            lane.position.push_back(position);
+            lane.speed.push_back(speed);
+            laneByVehicle[vehicle] = static_cast<int>(r);
+        }
+    }
+    return in.ok();
+}
+
+void CarFollowingModel::refreshPositions(TaskScheduler* scheduler) {
+    auto refresh = [this](size_t begin, size_t end) {
+        for (size_t r = begin; r < end; r++) {
+            const Lane& lane = lanes[r];
+            if (lane.vehicles.empty()) {
+                continue;
+            }
+            float length = graph->getRoutes()[r]->getLength();
+            for (size_t i = 0; i < lane.vehicles.size(); i++) {
+                lane.vehicles[i]->setProgress(lane.position[i] / length);
+                lane.vehicles[i]->calculatePosition(*graph);
+            }
+        }
+    };
+    if (scheduler) {
+        scheduler->parallelFor(lanes.size(), 256, refresh);
+    } else {
+        refresh(0, lanes.size());
+    }
+}
@@ -0,0 +1,206 @@
+#include "CityGenerator.h"
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
+namespace {
+// Au-delà, deux cellules voisines de la grille déformée pourraient devenir concaves
+constexpr float MAX_JITTER = 0.25f;
+constexpr float PI = 3.14159265358979f;
+
+/**
+ * @brief Ajoute nœuds et routes numérotés dans l'ordre de création
+ */
+class NetworkBuilder {
+public:
+    NetworkBuilder(RoadNetwork& network, const CityOptions& options, size_t nodeCount, size_t routeCount)
+        : network(network), options(options), rng(options.seed),
+          jitter(std::min(std::max(options.jitter, 0.0f), MAX_JITTER) * options.spacing),
+          offset(-jitter, jitter) {
+        xs.reserve(nodeCount);
+        ys.reserve(nodeCount);
+        network.reserve(nodeCount, routeCount);
+    }
+
+    void addNode(float x, float y) {
+        if (jitter > 0.0f) {
+            x += offset(rng);
+            y += offset(rng);
+        }
+        network.addNode(static_cast<int>(xs.size()), x, y);
+        xs.push_back(x);
+        ys.push_back(y);
+    }
+
+    void addRoute(int from, int to, bool arterial) {
+        const RoadClass& roadClass = arterial ? options.arterial : options.local;
+        network.addRoute(nextRouteId++, from, to, distance(from, to), roadClass.speed, roadClass.capacity);
+    }
+
+    float distance(int from, int to) const {
+        float dx = xs[to] - xs[from];
+        float dy = ys[to] - ys[from];
+        return std::sqrt(dx * dx + dy * dy);
+    }
+
+    std::mt19937& random() { return rng; }
+
+private:
+    RoadNetwork& network;
+    const CityOptions& options;
+    std::mt19937 rng;
+    float jitter;
+    std::uniform_real_distribution<float> offset;
+    std::vector<float> xs;
+    std::vector<float> ys;
+    int nextRouteId = 0;
+};
+
+int gridSide(int nodeCount) {
+    return std::max(2, static_cast<int>(std::lround(std::sqrt(static_cast<double>(nodeCount)))));
+}
+
+bool isArterial(int index, int interval) {
+    return interval > 0 && index % interval == 0;
+}
+
+// Rues horizontales (ligne par ligne) puis verticales d'une grille side x side
+void addGridStreets(NetworkBuilder& builder, int side, int arterialInterval) {
+    for (int row = 0; row < side; row++) {
+        for (int col = 0; col + 1 < side; col++) {
+            builder.addRoute(row * side + col, row * side + col + 1, isArterial(row, arterialInterval));
+        }
+    }
+    for (int row = 0; row + 1 < side; row++) {
+        for (int col = 0; col < side; col++) {
+            builder.addRoute(row * side + col, (row + 1) * side + col, isArterial(col, arterialInterval));
+        }
+    }
+}
+
+void addGridNodes(NetworkBuilder& builder, int side, float spacing) {
+    for (int row = 0; row < side; row++) {
+        for (int col = 0; col < side; col++) {
+            builder.addNode(col * spacing, row * spacing);
+        }
+    }
+}
+}
+
+std::shared_ptr<RoadNetwork> CityGenerator::generate(const CityOptions& options) {
+    auto network = std::make_shared<RoadNetwork>();
+    switch (options.layout) {
+        case CityLayout::GRID:
+            generateGrid(*network, options);
+            break;
+        case CityLayout::RADIAL:
+            generateRadial(*network, options);
+            break;
+        case CityLayout::PLANAR:
+            generatePlanar(*network, options);
+            break;
+    }
+    return network;
+}
+
+void CityGenerator::generateGrid(RoadNetwork& network, const CityOptions& options) {
+    int side = gridSide(options.nodeCount);
+    size_t nodeCount = static_cast<size_t>(side) * side;
+    NetworkBuilder builder(network, options, nodeCount, 2 * static_cast<size_t>(side) * (side - 1));
+    addGridNodes(builder, side, options.spacing);
+    addGridStreets(builder, side, options.arterialInterval);
+}
+
+void CityGenerator::generateRadial(RoadNetwork& network, const CityOptions& options) {
+    // Anneau r : spokes * r nœuds au rayon r * spacing (écart le long de l'anneau à peu près constant)
+    const int spokes = std::max(3, options.spokes);
+    auto countUpTo = [spokes](long long rings) { return 1 + spokes * rings * (rings + 1) / 2; };
+    int rings = 1;
+    while (countUpTo(rings) < options.nodeCount) {
+        rings++;
+    }
+    if (rings > 1 && options.nodeCount - countUpTo(rings - 1) < countUpTo(rings) - options.nodeCount) {
+        rings--;
+    }
+    auto ringStart = [spokes](int ring) { return 1 + spokes * (ring - 1) * ring / 2; };
+
+    NetworkBuilder builder(network, options, static_cast<size_t>(countUpTo(rings)),
+                           static_cast<size_t>(spokes) * rings * (rings + 1));
+    builder.addNode(0.0f, 0.0f);
+    for (int ring = 1; ring <= rings; ring++) {
+        int count = spokes * ring;
+        float radius = ring * options.spacing;
+        for (int j = 0; j < count; j++) {
+            float angle = 2.0f * PI * j / count;
+            builder.addNode(radius * std::cos(angle), radius * std::sin(angle));
+        }
+    }
+
+    for (int ring = 1; ring <= rings; ring++) {
+        int start = ringStart(ring);
+        int count = spokes * ring;
+        for (int j = 0; j < count; j++) {
+            builder.addRoute(start + j, start + (j + 1) % count, isArterial(ring, options.arterialInterval));
+        }
+        // Chaque nœud rejoint le nœud d'angle le plus proche de l'anneau intérieur (correspondance
+        // croissante : les rayons ne se croisent pas) ; j multiple de ring est sur un rayon principal
+        int innerCount = spokes * (ring - 1);
+        for (int j = 0; j < count; j++) {
+            int inner = 0;
+            if (ring > 1) {
+                int nearest = (2 * j * (ring - 1) + ring) / (2 * ring);
+                inner = ringStart(ring - 1) + nearest % innerCount;
+            }
+            builder.addRoute(inner, start + j, options.arterialInterval > 0 && j % ring == 0);
+        }
+    }
+}
+
+void CityGenerator::generatePlanar(RoadNetwork& network, const CityOptions& options) {
+    // Grille déformée (cellules convexes) dont une partie des cellules est coupée par sa
+    // diagonale la plus courte, comme le ferait une triangulation de Delaunay
+    int side = gridSide(options.nodeCount);
+    size_t nodeCount = static_cast<size_t>(side) * side;
+    size_t cells = static_cast<size_t>(side - 1) * (side - 1);
+    NetworkBuilder builder(network, options, nodeCount, 2 * static_cast<size_t>(side) * (side - 1) + cells);
+    addGridNodes(builder, side, options.spacing);
+    addGridStreets(builder, side, options.arterialInterval);
+
+    std::bernoulli_distribution cut(std::min(std::max(options.diagonalRatio, 0.0f), 1.0f));
+    for (int row = 0; row + 1 < side; row++) {
+        for (int col = 0; col + 1 < side; col++) {
+            if (!cut(builder.random())) {
+                continue;
+            }
+            int topLeft = row * side + col;
+            int bottomRight = topLeft + side + 1;
+            int topRight = topLeft + 1;
+            int bottomLeft = topLeft + side;
+            if (builder.distance(topLeft, bottomRight) <= builder.distance(topRight, bottomLeft)) {
+                builder.addRoute(topLeft, bottomRight, false);
+            } else {
+                builder.addRoute(topRight, bottomLeft, false);
+            }
+        }
+    }
+}
+
+bool CityGenerator::parseLayout(const std::string& name, CityLayout& layout) {
+    for (CityLayout candidate : {CityLayout::GRID, CityLayout::RADIAL, CityLayout::PLANAR}) {
+        if (name == getLayoutName(candidate)) {
+            layout = candidate;
+            return true;
+        }
+    }
+    return false;
+}
+
+const char* CityGenerator::getLayoutName(CityLayout layout) {
+    switch (layout) {
+        case CityLayout::GRID: return "grid";
+        case CityLayout::RADIAL: return "radial";
+        case CityLayout::PLANAR: return "planar";
+    }
+    return "grid";
+}
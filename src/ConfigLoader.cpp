@@ -0,0 +1,385 @@
+#include "ConfigLoader.h"
+#include <cctype>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+
+namespace {
+constexpr size_t MAX_TOKEN = 64;    // Clés, nombres et valeurs texte ; au-delà, les chaînes sont tronquées
+
+/**
+ * @class JsonStream
+ * @brief Lecture caractère par caractère d'un fichier JSON par blocs de BUFFER_SIZE octets
+ *
+ * Les méthodes renvoient faux à la première erreur, dont le message (avec
+ * le numéro de ligne) est gardé dans error.
+ */
+class JsonStream {
+public:
+    std::string error;
+
+    JsonStream(std::ifstream& file, std::vector<char>& buffer) : file(file), buffer(buffer) {}
+
+    int peek() {
+        if (pos == end && !refill()) {
+            return EOF;
+        }
+        return static_cast<unsigned char>(buffer[pos]);
+    }
+
+    int get() {
+        int c = peek();
+        if (c != EOF) {
+            pos++;
+            if (c == '\n') {
+                line++;
+            }
+        }
+        return c;
+    }
+
+    void skipWhitespace() {
+        for (int c = peek(); c == ' ' || c == '\t' || c == '\r' || c == '\n'; c = peek()) {
+            get();
+        }
+    }
+
+    bool atEnd() {
+        skipWhitespace();
+        return peek() == EOF;
+    }
+
+    bool fail(const std::string& message) {
+        if (error.empty()) {
+            error = "ligne " + std::to_string(line) + ": " + message;
+        }
+        return false;
+    }
+
+    bool expect(char expected) {
+        skipWhitespace();
+        if (get() != expected) {
+            return fail(std::string("'") + expected + "' attendu");
+        }
+        return true;
+    }
+
+    // Chaîne entre guillemets, gardée dans out (MAX_TOKEN - 1 caractères au plus)
+    bool readString(char (&out)[MAX_TOKEN]) {
+        if (!expect('"')) {
+            return false;
+        }
+        size_t length = 0;
+        for (;;) {
+            int c = get();
+            if (c == EOF || c == '\n') {
+                return fail("chaine non terminee");
+            }
+            if (c == '"') {
+                break;
+            }
+            if (c == '\\') {
+                c = get();
+                switch (c) {
+                    case 'n': c = '\n'; break;
+                    case 't': c = '\t'; break;
+                    case 'r': c = '\r'; break;
+                    case 'b': c = '\b'; break;
+                    case 'f': c = '\f'; break;
+                    case '"': case '\\': case '/': break;
+                    case 'u':
+                        // Les caractères hors ASCII ne servent à aucune clé connue
+                        for (int i = 0; i < 4; i++) {
+                            if (!std::isxdigit(get())) {
+                                return fail("sequence \\u invalide");
+                            }
+                        }
+                        c = '?';
+                        break;
+                    default:
+                        return fail("echappement invalide");
+                }
+            }
+            if (length + 1 < MAX_TOKEN) {
+                out[length++] = static_cast<char>(c);
+            }
+        }
+        out[length] = '\0';
+        return true;
+    }
+
+    bool readNumber(double& value) {
+        skipWhitespace();
+        char text[MAX_TOKEN];
+        size_t length = 0;
+        for (int c = peek(); (c >= '0' && c <= '9') || c == '-' || c == '+' || c == '.' || c == 'e' || c == 'E'; c = peek()) {
+            if (length + 1 >= MAX_TOKEN) {
+                return fail("nombre trop long");
+            }
+            text[length++] = static_cast<char>(get());
+        }
+        text[length] = '\0';
+        char* parsed = nullptr;
+        value = std::strtod(text, &parsed);
+        if (length == 0 || parsed != text + length || !std::isfinite(value)) {
+            return fail("nombre attendu");
+        }
+        return true;
+    }
+
+    bool readInt(int& value) {
+        double number;
+        if (!readNumber(number)) {
+            return false;
+        }
+        if (number != std::floor(number) || std::fabs(number) > 2147483647.0) {
+            return fail("entier attendu");
+        }
+        value = static_cast<int>(number);
+        return true;
+    }
+
+    bool readFloat(float& value) {
+        double number;
+        if (!readNumber(number)) {
+            return false;
+        }
+        value = static_cast<float>(number);
+        return true;
+    }
+
+    /**
+     * @brief Objet : field(clé) lit la valeur de chaque clé (ou la saute)
+     */
+    template<typename Field>
+    bool readObject(Field field) {
+        if (!expect('{')) {
+            return false;
+        }
+        skipWhitespace();
+        if (peek() == '}') {
+            get();
+            return true;
+        }
+        for (;;) {
+            char key[MAX_TOKEN];
+            if (!readString(key) || !expect(':') || !field(static_cast<const char*>(key))) {
+                return false;
+            }
+            skipWhitespace();
+            int c = get();
+            if (c == '}') {
+                return true;
+            }
+            if (c != ',') {
+                return fail("',' ou '}' attendu");
+            }
+        }
+    }
+
+    /**
+     * @brief Tableau : item() lit chaque élément
+     */
+    template<typename Item>
+    bool readArray(Item item) {
+        if (!expect('[')) {
+            return false;
+        }
+        skipWhitespace();
+        if (peek() == ']') {
+            get();
+            return true;
+        }
+        for (;;) {
+            if (!item()) {
+                return false;
+            }
+            skipWhitespace();
+            int c = get();
+            if (c == ']') {
+                return true;
+            }
+            if (c != ',') {
+                return fail("',' ou ']' attendu");
+            }
+        }
+    }
+
+    // Valeur d'une clé inconnue, quelle qu'elle soit
+    bool skipValue() {
+        skipWhitespace();
+        int c = peek();
+        if (c == '"') {
+            char ignored[MAX_TOKEN];
+            return readString(ignored);
+        }
+        if (c == '{') {
+            return readObject([this](const char*) { return skipValue(); });
+        }
+        if (c == '[') {
+            return readArray([this]() { return skipValue(); });
+        }
+        if (c == 't' || c == 'f' || c == 'n') {
+            char word[6];
+            size_t length = 0;
+            for (c = peek(); c >= 'a' && c <= 'z' && length < 5; c = peek()) {
+                word[length++] = static_cast<char>(get());
+            }
+            word[length] = '\0';
+            if (std::strcmp(word, "true") != 0 && std::strcmp(word, "false") != 0 && std::strcmp(word, "null") != 0) {
+                return fail("valeur inconnue");
+            }
+            return true;
+        }
+        double ignored;
+        return readNumber(ignored);
+    }
+
+private:
+    std::ifstream& file;
+    std::vector<char>& buffer;
+    size_t pos = 0;
+    size_t end = 0;
+    int line = 1;
+
+    bool refill() {
+        if (!file) {
+            return false;
+        }
+        file.read(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+        pos = 0;
+        end = static_cast<size_t>(file.gcount());
+        return end > 0;
+    }
+};
+
+bool readNode(JsonStream& in, RoadNetwork& network) {
+    int id = 0;
+    float x = 0.0f, y = 0.0f;
+    bool hasId = false, hasX = false, hasY = false;
+    bool ok = in.readObject([&](const char* key) {
+        if (std::strcmp(key, "id") == 0) return hasId = in.readInt(id);
+        if (std::strcmp(key, "x") == 0) return hasX = in.readFloat(x);
+        if (std::strcmp(key, "y") == 0) return hasY = in.readFloat(y);
+        return in.skipValue();
+    });
+    if (!ok) {
+        return false;
+    }
+    if (!hasId || !hasX || !hasY) {
+        return in.fail("noeud sans id, x ou y");
+    }
+    if (network.getNode(id)) {
+        return in.fail("noeud " + std::to_string(id) + " en double");
+    }
+    network.addNode(id, x, y);
+    return true;
+}
+
+bool readRoute(JsonStream& in, RoadNetwork& network) {
+    int id = 0, from = 0, to = 0, capacity = 0;
+    float length = 0.0f, speed = 0.0f;
+    bool hasId = false, hasFrom = false, hasTo = false, hasLength = false, hasSpeed = false, hasCapacity = false;
+    bool ok = in.readObject([&](const char* key) {
+        if (std::strcmp(key, "id") == 0) return hasId = in.readInt(id);
+        if (std::strcmp(key, "from") == 0) return hasFrom = in.readInt(from);
+        if (std::strcmp(key, "to") == 0) return hasTo = in.readInt(to);
+        if (std::strcmp(key, "length") == 0) return hasLength = in.readFloat(length);
+        if (std::strcmp(key, "speed") == 0) return hasSpeed = in.readFloat(speed);
+        if (std::strcmp(key, "capacity") == 0) return hasCapacity = in.readInt(capacity);
+        return in.skipValue();
+    });
+    if (!ok) {
+        return false;
+    }
+    if (!hasId || !hasFrom || !hasTo || !hasSpeed || !hasCapacity) {
+        return in.fail("route sans id, from, to, speed ou capacity");
+    }
+    if (network.getRouteIndex(id) >= 0) {
+        return in.fail("route " + std::to_string(id) + " en double");
+    }
+    if (!hasLength) {
+        const Node* fromNode = network.getNode(from);
+        const Node* toNode = network.getNode(to);
+        if (!fromNode || !toNode) {
+            return in.fail("route " + std::to_string(id) + " sans longueur, noeuds pas encore definis");
+        }
+        length = std::hypot(toNode->x - fromNode->x, toNode->y - fromNode->y);
+    }
+    network.addRoute(id, from, to, length, speed, capacity);
+    return true;
+}
+
+bool readText(JsonStream& in, std::string& value) {
+    char text[MAX_TOKEN];
+    if (!in.readString(text)) {
+        return false;
+    }
+    value = text;
+    return true;
+}
+}
+
+bool ConfigLoader::load(const std::string& path, RoadNetwork& network, SimulationConfig& settings, std::string& error) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file) {
+        error = "fichier introuvable";
+        return false;
+    }
+    std::vector<char> buffer(BUFFER_SIZE);
+    JsonStream in(file, buffer);
+
+    bool ok = in.readObject([&](const char* section) {
+        if (std::strcmp(section, "graph") == 0) {
+            return in.readObject([&](const char* key) {
+                if (std::strcmp(key, "nodes") == 0) return in.readArray([&]() { return readNode(in, network); });
+                if (std::strcmp(key, "routes") == 0) return in.readArray([&]() { return readRoute(in, network); });
+                return in.skipValue();
+            });
+        }
+        if (std::strcmp(section, "simulation") == 0) {
+            return in.readObject([&](const char* key) {
+                if (std::strcmp(key, "vehicleCount") == 0) return in.readInt(settings.vehicleCount);
+                if (std::strcmp(key, "eventCount") == 0) return in.readInt(settings.eventCount);
+                if (std::strcmp(key, "timeScale") == 0) return in.readFloat(settings.timeScale);
+                if (std::strcmp(key, "mode") == 0) return readText(in, settings.mode);
+                return in.skipValue();
+            });
+        }
+        if (std::strcmp(section, "events") == 0) {
+            return in.readObject([&](const char* key) {
+                if (std::strcmp(key, "interval") == 0) return in.readFloat(settings.eventInterval);
+                if (std::strcmp(key, "types") == 0) {
+                    settings.eventTypes.clear();
+                    return in.readArray([&]() {
+                        settings.eventTypes.emplace_back();
+                        return readText(in, settings.eventTypes.back());
+                    });
+                }
+                return in.skipValue();
+            });
+        }
+        return in.skipValue();
+    });
+    if (ok && !in.atEnd()) {
+        ok = in.fail("contenu apres la fin du document");
+    }
+    if (ok && file.bad()) {
+        ok = in.fail("erreur de lecture");
+    }
+
+    // Les routes peuvent précéder les nœuds : extrémités vérifiées une fois tout lu
+    for (size_t i = 0; ok && i < network.getRouteCount(); i++) {
+        const RouteAttributes& route = network.getRoute(i);
+        if (!network.getNode(route.fromNode) || !network.getNode(route.toNode)) {
+            error = "route " + std::to_string(route.id) + ": noeud inconnu";
+            return false;
+        }
+    }
+    if (!ok) {
+        error = in.error;
+    }
+    return ok;
+}
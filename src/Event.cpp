@@ -15,6 +15,11 @@ void Event::update(float deltaTime) {
     }
 }
 
+void Event::restoreState(float savedElapsedTime, bool savedActive) {
+    elapsedTime = savedElapsedTime;
+    active = savedActive;
+}
+
 void Event::applyToRoute(Route* route) const {
     if (!route || route->getId() != routeId) {
         return;
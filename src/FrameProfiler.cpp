@@ -0,0 +1,154 @@
+#include "FrameProfiler.h"
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace {
+
+// Initialisation constante : valable avant tout constructeur statique
+std::atomic<uint64_t> allocationCount{0};
+
+uint32_t difference(uint64_t now, uint64_t before) {
+    return now > before ? static_cast<uint32_t>(now - before) : 0;
+}
+
+float differenceMs(uint64_t now, uint64_t before) {
+    return now > before ? static_cast<float>((now - before) * 1e-6) : 0.0f;
+}
+
+} // namespace
+
+// Opérateurs new globaux : comptent les allocations de tout le processus
+void* operator new(std::size_t size) {
+    allocationCount.fetch_add(1, std::memory_order_relaxed);
+    if (size == 0) {
+        size = 1;
+    }
+    while (true) {
+        if (void* memory = std::malloc(size)) {
+            return memory;
+        }
+        std::new_handler handler = std::get_new_handler();
+        if (!handler) {
+            throw std::bad_alloc();
+        }
+        handler();
+    }
+}
+
+void* operator new[](std::size_t size) {
+    return ::operator new(size);
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept {
+    try {
+        return ::operator new(size);
+    } catch (...) {
+        return nullptr;
+    }
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept {
+    try {
+        return ::operator new(size);
+    } catch (...) {
+        return nullptr;
+    }
+}
+
+void operator delete(void* memory) noexcept { std::free(memory); }
+void operator delete[](void* memory) noexcept { std::free(memory); }
+void operator delete(void* memory, std::size_t) noexcept { std::free(memory); }
+void operator delete[](void* memory, std::size_t) noexcept { std::free(memory); }
+void operator delete(void* memory, const std::nothrow_t&) noexcept { std::free(memory); }
+void operator delete[](void* memory, const std::nothrow_t&) noexcept { std::free(memory); }
+
+FrameProfiler::FrameProfiler()
+    : head(0), frameCount(0), started(false), lastReroutings(0), lastAllocations(0) {
+}
+
+void FrameProfiler::beginFrame(const SimulationProfile& simulation, int totalReroutings) {
+    uint64_t allocations = getAllocationCount();
+    if (started) {
+        Sample& sample = current();
+        sample.phaseTime[static_cast<size_t>(ProfilePhase::SIMULATION)] =
+            differenceMs(simulation.updateTime, lastSimulation.updateTime);
+        sample.phaseTime[static_cast<size_t>(ProfilePhase::PATHFINDING)] =
+            differenceMs(simulation.pathfindingTime, lastSimulation.pathfindingTime);
+        sample.phaseTime[static_cast<size_t>(ProfilePhase::TRAFFIC)] =
+            differenceMs(simulation.trafficTime, lastSimulation.trafficTime);
+        sample.phaseTime[static_cast<size_t>(ProfilePhase::SPAWN)] =
+            differenceMs(simulation.spawnTime, lastSimulation.spawnTime);
+        sample.ticks = difference(simulation.ticks, lastSimulation.ticks);
+        sample.searches = difference(simulation.searches, lastSimulation.searches);
+        sample.reroutes = totalReroutings > lastReroutings ? static_cast<uint32_t>(totalReroutings - lastReroutings) : 0;
+        sample.allocations = difference(allocations, lastAllocations);
+
+        head = (head + 1) % RING_SIZE;
+        frameCount = std::min(frameCount + 1, HISTORY);
+    }
+    started = true;
+    lastSimulation = simulation;
+    lastReroutings = totalReroutings;
+    lastAllocations = allocations;
+    current() = Sample();
+}
+
+template<typename Getter>
+float FrameProfiler::average(Getter getter) const {
+    if (frameCount == 0) {
+        return 0.0f;
+    }
+    float sum = 0.0f;
+    for (size_t age = 0; age < frameCount; age++) {
+        sum += getter(getFrame(age));
+    }
+    return sum / frameCount;
+}
+
+float FrameProfiler::getAverage(ProfilePhase phase) const {
+    size_t index = static_cast<size_t>(phase);
+    return average([index](const Sample& sample) { return sample.phaseTime[index]; });
+}
+
+float FrameProfiler::getMax(ProfilePhase phase) const {
+    size_t index = static_cast<size_t>(phase);
+    float result = 0.0f;
+    for (size_t age = 0; age < frameCount; age++) {
+        result = std::max(result, getFrame(age).phaseTime[index]);
+    }
+    return result;
+}
+
+float FrameProfiler::getAverageSearches() const {
+    return average([](const Sample& sample) { return static_cast<float>(sample.searches); });
+}
+
+float FrameProfiler::getAverageReroutes() const {
+    return average([](const Sample& sample) { return static_cast<float>(sample.reroutes); });
+}
+
+float FrameProfiler::getAverageAllocations() const {
+    return average([](const Sample& sample) { return static_cast<float>(sample.allocations); });
+}
+
+const char* FrameProfiler::getPhaseName(ProfilePhase phase) {
+    switch (phase) {
+        case ProfilePhase::SIMULATION: return "Simulation";
+        case ProfilePhase::PATHFINDING: return "Recherches";
+        case ProfilePhase::TRAFFIC: return "Trafic";
+        case ProfilePhase::SPAWN: return "Apparitions";
+        case ProfilePhase::RENDER_GRAPH: return "Rendu reseau";
+        case ProfilePhase::RENDER_VEHICLES: return "Rendu vehicules";
+        case ProfilePhase::RENDER_EVENTS: return "Rendu evenements";
+        case ProfilePhase::RENDER_UI: return "Rendu interface";
+        case ProfilePhase::RENDER_NOTIFICATIONS: return "Notifications";
+        case ProfilePhase::COUNT: break;
+    }
+    return "";
+}
+
+uint64_t FrameProfiler::getAllocationCount() {
+    return allocationCount.load(std::memory_order_relaxed);
+}
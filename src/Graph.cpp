@@ -1,4 +1,5 @@
 #include "Graph.h"
+#include "ConfigLoader.h"
 #include <fstream>
 #include <sstream>
 #include <iostream>
@@ -7,62 +8,59 @@
 #include <unordered_map>
 
 Graph::Graph() {
+    auto topology = std::make_shared<RoadNetwork>();
+    editableNetwork = topology.get();
+    network = std::move(topology);
 }
 
-Graph::~Graph() {
+Graph::Graph(std::shared_ptr<const RoadNetwork> topology) : editableNetwork(nullptr) {
+    setTopology(std::move(topology));
 }
 
-void Graph::addNode(int id, float x, float y) {
-    nodes.push_back(std::make_unique<Node>(id, x, y));
+Graph::~Graph() {
 }
 
-void Graph::addRoute(int id, int fromNode, int toNode, float length, float speed, int capacity) {
-    auto route = std::make_unique<Route>(id, fromNode, toNode, length, speed, capacity);
-    routes.push_back(std::move(route));
-    
-    // Mise à jour de la liste d'adjacence (bidirectionnelle)
-    adjacencyList[fromNode].push_back(routes.size() - 1);
-    adjacencyList[toNode].push_back(routes.size() - 1);
+void Graph::setTopology(std::shared_ptr<const RoadNetwork> topology) {
+    network = topology ? std::move(topology) : std::make_shared<const RoadNetwork>();
+    editableNetwork = nullptr;
+    routes.clear();
+    routes.reserve(network->getRouteCount());
+    for (size_t i = 0; i < network->getRouteCount(); i++) {
+        routes.push_back(std::make_unique<Route>(network->getRoute(i)));
+        routes.back()->attachChangeLog(&changedRoutes, static_cast<int>(i));
+    }
+    changedRoutes.clear();
+    pendingVehicleDeltas.clear();
+    touchedRoutes.clear();
 }
 
-Node* Graph::getNode(int id) const {
-    for (const auto& node : nodes) {
-        if (node->id == id) {
-            return node.get();
+RoadNetwork& Graph::editTopology() {
+    // use_count() == 1 : personne d'autre ne peut plus observer la topologie
+    if (!editableNetwork || network.use_count() > 1) {
+        auto copy = std::make_shared<RoadNetwork>(*network);
+        for (size_t i = 0; i < routes.size(); i++) {
+            routes[i]->rebindAttributes(copy->getRoute(i));
         }
+        editableNetwork = copy.get();
+        network = std::move(copy);
     }
-    return nullptr;
+    return *editableNetwork;
 }
 
-Route* Graph::getRoute(int id) const {
-    for (const auto& route : routes) {
-        if (route->getId() == id) {
-            return route.get();
-        }
-    }
-    return nullptr;
+void Graph::addNode(int id, float x, float y) {
+    editTopology().addNode(id, x, y);
 }
 
-std::vector<int> Graph::getNeighbors(int nodeId) const {
-    std::vector<int> neighbors;
-    if (adjacencyList.find(nodeId) != adjacencyList.end()) {
-        for (int routeIdx : adjacencyList.at(nodeId)) {
-            Route* route = routes[routeIdx].get();
-            if (route->getToNode() != nodeId) {
-                neighbors.push_back(route->getToNode());
-            } else {
-                neighbors.push_back(route->getFromNode());
-            }
-        }
-    }
-    return neighbors;
+void Graph::addRoute(int id, int fromNode, int toNode, float length, float speed, int capacity) {
+    RoadNetwork& topology = editTopology();
+    topology.addRoute(id, fromNode, toNode, length, speed, capacity);
+    routes.push_back(std::make_unique<Route>(topology.getRoute(topology.getRouteCount() - 1)));
+    routes.back()->attachChangeLog(&changedRoutes, static_cast<int>(routes.size()) - 1);
 }
 
-std::vector<int> Graph::getRoutesFromNode(int nodeId) const {
-    if (adjacencyList.find(nodeId) != adjacencyList.end()) {
-        return adjacencyList.at(nodeId);
-    }
-    return std::vector<int>();
+Route* Graph::getRoute(int id) const {
+    int index = getRouteIndex(id);
+    return index >= 0 ? routes[index].get() : nullptr;
 }
 
 std::vector<int> Graph::findPath(int start, int end) const {
@@ -108,15 +106,72 @@ std::vector<int> Graph::findPath(int start, int end) const {
     return std::vector<int>(); // Pas de chemin trouvé
 }
 
+void Graph::queueVehicleDelta(int routeIndex, int delta) {
+    if (routeIndex < 0 || routeIndex >= static_cast<int>(routes.size()) || delta == 0) {
+        return;
+    }
+    if (pendingVehicleDeltas.size() < routes.size()) {
+        pendingVehicleDeltas.resize(routes.size(), 0);
+    }
+    if (pendingVehicleDeltas[routeIndex] == 0) {
+        touchedRoutes.push_back(routeIndex);
+    }
+    pendingVehicleDeltas[routeIndex] += delta;
+}
+
 void Graph::updateTraffic() {
-    for (auto& route : routes) {
-        route->updateSpeed();
+    // Seules les routes dont l'occupation a changé voient leur vitesse recalculée :
+    // setState/setCongestion mettent déjà la vitesse à jour eux-mêmes
+    for (int routeIdx : touchedRoutes) {
+        int delta = pendingVehicleDeltas[routeIdx];
+        pendingVehicleDeltas[routeIdx] = 0;
+        if (delta != 0) {
+            routes[routeIdx]->applyVehicleDelta(delta);
+            routes[routeIdx]->updateSpeed();
+        }
+    }
+    touchedRoutes.clear();
+}
+
+std::vector<int> Graph::consumeRouteChanges() {
+    std::vector<int> batch;
+    batch.swap(changedRoutes);
+    for (int routeIdx : batch) {
+        routes[routeIdx]->clearChangePending();
     }
+    return batch;
 }
 
-void Graph::loadFromConfig(const std::string& configPath) {
-    // Chargement simplifié - sera implémenté avec JSON
-    // Pour l'instant, création d'un graphe de test
+int Graph::getPendingVehicleDelta(int routeIndex) const {
+    return routeIndex >= 0 && routeIndex < static_cast<int>(pendingVehicleDeltas.size())
+        ? pendingVehicleDeltas[routeIndex] : 0;
+}
+
+void Graph::restorePendingState(const std::vector<int>& vehicleDeltas, const std::vector<int>& routeChanges) {
+    consumeRouteChanges();
+    pendingVehicleDeltas.assign(routes.size(), 0);
+    touchedRoutes.clear();
+    for (size_t i = 0; i < vehicleDeltas.size() && i < routes.size(); i++) {
+        queueVehicleDelta(static_cast<int>(i), vehicleDeltas[i]);
+    }
+    for (int routeIdx : routeChanges) {
+        if (routeIdx >= 0 && routeIdx < static_cast<int>(routes.size())) {
+            routes[routeIdx]->markChangePending();
+            changedRoutes.push_back(routeIdx);
+        }
+    }
+}
+
+bool Graph::loadFromConfig(const std::string& configPath) {
     std::cout << "Chargement de la configuration depuis: " << configPath << std::endl;
+    auto topology = std::make_shared<RoadNetwork>();
+    SimulationConfig settings;
+    std::string error;
+    if (!ConfigLoader::load(configPath, *topology, settings, error)) {
+        std::cout << "ERREUR: configuration " << configPath << ": " << error << std::endl;
+        return false;
+    }
+    setTopology(std::move(topology));
+    return true;
 }
 
@@ -0,0 +1,69 @@
+#include "GraphPartition.h"
+#include <algorithm>
+#include <limits>
+
+GraphPartition::GraphPartition(const Graph& graph, int regionCount)
+    : regionCount(std::max(1, regionCount)) {
+    const auto& nodes = graph.getNodes();
+    const auto& routes = graph.getRoutes();
+
+    nodeRegion.assign(nodes.size(), 0);
+    std::vector<int> nodeIndices(nodes.size());
+    for (size_t i = 0; i < nodes.size(); i++) {
+        nodeIndices[i] = static_cast<int>(i);
+        nodeIndexById.emplace(nodes[i]->id, static_cast<int>(i));
+    }
+    bisect(graph, nodeIndices, 0, nodeIndices.size(), 0, this->regionCount);
+
+    routeRegion.assign(routes.size(), 0);
+    boundaryRoute.assign(routes.size(), false);
+    regionRoutes.assign(this->regionCount, std::vector<int>());
+    for (size_t i = 0; i < routes.size(); i++) {
+        int fromRegion = getNodeRegion(routes[i]->getFromNode());
+        int toRegion = getNodeRegion(routes[i]->getToNode());
+        routeRegion[i] = std::max(0, fromRegion);
+        boundaryRoute[i] = (fromRegion != toRegion);
+        regionRoutes[routeRegion[i]].push_back(static_cast<int>(i));
+    }
+}
+
+void GraphPartition::bisect(const Graph& graph, std::vector<int>& nodeIndices,
+                            size_t begin, size_t end, int firstRegion, int count) {
+    if (count <= 1 || end - begin <= 1) {
+        for (size_t i = begin; i < end; i++) {
+            nodeRegion[nodeIndices[i]] = firstRegion;
+        }
+        return;
+    }
+
+    const auto& nodes = graph.getNodes();
+    float minX = std::numeric_limits<float>::max(), maxX = std::numeric_limits<float>::lowest();
+    float minY = minX, maxY = maxX;
+    for (size_t i = begin; i < end; i++) {
+        const Node* node = nodes[nodeIndices[i]].get();
+        minX = std::min(minX, node->x);
+        maxX = std::max(maxX, node->x);
+        minY = std::min(minY, node->y);
+        maxY = std::max(maxY, node->y);
+    }
+    bool splitOnX = (maxX - minX) >= (maxY - minY);
+
+    // Coupe proportionnelle au nombre de régions de chaque côté
+    int leftCount = count / 2;
+    size_t middle = begin + (end - begin) * leftCount / count;
+    std::nth_element(nodeIndices.begin() + begin, nodeIndices.begin() + middle, nodeIndices.begin() + end,
+        [&](int a, int b) {
+            const Node* na = nodes[a].get();
+            const Node* nb = nodes[b].get();
+            return splitOnX ? (na->x < nb->x || (na->x == nb->x && na->y < nb->y))
+                            : (na->y < nb->y || (na->y == nb->y && na->x < nb->x));
+        });
+
+    bisect(graph, nodeIndices, begin, middle, firstRegion, leftCount);
+    bisect(graph, nodeIndices, middle, end, firstRegion + leftCount, count - leftCount);
+}
+
+int GraphPartition::getNodeRegion(int nodeId) const {
+    auto it = nodeIndexById.find(nodeId);
+    return it != nodeIndexById.end() ? nodeRegion[it->second] : -1;
+}
@@ -0,0 +1,165 @@
+#include "HybridModel.h"
+#include "Vehicle.h"
+
+HybridModel::HybridModel(const Graph* graph)
+    : graph(graph), meso(graph), micro(graph), hasFocus(false), focus{0.0f, 0.0f, 0.0f, 0.0f} {
+    meso.setPeer(&micro, &mesoRoutes);
+    micro.setPeer(&meso, &microRoutes);
+    reset();
+}
+
+void HybridModel::reset() {
+    meso.reset();
+    micro.reset();
+    size_t routeCount = graph->getRoutes().size();
+    microRoutes.assign(routeCount, 0);
+    mesoRoutes.assign(routeCount, 1);
+    if (hasFocus) {
+        // Modèles vides : les masques peuvent être recalculés sans transfert
+        hasFocus = false;
+        setFocusArea(focus[0], focus[1], focus[2], focus[3]);
+    }
+}
+
+void HybridModel::setFocusArea(float minX, float minY, float maxX, float maxY) {
+    if (hasFocus && focus[0] == minX && focus[1] == minY && focus[2] == maxX && focus[3] == maxY) {
+        return;
+    }
+    hasFocus = true;
+    focus[0] = minX;
+    focus[1] = minY;
+    focus[2] = maxX;
+    focus[3] = maxY;
+
+    auto inside = [&](float x, float y) {
+        return x >= minX && x <= maxX && y >= minY && y <= maxY;
+    };
+    const auto& routes = graph->getRoutes();
+    std::vector<unsigned char> newMicroRoutes(routes.size(), 0);
+    for (size_t i = 0; i < routes.size(); i++) {
+        const Node* from = graph->getNode(routes[i]->getFromNode());
+        const Node* to = graph->getNode(routes[i]->getToNode());
+        if (!from || !to) {
+            continue;
+        }
+        bool visible = inside(from->x, from->y) || inside(to->x, to->y) ||
+                       inside(0.5f * (from->x + to->x), 0.5f * (from->y + to->y));
+        newMicroRoutes[i] = visible ? 1 : 0;
+    }
+    applyFocus(newMicroRoutes);
+}
+
+void HybridModel::clearFocusArea() {
+    hasFocus = false;
+    applyFocus(std::vector<unsigned char>(graph->getRoutes().size(), 0));
+}
+
+void HybridModel::applyFocus(const std::vector<unsigned char>& newMicroRoutes) {
+    std::vector<Vehicle*> moving;
+    bool refreshed = false;
+    for (size_t i = 0; i < newMicroRoutes.size(); i++) {
+        if (newMicroRoutes[i] == microRoutes[i]) {
+            continue;
+        }
+        // La progression n'est tenue à jour qu'à la demande : nécessaire au transfert
+        if (!refreshed) {
+            refreshPositions(nullptr);
+            refreshed = true;
+        }
+        int routeIndex = static_cast<int>(i);
+        moving.clear();
+        if (microRoutes[i]) {
+            micro.getRouteVehicles(routeIndex, moving);
+        } else {
+            meso.getRouteVehicles(routeIndex, moving);
+        }
+        microRoutes[i] = newMicroRoutes[i];
+        mesoRoutes[i] = newMicroRoutes[i] ? 0 : 1;
+
+        // Transfert de la tête à la queue : l'ordre de la file est conservé
+        for (Vehicle* vehicle : moving) {
+            float remaining = 1.0f - vehicle->getProgress();
+            if (newMicroRoutes[i]) {
+                meso.remove(vehicle);
+                micro.enter(vehicle, remaining);
+            } else {
+                micro.remove(vehicle);
+                meso.enter(vehicle, remaining);
+            }
+        }
+    }
+}
+
+size_t HybridModel::getMicroRouteCount() const {
+    size_t count = 0;
+    for (unsigned char flag : microRoutes) {
+        count += flag;
+    }
+    return count;
+}
+
+void HybridModel::enter(Vehicle* vehicle, float remainingFraction) {
+    const auto& pathRoutes = vehicle->getPathRoutes();
+    size_t edge = vehicle->getCurrentRouteIndex();
+    if (edge >= pathRoutes.size() || pathRoutes[edge] < 0 || vehicle->hasReachedDestination()) {
+        return;
+    }
+    if (microRoutes[pathRoutes[edge]]) {
+        micro.enter(vehicle, remainingFraction);
+    } else {
+        meso.enter(vehicle, remainingFraction);
+    }
+}
+
+void HybridModel::remove(Vehicle* vehicle) {
+    micro.remove(vehicle);
+    meso.remove(vehicle);
+}
+
+void HybridModel::step(float deltaTime, std::vector<VehicleMove>& moves,
+                       std::vector<Vehicle*>& blocked, TaskScheduler* scheduler) {
+    micro.step(deltaTime, moves, blocked, scheduler);
+    meso.step(deltaTime, moves, blocked, scheduler);
+}
+
+void HybridModel::refreshPositions(TaskScheduler* scheduler) {
+    micro.refreshPositions(scheduler);
+    meso.refreshPositions(scheduler);
+}
+
+void HybridModel::saveState(BinaryWriter& out) const {
+    out.writeU8(hasFocus ? 1 : 0);
+    for (float bound : focus) {
+        out.writeFloat(bound);
+    }
+    meso.saveState(out);
+    micro.saveState(out);
+}
+
+bool HybridModel::loadState(BinaryReader& in, const std::function<Vehicle*(int)>& findVehicle) {
+    bool savedFocus = in.readU8() != 0;
+    float bounds[4];
+    for (float& bound : bounds) {
+        bound = in.readFloat();
+    }
+    // Modèles vides : les masques sont recalculés avant de remplir les files et les voies
+    if (savedFocus) {
+        setFocusArea(bounds[0], bounds[1], bounds[2], bounds[3]);
+    } else {
+        clearFocusArea();
+    }
+    return meso.loadState(in, findVehicle) && micro.loadState(in, findVehicle);
+}
+
+bool HybridModel::canEnter(int routeIndex) const {
+    return microRoutes[routeIndex] ? micro.canEnter(routeIndex) : meso.canEnter(routeIndex);
+}
+
+void HybridModel::acceptHandoff(Vehicle* vehicle, float speed) {
+    const auto& pathRoutes = vehicle->getPathRoutes();
+    if (microRoutes[pathRoutes[vehicle->getCurrentRouteIndex()]]) {
+        micro.acceptHandoff(vehicle, speed);
+    } else {
+        meso.acceptHandoff(vehicle, speed);
+    }
+}
@@ -0,0 +1,63 @@
+#include "KpiCollector.h"
+#include "Simulation.h"
+#include <algorithm>
+
+KpiCollector::KpiCollector()
+    : completed(0), travelSum(0.0), travelMax(0.0f), activeSum(0.0), congestedSum(0.0), ticks(0) {
+}
+
+void KpiCollector::start(const Simulation& simulation) {
+    active.clear();
+    for (const auto& vehicle : simulation.getVehicles()) {
+        active.emplace_back(vehicle->getId(), simulation.getSimulationTime());
+    }
+}
+
+void KpiCollector::observe(const Simulation& simulation) {
+    float now = simulation.getSimulationTime();
+    size_t previous = 0;
+    next.clear();
+    for (const auto& vehicle : simulation.getVehicles()) {
+        int id = vehicle->getId();
+        while (previous < active.size() && active[previous].first < id) {
+            arrive(now - active[previous].second);
+            previous++;
+        }
+        if (previous < active.size() && active[previous].first == id) {
+            next.push_back(active[previous]);
+            previous++;
+        } else {
+            next.emplace_back(id, now);
+        }
+    }
+    for (; previous < active.size(); previous++) {
+        arrive(now - active[previous].second);
+    }
+    active.swap(next);
+
+    const auto& routes = simulation.getGraph()->getRoutes();
+    int congested = 0;
+    for (const auto& route : routes) {
+        congested += route->getState() != RouteState::NORMAL ? 1 : 0;
+    }
+    congestedSum += routes.empty() ? 0.0 : static_cast<double>(congested) / routes.size();
+    activeSum += static_cast<double>(active.size());
+    ticks++;
+}
+
+TripIndicators KpiCollector::getIndicators(float simulatedTime) const {
+    TripIndicators indicators;
+    indicators.completedTrips = completed;
+    indicators.meanTravelTime = completed > 0 ? static_cast<float>(travelSum / completed) : 0.0f;
+    indicators.maxTravelTime = travelMax;
+    indicators.throughput = simulatedTime > 0.0f ? completed * 60.0f / simulatedTime : 0.0f;
+    indicators.meanActiveVehicles = ticks > 0 ? static_cast<float>(activeSum / ticks) : 0.0f;
+    indicators.congestedShare = ticks > 0 ? static_cast<float>(congestedSum / ticks) : 0.0f;
+    return indicators;
+}
+
+void KpiCollector::arrive(float travelTime) {
+    completed++;
+    travelSum += travelTime;
+    travelMax = std::max(travelMax, travelTime);
+}
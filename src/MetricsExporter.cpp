@@ -0,0 +1,410 @@
+#include "MetricsExporter.h"
+#include "Simulation.h"
+#include "BinaryIO.h"
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <iterator>
+
+namespace {
+
+const float SAMPLE_TOLERANCE = 0.005f;
+
+uint32_t floatBits(float value) {
+    uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    return bits;
+}
+
+float bitsFloat(uint32_t bits) {
+    float value;
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+// Octets inversés : les bits qui changent (signe, exposant, début de mantisse) passent en tête du varint
+uint32_t reverseBytes(uint32_t value) {
+    return (value >> 24) | ((value >> 8) & 0xFF00) | ((value << 8) & 0xFF0000) | (value << 24);
+}
+
+void writeFloats(BinaryWriter& out, const float* values, size_t count, bool compressed) {
+    uint32_t previous = 0;
+    for (size_t i = 0; i < count; i++) {
+        uint32_t bits = floatBits(values[i]);
+        if (compressed) {
+            out.writeVarint(reverseBytes(bits ^ previous));
+            previous = bits;
+        } else {
+            out.writeU32(bits);
+        }
+    }
+}
+
+void writeCounts(BinaryWriter& out, const uint32_t* values, size_t count, bool compressed) {
+    int64_t previous = 0;
+    for (size_t i = 0; i < count; i++) {
+        if (compressed) {
+            out.writeSigned(static_cast<int64_t>(values[i]) - previous);
+            previous = values[i];
+        } else {
+            out.writeU32(values[i]);
+        }
+    }
+}
+
+void writeStates(BinaryWriter& out, const uint8_t* values, size_t count, bool compressed) {
+    if (!compressed) {
+        for (size_t i = 0; i < count; i++) {
+            out.writeU8(values[i]);
+        }
+        return;
+    }
+    // Plages (longueur, valeur)
+    for (size_t i = 0; i < count;) {
+        size_t run = 1;
+        while (i + run < count && values[i + run] == values[i]) {
+            run++;
+        }
+        out.writeVarint(run);
+        out.writeU8(values[i]);
+        i += run;
+    }
+}
+
+void readFloats(BinaryReader& in, std::vector<float>& column, size_t count, bool compressed) {
+    uint32_t previous = 0;
+    for (size_t i = 0; i < count; i++) {
+        uint32_t bits = compressed ? reverseBytes(static_cast<uint32_t>(in.readVarint())) ^ previous : in.readU32();
+        previous = bits;
+        column.push_back(bitsFloat(bits));
+    }
+}
+
+void readCounts(BinaryReader& in, std::vector<uint32_t>& column, size_t count, bool compressed) {
+    int64_t previous = 0;
+    for (size_t i = 0; i < count; i++) {
+        if (compressed) {
+            previous += in.readSigned();
+            column.push_back(static_cast<uint32_t>(previous));
+        } else {
+            column.push_back(in.readU32());
+        }
+    }
+}
+
+bool readStates(BinaryReader& in, std::vector<uint8_t>& column, size_t count, bool compressed) {
+    if (!compressed) {
+        for (size_t i = 0; i < count; i++) {
+            column.push_back(in.readU8());
+        }
+        return in.ok();
+    }
+    for (size_t read = 0; read < count;) {
+        uint64_t run = in.readVarint();
+        uint8_t value = in.readU8();
+        if (!in.ok() || run == 0 || run > count - read) {
+            return false;
+        }
+        column.insert(column.end(), static_cast<size_t>(run), value);
+        read += static_cast<size_t>(run);
+    }
+    return true;
+}
+
+} // namespace
+
+MetricsExporter::MetricsExporter()
+    : simulation(nullptr), observerId(-1), format(MetricsFormat::CSV), sampleInterval(1.0f),
+      nextSampleTime(0.0f), sampleCount(0), droppedSamples(0), fingerprint(0), current(nullptr),
+      finishing(false), writeFailed(false) {
+}
+
+MetricsExporter::~MetricsExporter() {
+    stop();
+}
+
+bool MetricsExporter::start(const std::string& path, Simulation& target, MetricsFormat exportFormat) {
+    if (simulation) {
+        return false;
+    }
+    std::ios::openmode mode = std::ios::trunc;
+    if (exportFormat != MetricsFormat::CSV) {
+        mode |= std::ios::binary;
+    }
+    file.open(path, mode);
+    if (!file) {
+        return false;
+    }
+
+    format = exportFormat;
+    const Graph* graph = target.getGraph();
+    routeIds.clear();
+    for (const auto& route : graph->getRoutes()) {
+        routeIds.push_back(route->getId());
+    }
+    fingerprint = graph->getFingerprint();
+
+    // Anneau préalloué : aucune allocation pendant l'échantillonnage
+    size_t routeCount = routeIds.size();
+    // Files vidées des blocs d'un export précédent avant de les remplacer
+    Chunk* previous;
+    while (recycled.pop(previous) || filled.pop(previous)) {
+    }
+    chunks.clear();
+    for (size_t i = 0; i < CHUNK_COUNT; i++) {
+        auto chunk = std::make_unique<Chunk>();
+        chunk->rows = 0;
+        for (auto* column : {&chunk->vehicles, &chunk->completedTrips, &chunk->reroutings,
+                             &chunk->congestedRoutes, &chunk->activeEvents}) {
+            column->resize(CHUNK_ROWS);
+        }
+        chunk->time.resize(CHUNK_ROWS);
+        chunk->meanTravelTime.resize(CHUNK_ROWS);
+        chunk->routeSpeed.resize(routeCount * CHUNK_ROWS);
+        chunk->routeOccupancy.resize(routeCount * CHUNK_ROWS);
+        chunk->routeState.resize(routeCount * CHUNK_ROWS);
+        recycled.push(chunk.get());
+        chunks.push_back(std::move(chunk));
+    }
+    current = nullptr;
+    sampleCount = 0;
+    droppedSamples = 0;
+
+    finishing.store(false, std::memory_order_release);
+    writeFailed.store(false, std::memory_order_release);
+    writer = std::thread(&MetricsExporter::writerLoop, this);
+
+    nextSampleTime = target.getSimulationTime();
+    sample(target);
+    observerId = target.addTickObserver([this](const Simulation& ticked) { sample(ticked); });
+    simulation = &target;
+    return true;
+}
+
+bool MetricsExporter::stop() {
+    if (!simulation) {
+        return true;
+    }
+    simulation->removeTickObserver(observerId);
+    simulation = nullptr;
+
+    if (current && current->rows > 0) {
+        filled.push(current);
+    }
+    current = nullptr;
+    finishing.store(true, std::memory_order_release);
+    writer.join();
+
+    bool ok = !writeFailed.load(std::memory_order_acquire);
+    file.close();
+    return ok && !file.fail();
+}
+
+void MetricsExporter::sample(const Simulation& target) {
+    float now = target.getSimulationTime();
+    // Tolérance (moitié du plus petit pas fixe) : le temps simulé cumule les pas en flottant
+    if (now + SAMPLE_TOLERANCE < nextSampleTime) {
+        return;
+    }
+    // Pas de dérive : l'échéance suivante est comptée depuis la précédente
+    nextSampleTime += sampleInterval;
+    if (nextSampleTime + SAMPLE_TOLERANCE <= now) {
+        nextSampleTime = now + sampleInterval;
+    }
+
+    if (!current && !recycled.pop(current)) {
+        droppedSamples++;
+        return;
+    }
+
+    Chunk& chunk = *current;
+    size_t row = chunk.rows;
+    const auto& routes = target.getGraph()->getRoutes();
+    size_t routeCount = std::min(routes.size(), routeIds.size());
+    uint32_t congested = 0;
+    for (size_t r = 0; r < routeCount; r++) {
+        const Route* route = routes[r].get();
+        size_t cell = r * CHUNK_ROWS + row;
+        chunk.routeSpeed[cell] = route->getCurrentSpeed();
+        chunk.routeOccupancy[cell] = static_cast<uint32_t>(route->getVehicleCount());
+        chunk.routeState[cell] = static_cast<uint8_t>(route->getState());
+        congested += route->getState() != RouteState::NORMAL ? 1 : 0;
+    }
+    uint32_t activeEvents = 0;
+    for (const auto& event : target.getEvents()) {
+        activeEvents += event->isActive() ? 1 : 0;
+    }
+    chunk.time[row] = now;
+    chunk.vehicles[row] = static_cast<uint32_t>(target.getVehicles().size());
+    chunk.completedTrips[row] = static_cast<uint32_t>(target.getCompletedTrips());
+    chunk.reroutings[row] = static_cast<uint32_t>(target.getTotalReroutings());
+    chunk.meanTravelTime[row] = target.getAverageTravelTime();
+    chunk.congestedRoutes[row] = congested;
+    chunk.activeEvents[row] = activeEvents;
+    chunk.rows++;
+    sampleCount++;
+
+    if (chunk.rows == CHUNK_ROWS) {
+        // Jamais plein : la file peut contenir tous les blocs de l'anneau
+        filled.push(current);
+        current = nullptr;
+    }
+}
+
+void MetricsExporter::writerLoop() {
+    writeHeader();
+    BinaryWriter out;
+    Chunk* chunk;
+    for (;;) {
+        // Lu avant de vider la file : tout bloc transmis avant la fin est écrit
+        bool done = finishing.load(std::memory_order_acquire);
+        while (filled.pop(chunk)) {
+            if (format == MetricsFormat::CSV) {
+                writeChunkCsv(*chunk);
+            } else {
+                out.clear();
+                writeChunk(*chunk, out);
+                file.write(reinterpret_cast<const char*>(out.data().data()), static_cast<std::streamsize>(out.size()));
+            }
+            if (!file) {
+                writeFailed.store(true, std::memory_order_release);
+            }
+            chunk->rows = 0;
+            recycled.push(chunk);
+        }
+        if (done) {
+            break;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+    if (format != MetricsFormat::CSV) {
+        out.clear();
+        out.writeU8(static_cast<uint8_t>(MetricsTag::END));
+        out.writeVarint(droppedSamples);
+        file.write(reinterpret_cast<const char*>(out.data().data()), static_cast<std::streamsize>(out.size()));
+    }
+    file.flush();
+    if (!file) {
+        writeFailed.store(true, std::memory_order_release);
+    }
+}
+
+void MetricsExporter::writeHeader() {
+    if (format == MetricsFormat::CSV) {
+        file << "time,vehicles,completed_trips,reroutings,mean_travel_time,congested_routes,active_events";
+        for (int id : routeIds) {
+            file << ",speed_" << id << ",occupancy_" << id << ",state_" << id;
+        }
+        file << '\n';
+        return;
+    }
+    BinaryWriter out;
+    for (char c : METRICS_MAGIC) {
+        out.writeU8(static_cast<uint8_t>(c));
+    }
+    out.writeU32(METRICS_VERSION);
+    out.writeU8(format == MetricsFormat::COLUMNAR_COMPRESSED ? 1 : 0);
+    out.writeU64(fingerprint);
+    out.writeVarint(routeIds.size());
+    int previous = 0;
+    for (int id : routeIds) {
+        out.writeSigned(id - previous);
+        previous = id;
+    }
+    file.write(reinterpret_cast<const char*>(out.data().data()), static_cast<std::streamsize>(out.size()));
+}
+
+void MetricsExporter::writeChunk(const Chunk& chunk, BinaryWriter& out) {
+    bool compressed = (format == MetricsFormat::COLUMNAR_COMPRESSED);
+    size_t rows = chunk.rows;
+    out.writeU8(static_cast<uint8_t>(MetricsTag::CHUNK));
+    out.writeVarint(rows);
+    writeFloats(out, chunk.time.data(), rows, compressed);
+    writeCounts(out, chunk.vehicles.data(), rows, compressed);
+    writeCounts(out, chunk.completedTrips.data(), rows, compressed);
+    writeCounts(out, chunk.reroutings.data(), rows, compressed);
+    writeFloats(out, chunk.meanTravelTime.data(), rows, compressed);
+    writeCounts(out, chunk.congestedRoutes.data(), rows, compressed);
+    writeCounts(out, chunk.activeEvents.data(), rows, compressed);
+    for (size_t r = 0; r < routeIds.size(); r++) {
+        size_t first = r * CHUNK_ROWS;
+        writeFloats(out, chunk.routeSpeed.data() + first, rows, compressed);
+        writeCounts(out, chunk.routeOccupancy.data() + first, rows, compressed);
+        writeStates(out, chunk.routeState.data() + first, rows, compressed);
+    }
+}
+
+void MetricsExporter::writeChunkCsv(const Chunk& chunk) {
+    for (size_t row = 0; row < chunk.rows; row++) {
+        file << chunk.time[row] << ',' << chunk.vehicles[row] << ',' << chunk.completedTrips[row] << ','
+             << chunk.reroutings[row] << ',' << chunk.meanTravelTime[row] << ',' << chunk.congestedRoutes[row] << ','
+             << chunk.activeEvents[row];
+        for (size_t r = 0; r < routeIds.size(); r++) {
+            size_t cell = r * CHUNK_ROWS + row;
+            file << ',' << chunk.routeSpeed[cell] << ',' << chunk.routeOccupancy[cell] << ','
+                 << static_cast<int>(chunk.routeState[cell]);
+        }
+        file << '\n';
+    }
+}
+
+bool MetricsExporter::load(const std::string& path, MetricsTable& table) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file) {
+        return false;
+    }
+    std::vector<unsigned char> data((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    if (data.size() < sizeof(METRICS_MAGIC) || std::memcmp(data.data(), METRICS_MAGIC, sizeof(METRICS_MAGIC)) != 0) {
+        return false;
+    }
+
+    BinaryReader in(data.data() + sizeof(METRICS_MAGIC), data.size() - sizeof(METRICS_MAGIC));
+    if (in.readU32() != METRICS_VERSION) {
+        return false;
+    }
+    bool compressed = in.readU8() != 0;
+    in.readU64();
+    table = MetricsTable();
+    table.routeIds.resize(in.readCount());
+    int previous = 0;
+    for (int& id : table.routeIds) {
+        previous += static_cast<int>(in.readSigned());
+        id = previous;
+    }
+    size_t routeCount = table.routeIds.size();
+    table.routeSpeed.resize(routeCount);
+    table.routeOccupancy.resize(routeCount);
+    table.routeState.resize(routeCount);
+
+    for (;;) {
+        uint8_t tag = in.readU8();
+        if (!in.ok()) {
+            return false;   // Fichier tronqué (pas d'enregistrement END)
+        }
+        if (tag == static_cast<uint8_t>(MetricsTag::END)) {
+            table.droppedSamples = in.readVarint();
+            return in.ok();
+        }
+        if (tag != static_cast<uint8_t>(MetricsTag::CHUNK)) {
+            return false;
+        }
+        size_t rows = in.readCount();
+        readFloats(in, table.time, rows, compressed);
+        readCounts(in, table.vehicles, rows, compressed);
+        readCounts(in, table.completedTrips, rows, compressed);
+        readCounts(in, table.reroutings, rows, compressed);
+        readFloats(in, table.meanTravelTime, rows, compressed);
+        readCounts(in, table.congestedRoutes, rows, compressed);
+        readCounts(in, table.activeEvents, rows, compressed);
+        for (size_t r = 0; r < routeCount; r++) {
+            readFloats(in, table.routeSpeed[r], rows, compressed);
+            readCounts(in, table.routeOccupancy[r], rows, compressed);
+            if (!readStates(in, table.routeState[r], rows, compressed)) {
+                return false;
+            }
+        }
+        if (!in.ok()) {
+            return false;
+        }
+    }
+}
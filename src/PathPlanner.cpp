@@ -1,6 +1,8 @@
 #include "PathPlanner.h"
 #include "PathfindingStrategy.h"
 #include "Graph.h"
+#include "TaskScheduler.h"
+#include "Tracing.h"
 
 PathPlanner::PathPlanner(const Graph* graph) 
     : graph(graph), strategy(std::make_unique<AStarStrategy>()) {
@@ -15,10 +17,39 @@ void PathPlanner::setStrategy(std::unique_ptr<PathfindingStrategy> newStrategy)
 }
 
 std::vector<int> PathPlanner::planPath(int start, int end) const {
+    TRACE_ZONE("PathPlanner::planPath");
     if (!strategy) {
         return std::vector<int>();
     }
-    return strategy->findPath(*graph, start, end);
+    SearchStats stats;
+    std::vector<int> path = strategy->findPath(*graph, start, end, &stats);
+    totals.searches.fetch_add(stats.searches, std::memory_order_relaxed);
+    totals.nodesSettled.fetch_add(stats.nodesSettled, std::memory_order_relaxed);
+    totals.edgesRelaxed.fetch_add(stats.edgesRelaxed, std::memory_order_relaxed);
+    totals.heapPushes.fetch_add(stats.heapPushes, std::memory_order_relaxed);
+    totals.heapPops.fetch_add(stats.heapPops, std::memory_order_relaxed);
+    totals.time.fetch_add(stats.time, std::memory_order_relaxed);
+    return path;
+}
+
+SearchStats PathPlanner::getSearchStats() const {
+    SearchStats stats;
+    stats.searches = totals.searches.load(std::memory_order_relaxed);
+    stats.nodesSettled = totals.nodesSettled.load(std::memory_order_relaxed);
+    stats.edgesRelaxed = totals.edgesRelaxed.load(std::memory_order_relaxed);
+    stats.heapPushes = totals.heapPushes.load(std::memory_order_relaxed);
+    stats.heapPops = totals.heapPops.load(std::memory_order_relaxed);
+    stats.time = totals.time.load(std::memory_order_relaxed);
+    return stats;
+}
+
+void PathPlanner::resetSearchStats() {
+    totals.searches.store(0, std::memory_order_relaxed);
+    totals.nodesSettled.store(0, std::memory_order_relaxed);
+    totals.edgesRelaxed.store(0, std::memory_order_relaxed);
+    totals.heapPushes.store(0, std::memory_order_relaxed);
+    totals.heapPops.store(0, std::memory_order_relaxed);
+    totals.time.store(0, std::memory_order_relaxed);
 }
 
 std::vector<int> PathPlanner::replanPath(int start, int end, 
@@ -31,3 +62,21 @@ std::vector<int> PathPlanner::replanPath(int start, int end,
     return planPath(currentPosition, end);
 }
 
+
+std::vector<std::vector<int>> PathPlanner::planPaths(const std::vector<std::pair<int, int>>& requests,
+                                                     TaskScheduler* scheduler) const {
+    std::vector<std::vector<int>> paths(requests.size());
+    auto planRange = [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; i++) {
+            paths[i] = planPath(requests[i].first, requests[i].second);
+        }
+    };
+    
+    if (scheduler) {
+        // Une recherche A* est coûteuse : petits blocs pour bien répartir la charge
+        scheduler->parallelFor(requests.size(), 4, planRange);
+    } else {
+        planRange(0, requests.size());
+    }
+    return paths;
+}
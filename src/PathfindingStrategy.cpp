@@ -1,10 +1,38 @@
 #include "PathfindingStrategy.h"
 #include "Route.h"
+#include "Tracing.h"
 #include <queue>
 #include <unordered_map>
 #include <algorithm>
 #include <limits>
 #include <cmath>
+#include <chrono>
+
+namespace {
+
+// Compteurs d'une recherche, ajoutés aux statistiques demandées à la sortie (y compris anticipée)
+class SearchRecorder {
+public:
+    explicit SearchRecorder(SearchStats* out) : out(out), start(std::chrono::steady_clock::now()) {
+        counts.searches = 1;
+    }
+    
+    ~SearchRecorder() {
+        if (out) {
+            counts.time = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now() - start).count());
+            out->add(counts);
+        }
+    }
+    
+    SearchStats counts;
+    
+private:
+    SearchStats* out;
+    std::chrono::steady_clock::time_point start;
+};
+
+} // namespace
 
 // Structure pour A* algorithm
 struct AStarNode {
@@ -31,8 +59,8 @@ struct DijkstraNode {
 };
 
 float AStarStrategy::heuristic(const Graph& graph, int node1, int node2) const {
-    Node* n1 = graph.getNode(node1);
-    Node* n2 = graph.getNode(node2);
+    const Node* n1 = graph.getNode(node1);
+    const Node* n2 = graph.getNode(node2);
     
     if (!n1 || !n2) {
         return std::numeric_limits<float>::max();
@@ -57,7 +85,9 @@ std::vector<int> AStarStrategy::reconstructPath(const std::unordered_map<int, in
     return path;
 }
 
-std::vector<int> AStarStrategy::findPath(const Graph& graph, int start, int end) const {
+std::vector<int> AStarStrategy::findPath(const Graph& graph, int start, int end, SearchStats* stats) const {
+    TRACE_ZONE("AStarStrategy::findPath");
+    SearchRecorder recorder(stats);
     if (start == end) {
         return std::vector<int>{start};
     }
@@ -75,16 +105,19 @@ std::vector<int> AStarStrategy::findPath(const Graph& graph, int start, int end)
     startNode.hCost = heuristic(graph, start, end);
     startNode.parent = -1;
     openSet.push(startNode);
+    recorder.counts.heapPushes++;
     
     while (!openSet.empty()) {
         AStarNode current = openSet.top();
         openSet.pop();
+        recorder.counts.heapPops++;
         
         if (closedSet[current.nodeId]) {
             continue;
         }
         
         closedSet[current.nodeId] = true;
+        recorder.counts.nodesSettled++;
         
         if (current.nodeId == end) {
             return reconstructPath(cameFrom, end);
@@ -137,6 +170,8 @@ std::vector<int> AStarStrategy::findPath(const Graph& graph, int start, int end)
                 neighborNode.hCost = heuristic(graph, neighborId, end);
                 neighborNode.parent = current.nodeId;
                 openSet.push(neighborNode);
+                recorder.counts.edgesRelaxed++;
+                recorder.counts.heapPushes++;
             }
         }
     }
@@ -145,7 +180,9 @@ std::vector<int> AStarStrategy::findPath(const Graph& graph, int start, int end)
     return std::vector<int>();
 }
 
-std::vector<int> DijkstraStrategy::findPath(const Graph& graph, int start, int end) const {
+std::vector<int> DijkstraStrategy::findPath(const Graph& graph, int start, int end, SearchStats* stats) const {
+    TRACE_ZONE("DijkstraStrategy::findPath");
+    SearchRecorder recorder(stats);
     if (start == end) {
         return std::vector<int>{start};
     }
@@ -162,16 +199,19 @@ std::vector<int> DijkstraStrategy::findPath(const Graph& graph, int start, int e
     startNode.distance = 0.0f;
     startNode.parent = -1;
     pq.push(startNode);
+    recorder.counts.heapPushes++;
     
     while (!pq.empty()) {
         DijkstraNode current = pq.top();
         pq.pop();
+        recorder.counts.heapPops++;
         
         if (visited[current.nodeId]) {
             continue;
         }
         
         visited[current.nodeId] = true;
+        recorder.counts.nodesSettled++;
         
         if (current.nodeId == end) {
             // Reconstruction du chemin
@@ -230,6 +270,8 @@ std::vector<int> DijkstraStrategy::findPath(const Graph& graph, int start, int e
                 neighborNode.distance = newDistance;
                 neighborNode.parent = current.nodeId;
                 pq.push(neighborNode);
+                recorder.counts.edgesRelaxed++;
+                recorder.counts.heapPushes++;
             }
         }
     }
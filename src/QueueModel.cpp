@@ -0,0 +1,257 @@
+#include "QueueModel.h"
+#include "Vehicle.h"
+#include "TaskScheduler.h"
+#include <algorithm>
+
+void QueueModel::RouteQueue::push(uint32_t slot) {
+    if (count == ring.size()) {
+        // Dépliage de l'anneau dans un tableau deux fois plus grand
+        std::vector<uint32_t> grown(std::max<size_t>(4, ring.size() * 2));
+        for (size_t i = 0; i < count; i++) {
+            grown[i] = at(i);
+        }
+        ring.swap(grown);
+        head = 0;
+    }
+    ring[(head + count) % ring.size()] = slot;
+    count++;
+}
+
+void QueueModel::RouteQueue::pop() {
+    head = (head + 1) % ring.size();
+    count--;
+}
+
+bool QueueModel::RouteQueue::erase(uint32_t slot) {
+    for (size_t rank = 0; rank < count; rank++) {
+        if (at(rank) == slot) {
+            // Décalage des suivants pour conserver l'ordre FIFO
+            for (size_t i = rank; i + 1 < count; i++) {
+                ring[(head + i) % ring.size()] = at(i + 1);
+            }
+            count--;
+            return true;
+        }
+    }
+    return false;
+}
+
+QueueModel::QueueModel(const Graph* graph) : graph(graph), clock(0.0f) {
+    reset();
+}
+
+void QueueModel::reset() {
+    const auto& routes = graph->getRoutes();
+    queues.assign(routes.size(), RouteQueue());
+    flowCapacity.assign(routes.size(), 0.0f);
+    for (size_t i = 0; i < routes.size(); i++) {
+        // Débit : la capacité de la route s'écoule en un temps de parcours à vide
+        const Route* route = routes[i].get();
+        float freeFlowTime = route->getLength() / std::max(1.0f, route->getBaseSpeed() / 3.6f);
+        flowCapacity[i] = route->getCapacity() / std::max(0.1f, freeFlowTime);
+    }
+    slots.clear();
+    freeSlots.clear();
+    slotByVehicle.clear();
+}
+
+uint32_t QueueModel::allocateSlot(Vehicle* vehicle) {
+    uint32_t slot;
+    if (!freeSlots.empty()) {
+        slot = freeSlots.back();
+        freeSlots.pop_back();
+    } else {
+        slot = static_cast<uint32_t>(slots.size());
+        slots.push_back(Slot());
+    }
+    slots[slot] = Slot{vehicle, -1, clock, clock};
+    slotByVehicle[vehicle] = slot;
+    return slot;
+}
+
+void QueueModel::releaseSlot(uint32_t slot) {
+    slotByVehicle.erase(slots[slot].vehicle);
+    slots[slot].vehicle = nullptr;
+    freeSlots.push_back(slot);
+}
+
+float QueueModel::travelTime(int routeIndex) const {
+    const Route* route = graph->getRoutes()[routeIndex].get();
+    // Vitesse courante (trafic, événements), 1 m/s minimum pour une route ralentie à l'extrême
+    return route->getLength() / std::max(1.0f, route->getCurrentSpeed() / 3.6f);
+}
+
+void QueueModel::push(uint32_t slot, int routeIndex, float remainingFraction) {
+    float duration = travelTime(routeIndex);
+    Slot& entry = slots[slot];
+    entry.routeIndex = routeIndex;
+    entry.readyTime = clock + duration * remainingFraction;
+    entry.enterTime = entry.readyTime - duration;
+    queues[routeIndex].push(slot);
+}
+
+void QueueModel::enter(Vehicle* vehicle, float remainingFraction) {
+    const auto& pathRoutes = vehicle->getPathRoutes();
+    size_t edge = vehicle->getCurrentRouteIndex();
+    if (edge >= pathRoutes.size() || pathRoutes[edge] < 0 || vehicle->hasReachedDestination()) {
+        return;
+    }
+    if (slotByVehicle.count(vehicle)) {
+        remove(vehicle);
+    }
+    push(allocateSlot(vehicle), pathRoutes[edge], std::max(0.0f, std::min(1.0f, remainingFraction)));
+}
+
+void QueueModel::remove(Vehicle* vehicle) {
+    auto it = slotByVehicle.find(vehicle);
+    if (it == slotByVehicle.end()) {
+        return;
+    }
+    uint32_t slot = it->second;
+    int routeIndex = slots[slot].routeIndex;
+    if (routeIndex >= 0) {
+        queues[routeIndex].erase(slot);
+    }
+    releaseSlot(slot);
+}
+
+void QueueModel::step(float deltaTime, std::vector<VehicleMove>& moves,
+                      std::vector<Vehicle*>& blocked, TaskScheduler*) {
+    clock += deltaTime;
+    const auto& routes = graph->getRoutes();
+
+    // Routes parcourues dans l'ordre des index : résultat déterministe
+    for (size_t r = 0; r < queues.size(); r++) {
+        RouteQueue& queue = queues[r];
+        if (queue.count == 0) {
+            queue.flowCredit = 0.0f;
+            continue;
+        }
+        float inflow = flowCapacity[r] * deltaTime;
+        queue.flowCredit = std::min(std::max(1.0f, inflow), queue.flowCredit + inflow);
+
+        while (queue.count > 0 && queue.flowCredit >= 1.0f) {
+            uint32_t slot = queue.front();
+            Slot& head = slots[slot];
+            if (clock < head.readyTime) {
+                break;  // Tête pas encore en bout de route : toute la file attend
+            }
+
+            Vehicle* vehicle = head.vehicle;
+            if (!routes[r]->isUsable()) {
+                if (!vehicle->needsReroutingCheck()) {
+                    vehicle->requestRerouting();
+                    blocked.push_back(vehicle);
+                }
+                break;
+            }
+
+            int edge = vehicle->getCurrentRouteIndex();
+            const auto& pathRoutes = vehicle->getPathRoutes();
+            int nextRoute = (edge + 1 < static_cast<int>(pathRoutes.size())) ? pathRoutes[edge + 1] : -1;
+
+            if (nextRoute >= 0) {
+                if (!routes[nextRoute]->isUsable()) {
+                    if (!vehicle->needsReroutingCheck()) {
+                        vehicle->requestRerouting();
+                        blocked.push_back(vehicle);
+                    }
+                    break;
+                }
+                bool full = owns(nextRoute) ? queues[nextRoute].count >= storageCapacity(*routes[nextRoute])
+                                            : !peer->canEnter(nextRoute);
+                if (full && clock - head.readyTime < STUCK_TIME) {
+                    break;  // Remontée de file : la route suivante est pleine
+                }
+            }
+
+            queue.pop();
+            queue.flowCredit -= 1.0f;
+            vehicle->advanceToNextRoute();
+            moves.push_back(VehicleMove{vehicle, edge});
+
+            if (nextRoute >= 0 && !vehicle->hasReachedDestination() && owns(nextRoute)) {
+                push(slot, nextRoute, 1.0f);
+            } else {
+                releaseSlot(slot);  // Arrivé (ou fin de chemin résolu)
+                if (nextRoute >= 0 && !vehicle->hasReachedDestination()) {
+                    // Route suivante gérée par le modèle voisin, à la vitesse de la route quittée
+                    peer->acceptHandoff(vehicle, routes[r]->getLength() / travelTime(static_cast<int>(r)));
+                }
+            }
+        }
+    }
+}
+
+void QueueModel::getRouteVehicles(int routeIndex, std::vector<Vehicle*>& out) const {
+    const RouteQueue& queue = queues[routeIndex];
+    for (size_t rank = 0; rank < queue.count; rank++) {
+        out.push_back(slots[queue.at(rank)].vehicle);
+    }
+}
+
+void QueueModel::saveState(BinaryWriter& out) const {
+    out.writeFloat(clock);
+    out.writeVarint(queues.size());
+    for (const RouteQueue& queue : queues) {
+        out.writeFloat(queue.flowCredit);
+        out.writeVarint(queue.count);
+        for (size_t rank = 0; rank < queue.count; rank++) {
+            const Slot& entry = slots[queue.at(rank)];
+            out.writeVarint(entry.vehicle->getId());
+            out.writeFloat(entry.enterTime);
+            out.writeFloat(entry.readyTime);
+        }
+    }
+}
+
+bool QueueModel::loadState(BinaryReader& in, const std::function<Vehicle*(int)>& findVehicle) {
+    clock = in.readFloat();
+    if (in.readCount() != queues.size()) {
+        return false;
+    }
+    for (size_t r = 0; r < queues.size(); r++) {
+        queues[r].flowCredit = in.readFloat();
+        size_t count = in.readCount();
+        for (size_t rank = 0; rank < count; rank++) {
+            Vehicle* vehicle = findVehicle(static_cast<int>(in.readVarint()));
+            float enterTime = in.readFloat();
+            float readyTime = in.readFloat();
+            if (!vehicle || slotByVehicle.count(vehicle)) {
+                return false;
+            }
+            uint32_t slot = allocateSlot(vehicle);
+            slots[slot].routeIndex = static_cast<int>(r);
+            slots[slot].enterTime = enterTime;
+            slots[slot].readyTime = readyTime;
+            queues[r].push(slot);
+        }
+    }
+    return in.ok();
+}
+
+void QueueModel::refreshPositions(TaskScheduler* scheduler) {
+    auto refresh = [this](size_t begin, size_t end) {
+        for (size_t r = begin; r < end; r++) {
+            const RouteQueue& queue = queues[r];
+            if (queue.count == 0) {
+                continue;
+            }
+            // Les véhicules en attente se répartissent derrière la tête de file
+            float spacing = 1.0f / static_cast<float>(std::max(queue.count, storageCapacity(*graph->getRoutes()[r])));
+            for (size_t rank = 0; rank < queue.count; rank++) {
+                const Slot& entry = slots[queue.at(rank)];
+                float duration = std::max(0.001f, entry.readyTime - entry.enterTime);
+                float elapsed = (clock - entry.enterTime) / duration;
+                float progress = std::min(elapsed, 1.0f - spacing * rank);
+                entry.vehicle->setProgress(progress);
+                entry.vehicle->calculatePosition(*graph);
+            }
+        }
+    };
+    if (scheduler) {
+        scheduler->parallelFor(queues.size(), 256, refresh);
+    } else {
+        refresh(0, queues.size());
+    }
+}
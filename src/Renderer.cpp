@@ -3,6 +3,7 @@
 #include "Graph.h"
 #include "Vehicle.h"
 #include "Event.h"
+#include "Tracing.h"
 #include <cmath>
 #include <sstream>
 #include <algorithm>
@@ -22,7 +23,7 @@ Renderer::Renderer(int width, int height)
       nodeColor(LIGHTGRAY),
       backgroundColor(BLACK),
       scale(1.0f), offset({0.0f, 0.0f}),
-      texturesLoaded(false) {
+      texturesLoaded(false), profilerVisible(false) {
     
     camera.target = {0.0f, 0.0f};
     camera.offset = {width / 2.0f, height / 2.0f};
@@ -169,48 +170,61 @@ void Renderer::endFrame() {
     }
 }
 
-void Renderer::renderSimulation(const Simulation& simulation) {
+void Renderer::renderSimulation(const FrameSnapshot& frame, const Graph& graph) {
+    TRACE_ZONE("Renderer::renderSimulation");
+    profiler.beginFrame(frame.profile, frame.totalReroutings);
     
     try {
-        const Graph* graph = simulation.getGraph();
-        if (graph) {
-            renderGraph(*graph);  
-        }
+        TRACE_ZONE("Renderer::renderGraph");
+        ProfileTimer timer(profiler, ProfilePhase::RENDER_GRAPH);
+        renderGraph(graph, frame.routeStates);
     } catch (...) {
         
     }
     
     try {
-        
-        renderVehicles(simulation.getVehicles());
+        TRACE_ZONE("Renderer::renderVehicles");
+        ProfileTimer timer(profiler, ProfilePhase::RENDER_VEHICLES);
+        // Position entre les deux derniers ticks selon le temps réel écoulé
+        renderVehicles(frame.vehicles, frame.interpolation(snapshotClock()));
     } catch (...) {
        
     }
     
     try {
-        const Graph* graph = simulation.getGraph();
-        if (graph) {
-           
-            renderEvents(simulation.getEvents(), *graph);
-        }
+        TRACE_ZONE("Renderer::renderEvents");
+        ProfileTimer timer(profiler, ProfilePhase::RENDER_EVENTS);
+        renderEvents(frame.events, graph);
     } catch (...) {
         
     }
     
     try {
-    renderUI(simulation);
+    TRACE_ZONE("Renderer::renderUI");
+    ProfileTimer timer(profiler, ProfilePhase::RENDER_UI);
+    renderUI(frame);
     } catch (...) {
     
     }
     
     try {
+        TRACE_ZONE("Renderer::renderNotifications");
+        ProfileTimer timer(profiler, ProfilePhase::RENDER_NOTIFICATIONS);
         renderNotifications();
     } catch (...) {
         
     }
+    
+    if (profilerVisible) {
+        try {
+            renderProfiler();
+        } catch (...) {
+            BeginMode2D(camera);
+        }
+    }
 }
 
-void Renderer::renderGraph(const Graph& graph) {
+void Renderer::renderGraph(const Graph& graph, const std::vector<RouteState>& routeStates) {
     float currentTime = GetTime();
     float dayCycle = sinf(currentTime * 0.1f) * 0.3f + 0.7f; 
     Color bgColor = {
@@ -221,12 +235,29 @@ void Renderer::renderGraph(const Graph& graph) {
     };
     ClearBackground(bgColor);
     
-   
-    for (const auto& route : graph.getRoutes()) {
+    // Largeur de la route (AUGMENTÉE pour meilleure visibilité)
+    float roadWidth = 35.0f;  // Augmenté de 28 à 35
+    float borderWidth = 3.0f;  // Augmenté de 2.5 à 3
+    
+    // Zone visible (coordonnées du monde) : sur un grand réseau, seul ce qui la touche est dessiné
+    float viewMinX, viewMinY, viewMaxX, viewMaxY;
+    getVisibleArea(viewMinX, viewMinY, viewMaxX, viewMaxY);
+    auto isVisible = [=](float x1, float y1, float x2, float y2, float margin) {
+        return std::max(x1, x2) + margin >= viewMinX && std::min(x1, x2) - margin <= viewMaxX &&
+               std::max(y1, y2) + margin >= viewMinY && std::min(y1, y2) - margin <= viewMaxY;
+    };
+    // Vue éloignée (route de moins de 6 pixels à l'écran) : un simple trait par route, ni maisons ni carrefours
+    bool detailed = roadWidth * camera.zoom >= 6.0f;
+    
+    const auto& routes = graph.getRoutes();
+    for (size_t routeIndex = 0; routeIndex < routes.size(); routeIndex++) {
+        const Route* route = routes[routeIndex].get();
         if (!route) continue;
+        // État publié par la simulation (le graphe n'est lu que pour sa géométrie)
+        RouteState routeState = routeIndex < routeStates.size() ? routeStates[routeIndex] : RouteState::NORMAL;
         
-        Node* fromNode = graph.getNode(route->getFromNode());
-        Node* toNode = graph.getNode(route->getToNode());
+        const Node* fromNode = graph.getNode(route->getFromNode());
+        const Node* toNode = graph.getNode(route->getToNode());
         
         if (!fromNode || !toNode) continue;
         
@@ -236,9 +267,17 @@ void Renderer::renderGraph(const Graph& graph) {
             continue;
         }
         
+        if (!isVisible(fromNode->x, fromNode->y, toNode->x, toNode->y, roadWidth)) continue;
+        
         Vector2 start = {fromNode->x, fromNode->y};
         Vector2 end = {toNode->x, toNode->y};
         
+        if (!detailed) {
+            Color lineColor = routeState == RouteState::NORMAL ? Color{70, 70, 75, 255}
+                            : routeState == RouteState::CONGESTED ? Color{255, 200, 0, 255} : Color{255, 0, 0, 255};
+            DrawLineEx(start, end, std::max(roadWidth, 1.5f / camera.zoom), lineColor);
+            continue;
+        }
       
         float dx = end.x - start.x;
         float dy = end.y - start.y;
@@ -250,15 +289,11 @@ void Renderer::renderGraph(const Graph& graph) {
         float perpX = -dy / length;
         float perpY = dx / length;
         
-        // Largeur de la route (AUGMENTÉE pour meilleure visibilité)
-        float roadWidth = 35.0f;  // Augmenté de 28 à 35
-        float borderWidth = 3.0f;  // Augmenté de 2.5 à 3
-        
         // Couleur de base selon l'état (PLUS CONTRASTÉE)
         Color asphaltColor = {55, 55, 60, 255};  // Plus sombre pour meilleur contraste
         Color statusColor = {0, 0, 0, 0};
         
-        switch (route->getState()) {
+        switch (routeState) {
             case RouteState::NORMAL:
                 asphaltColor = {55, 55, 60, 255};  // Asphalte plus sombre
                 break;
@@ -318,150 +353,115 @@ void Renderer::renderGraph(const Graph& graph) {
         // 5. Indicateur d'état pour routes congestionnées ou bloquées (AMÉLIORÉ)
         if (statusColor.a > 0) {
             // Effet de pulsation pour routes bloquées
-            if (route->getState() == RouteState::BLOCKED || route->getState() == RouteState::ACCIDENT) {
+            if (routeState == RouteState::BLOCKED || routeState == RouteState::ACCIDENT) {
                 float pulse = sinf(currentTime * 3.0f) * 0.3f + 0.7f;
                 statusColor.a = (unsigned char)(150 * pulse);
             }
             DrawLineEx(start, end, roadWidth * 0.8f, statusColor);
             
             // Halo autour des routes bloquées
-            if (route->getState() == RouteState::BLOCKED || route->getState() == RouteState::ACCIDENT) {
+            if (routeState == RouteState::BLOCKED || routeState == RouteState::ACCIDENT) {
                 DrawLineEx(start, end, roadWidth * 1.2f, {255, 50, 50, 60});
             }
         }
     }
     
     // Ajouter des MAISONS 2D DÉTAILLÉES dans les CARRÉS VERTS (espaces entre les routes)
-    // Structure : Grille 6x6 avec espacement de 130px
-    // Les carrés sont formés par 4 nœuds adjacents
-    const float spacing = 130.0f;
-    const int gridSize = 6;
-    
-    // Parcourir tous les carrés de la grille (5x5 carrés pour une grille 6x6)
-    for (int row = 0; row < gridSize - 1; row++) {
-        for (int col = 0; col < gridSize - 1; col++) {
-            // Trouver les 4 nœuds formant ce carré
-            Node* topLeft = nullptr;
-            Node* topRight = nullptr;
-            Node* bottomLeft = nullptr;
-            Node* bottomRight = nullptr;
+    // Les carrés sont les îlots à 4 côtés du réseau, quelle que soit sa forme
+    const std::vector<Vector2>& blocks = getBlockCenters(graph);
+    for (size_t block = 0; detailed && block < blocks.size(); block++) {
+        if (!isVisible(blocks[block].x, blocks[block].y, blocks[block].x, blocks[block].y, 60.0f)) continue;
+        
+        // Centre du carré (espace vert) - bien au milieu pour éviter les routes
+        float centerX = blocks[block].x;
+        float centerY = blocks[block].y;
+        
+        // Placer 1 seule maison bien centrée dans chaque bloc
+        int numHouses = 1;
+        
+        for (int i = 0; i < numHouses; i++) {
+            // Variété de maisons : différentes tailles et styles
+            int houseType = (int)((block + i) % 3);
+            float buildingWidth, buildingHeight;
+            Color houseColor;
             
-            // Chercher les nœuds correspondants dans le graphe
-            for (const auto& node : graph.getNodes()) {
-                if (!node) continue;
-                float expectedX = col * spacing;
-                float expectedY = row * spacing;
-                float expectedX2 = (col + 1) * spacing;
-                float expectedY2 = (row + 1) * spacing;
-                
-                // Tolérance pour les comparaisons flottantes
-                const float tolerance = 1.0f;
-                
-                if (std::abs(node->x - expectedX) < tolerance && std::abs(node->y - expectedY) < tolerance) {
-                    topLeft = node.get();
-                } else if (std::abs(node->x - expectedX2) < tolerance && std::abs(node->y - expectedY) < tolerance) {
-                    topRight = node.get();
-                } else if (std::abs(node->x - expectedX) < tolerance && std::abs(node->y - expectedY2) < tolerance) {
-                    bottomLeft = node.get();
-                } else if (std::abs(node->x - expectedX2) < tolerance && std::abs(node->y - expectedY2) < tolerance) {
-                    bottomRight = node.get();
-                }
+            switch (houseType) {
+                case 0:  // Petite maison
+                    buildingWidth = 22.0f;
+                    buildingHeight = 30.0f;
+                    houseColor = {120, 100, 80, 255};  // Beige
+                    break;
+                case 1:  // Maison moyenne
+                    buildingWidth = 30.0f;
+                    buildingHeight = 42.0f;
+                    houseColor = {100, 120, 100, 255};  // Vert clair
+                    break;
+                default:  // Grande maison grise
+                    buildingWidth = 38.0f;
+                    buildingHeight = 55.0f;
+                    houseColor = {90, 90, 110, 255};  // Gris bleu
+                    break;
             }
             
-            // Si on a trouvé les 4 coins, placer une maison au centre du carré
-            if (topLeft && topRight && bottomLeft && bottomRight) {
-                // Centre du carré (espace vert) - bien au milieu pour éviter les routes
-                float centerX = (topLeft->x + topRight->x) / 2.0f;
-                float centerY = (topLeft->y + bottomLeft->y) / 2.0f;
-                
-                // Placer 1 seule maison bien centrée dans chaque bloc
-                int numHouses = 1;
-                
-                for (int i = 0; i < numHouses; i++) {
-                    // Variété de maisons : différentes tailles et styles
-                    int houseType = (row + col + i) % 3;
-                    float buildingWidth, buildingHeight;
-                    Color houseColor;
-                    
-                    switch (houseType) {
-                        case 0:  // Petite maison
-                            buildingWidth = 22.0f;
-                            buildingHeight = 30.0f;
-                            houseColor = {120, 100, 80, 255};  // Beige
-                            break;
-                        case 1:  // Maison moyenne
-                            buildingWidth = 30.0f;
-                            buildingHeight = 42.0f;
-                            houseColor = {100, 120, 100, 255};  // Vert clair
-                            break;
-                        default:  // Grande maison grise
-                            buildingWidth = 38.0f;
-                            buildingHeight = 55.0f;
-                            houseColor = {90, 90, 110, 255};  // Gris bleu
-                            break;
-                    }
-                    
-                    // Ajustement de position - la grande maison grise est décalée vers le haut
-                    float offsetX = 0.0f;
-                    float offsetY = (houseType == 2) ? -12.0f : 0.0f;  // Grande maison grise 12 pixels plus haut
-                    float buildingX = centerX + offsetX;
-                    float buildingY = centerY + offsetY;
+            // Ajustement de position - la grande maison grise est décalée vers le haut
+            float offsetX = 0.0f;
+            float offsetY = (houseType == 2) ? -12.0f : 0.0f;  // Grande maison grise 12 pixels plus haut
+            float buildingX = centerX + offsetX;
+            float buildingY = centerY + offsetY;
+    
+            // Ombre du bâtiment
+            DrawRectangle(buildingX + 4, buildingY + 4, buildingWidth, buildingHeight, {0, 0, 0, 120});
             
-                    // Ombre du bâtiment
-                    DrawRectangle(buildingX + 4, buildingY + 4, buildingWidth, buildingHeight, {0, 0, 0, 120});
-                    
-                    // Corps principal du bâtiment
-                    DrawRectangle(buildingX, buildingY, buildingWidth, buildingHeight, houseColor);
-                    DrawRectangleLines(buildingX, buildingY, buildingWidth, buildingHeight, {60, 60, 70, 255});
-                    
-                    // Toit triangulaire
-                    Vector2 roofTop = {buildingX + buildingWidth / 2.0f, buildingY - 6.0f};
-                    Vector2 roofLeft = {buildingX - 1.0f, buildingY};
-                    Vector2 roofRight = {buildingX + buildingWidth + 1.0f, buildingY};
-                    DrawTriangle(roofTop, roofLeft, roofRight, {100, 50, 50, 255});  // Toit rouge
-                    DrawTriangleLines(roofTop, roofLeft, roofRight, {80, 40, 40, 255});
-                    
-                    // Porte
-                    float doorWidth = 5.0f;
-                    float doorHeight = 10.0f;
-                    float doorX = buildingX + buildingWidth / 2.0f - doorWidth / 2.0f;
-                    float doorY = buildingY + buildingHeight - doorHeight;
-                    DrawRectangle(doorX, doorY, doorWidth, doorHeight, {60, 40, 30, 255});
-                    DrawRectangleLines(doorX, doorY, doorWidth, doorHeight, {40, 30, 20, 255});
+            // Corps principal du bâtiment
+            DrawRectangle(buildingX, buildingY, buildingWidth, buildingHeight, houseColor);
+            DrawRectangleLines(buildingX, buildingY, buildingWidth, buildingHeight, {60, 60, 70, 255});
+            
+            // Toit triangulaire
+            Vector2 roofTop = {buildingX + buildingWidth / 2.0f, buildingY - 6.0f};
+            Vector2 roofLeft = {buildingX - 1.0f, buildingY};
+            Vector2 roofRight = {buildingX + buildingWidth + 1.0f, buildingY};
+            DrawTriangle(roofTop, roofLeft, roofRight, {100, 50, 50, 255});  // Toit rouge
+            DrawTriangleLines(roofTop, roofLeft, roofRight, {80, 40, 40, 255});
+            
+            // Porte
+            float doorWidth = 5.0f;
+            float doorHeight = 10.0f;
+            float doorX = buildingX + buildingWidth / 2.0f - doorWidth / 2.0f;
+            float doorY = buildingY + buildingHeight - doorHeight;
+            DrawRectangle(doorX, doorY, doorWidth, doorHeight, {60, 40, 30, 255});
+            DrawRectangleLines(doorX, doorY, doorWidth, doorHeight, {40, 30, 20, 255});
+            
+            // Fenêtres animées
+            int windowRows = 2;
+            int windowCols = 2;
+            float windowSize = 4.0f;
+            float windowSpacing = 9.0f;
+            float windowStartX = buildingX + (buildingWidth - (windowCols - 1) * windowSpacing - windowSize) / 2.0f;
+            float windowStartY = buildingY + 8.0f;
+            
+            for (int winRow = 0; winRow < windowRows; winRow++) {
+                for (int winCol = 0; winCol < windowCols; winCol++) {
+                    float winX = windowStartX + winCol * windowSpacing;
+                    float winY = windowStartY + winRow * windowSpacing;
                     
-                    // Fenêtres animées
-                    int windowRows = 2;
-                    int windowCols = 2;
-                    float windowSize = 4.0f;
-                    float windowSpacing = 9.0f;
-                    float windowStartX = buildingX + (buildingWidth - (windowCols - 1) * windowSpacing - windowSize) / 2.0f;
-                    float windowStartY = buildingY + 8.0f;
+                    // Animation : fenêtres qui s'allument/éteignent
+                    float windowTime = currentTime + (block * 0.3f) + (winRow * 0.4f) + (winCol * 0.3f) + (i * 0.2f);
+                    float windowCycle = sinf(windowTime * 0.6f) + cosf(windowTime * 0.4f) * 0.5f;
                     
-                    for (int winRow = 0; winRow < windowRows; winRow++) {
-                        for (int winCol = 0; winCol < windowCols; winCol++) {
-                            float winX = windowStartX + winCol * windowSpacing;
-                            float winY = windowStartY + winRow * windowSpacing;
-                            
-                            // Animation : fenêtres qui s'allument/éteignent
-                            float windowTime = currentTime + (row * 0.5f) + (col * 0.3f) + (winRow * 0.4f) + (winCol * 0.3f) + (i * 0.2f);
-                            float windowCycle = sinf(windowTime * 0.6f) + cosf(windowTime * 0.4f) * 0.5f;
-                            
-                            Color windowColor;
-                            if (windowCycle > 0.5f) {
-                                windowColor = {255, 255, 180, 255};
-                                DrawCircle(winX + windowSize/2, winY + windowSize/2, windowSize * 0.8f, {255, 255, 150, 40});
-                            } else if (windowCycle > 0.0f) {
-                                windowColor = {180, 180, 120, 200};
-                            } else {
-                                windowColor = {30, 30, 40, 255};
-                            }
-                            
-                            DrawRectangle(winX, winY, windowSize, windowSize, windowColor);
-                            DrawRectangleLines(winX, winY, windowSize, windowSize, {20, 20, 30, 255});
-                            DrawLine(winX + windowSize/2, winY, winX + windowSize/2, winY + windowSize, {20, 20, 30, 200});
-                            DrawLine(winX, winY + windowSize/2, winX + windowSize, winY + windowSize/2, {20, 20, 30, 200});
-                        }
+                    Color windowColor;
+                    if (windowCycle > 0.5f) {
+                        windowColor = {255, 255, 180, 255};
+                        DrawCircle(winX + windowSize/2, winY + windowSize/2, windowSize * 0.8f, {255, 255, 150, 40});
+                    } else if (windowCycle > 0.0f) {
+                        windowColor = {180, 180, 120, 200};
+                    } else {
+                        windowColor = {30, 30, 40, 255};
                     }
+                    
+                    DrawRectangle(winX, winY, windowSize, windowSize, windowColor);
+                    DrawRectangleLines(winX, winY, windowSize, windowSize, {20, 20, 30, 255});
+                    DrawLine(winX + windowSize/2, winY, winX + windowSize/2, winY + windowSize, {20, 20, 30, 200});
+                    DrawLine(winX, winY + windowSize/2, winX + windowSize, winY + windowSize/2, {20, 20, 30, 200});
                 }
             }
         }
@@ -471,7 +471,10 @@ void Renderer::renderGraph(const Graph& graph) {
     // D'abord, identifier tous les nœuds qui font partie d'un rond-point
     std::unordered_set<int> roundaboutNodes;
     for (const auto& node : graph.getNodes()) {
+        if (!detailed) break;
         if (!node) continue;
+        // Marge large : le centre d'un rond-point hors de l'écran marque ses voisins visibles
+        if (!isVisible(node->x, node->y, node->x, node->y, 400.0f)) continue;
         std::vector<int> routes = graph.getRoutesFromNode(node->id);
         // Si un nœud a plus de 4 connexions, c'est le centre d'un rond-point
         if (routes.size() > 4) {
@@ -491,11 +494,13 @@ void Renderer::renderGraph(const Graph& graph) {
     }
     
     for (const auto& node : graph.getNodes()) {
+        if (!detailed) break;
         if (!node) continue;
         
         if (!std::isfinite(node->x) || !std::isfinite(node->y)) {
             continue;
         }
+        if (!isVisible(node->x, node->y, node->x, node->y, 60.0f)) continue;
         
         std::vector<int> routes = graph.getRoutesFromNode(node->id);
         int numConnections = routes.size();
@@ -599,19 +604,46 @@ void Renderer::renderGraph(const Graph& graph) {
     }
 }
 
-void Renderer::renderVehicles(const std::vector<std::unique_ptr<Vehicle>>& vehicles) {
-    for (const auto& vehicle : vehicles) {
-        if (!vehicle) continue;
-        
-        if (vehicle->hasReachedDestination()) {
-            continue;
+const std::vector<Vector2>& Renderer::getBlockCenters(const Graph& graph) {
+    std::shared_ptr<const RoadNetwork> topology = graph.getTopology();
+    if (topology == blockTopology) {
+        return blockCenters;
+    }
+    blockTopology = topology;
+    blockCenters.clear();
+    
+    // Îlot : cycle a-b-d-c sans diagonale, compté une fois depuis son plus petit nœud a
+    for (const auto& node : topology->getNodes()) {
+        int a = node->id;
+        std::vector<int> around = topology->getNeighbors(a);
+        for (size_t i = 0; i < around.size(); i++) {
+            for (size_t j = i + 1; j < around.size(); j++) {
+                int b = std::min(around[i], around[j]);
+                int c = std::max(around[i], around[j]);
+                if (b <= a || topology->findRouteIndex(b, c) >= 0) continue;
+                for (int d : topology->getNeighbors(b)) {
+                    if (d <= a || d == c) continue;
+                    if (topology->findRouteIndex(d, c) < 0 || topology->findRouteIndex(a, d) >= 0) continue;
+                    const Node* corners[] = {node.get(), topology->getNode(b), topology->getNode(c), topology->getNode(d)};
+                    Vector2 center = {0.0f, 0.0f};
+                    for (const Node* corner : corners) {
+                        center.x += corner->x / 4.0f;
+                        center.y += corner->y / 4.0f;
+                    }
+                    blockCenters.push_back(center);
+                }
+            }
         }
-        
+    }
+    return blockCenters;
+}
+
+void Renderer::renderVehicles(const std::vector<VehicleSnapshot>& vehicles, float alpha) {
+    for (const auto& vehicle : vehicles) {
         // Vérifier que les coordonnées sont valides
-        float x = vehicle->getX();
-        float y = vehicle->getY();
-        float angle = vehicle->getAngle();
-        int type = vehicle->getVehicleType();
+        float x, y, angle;
+        vehicle.interpolate(alpha, x, y, angle);
+        int type = vehicle.type;
         
         // Ignorer les positions invalides (NaN ou infinies)
         if (!std::isfinite(x) || !std::isfinite(y)) {
@@ -624,9 +656,9 @@ void Renderer::renderVehicles(const std::vector<std::unique_ptr<Vehicle>>& vehic
         switch (type) {
             case 0: // Voiture
                 vColor = {
-                    static_cast<unsigned char>(50 + (vehicle->getId() * 37) % 200),
-                    static_cast<unsigned char>(100 + (vehicle->getId() * 23) % 150),
-                    static_cast<unsigned char>(150 + (vehicle->getId() * 41) % 100),
+                    static_cast<unsigned char>(50 + (vehicle.id * 37) % 200),
+                    static_cast<unsigned char>(100 + (vehicle.id * 23) % 150),
+                    static_cast<unsigned char>(150 + (vehicle.id * 41) % 100),
                     255
                 };
                 size = 15.0f; // Agrandi de 7 à 15
@@ -711,7 +743,7 @@ void Renderer::renderVehicles(const std::vector<std::unique_ptr<Vehicle>>& vehic
                 
                 switch (type) {
                     case 0: // Voiture - Alterner entre bleue et rouge selon l'ID
-                        if (vehicle->getId() % 2 == 0) {
+                        if (vehicle.id % 2 == 0) {
                             cacheKey = "voiture_bleue_vers_" + direction;
                         } else {
                             cacheKey = "voiture_rouge_vers_" + direction;
@@ -799,15 +831,15 @@ void Renderer::renderVehicles(const std::vector<std::unique_ptr<Vehicle>>& vehic
     }
 }
 
-void Renderer::renderEvents(const std::vector<std::unique_ptr<Event>>& events, const Graph& graph) {
+void Renderer::renderEvents(const std::vector<EventSnapshot>& events, const Graph& graph) {
     for (const auto& event : events) {
-        if (!event || !event->isActive()) continue;
+        if (!event.active) continue;
         
-        Route* route = graph.getRoute(event->getRouteId());
+        Route* route = graph.getRoute(event.routeId);
         if (!route) continue;
         
-        Node* fromNode = graph.getNode(route->getFromNode());
-        Node* toNode = graph.getNode(route->getToNode());
+        const Node* fromNode = graph.getNode(route->getFromNode());
+        const Node* toNode = graph.getNode(route->getToNode());
         
         if (!fromNode || !toNode) continue;
         
@@ -831,7 +863,7 @@ void Renderer::renderEvents(const std::vector<std::unique_ptr<Event>>& events, c
         Color borderColor = WHITE;
         float size = 15.0f;
         
-        switch (event->getType()) {
+        switch (event.type) {
             case EventType::ACCIDENT:
                 // ACCIDENT : Affichage créatif avec texture
                 if (eventAccidentTexture.id != 0) {
@@ -974,7 +1006,7 @@ void Renderer::renderEvents(const std::vector<std::unique_ptr<Event>>& events, c
         }
         
         // Afficher la durée restante avec style amélioré
-        float remainingTime = event->getDuration() - event->getElapsedTime();
+        float remainingTime = event.duration - event.elapsedTime;
         if (remainingTime > 0) {
             std::stringstream timeStr;
             timeStr << (int)remainingTime << "s";
@@ -1014,7 +1046,7 @@ bool DrawButton(const char* text, int x, int y, int width, int height, Color col
     return clicked;
 }
 
-void Renderer::renderUI(const Simulation& simulation) {
+void Renderer::renderUI(const FrameSnapshot& frame) {
     try {
     // Interface utilisateur en mode 2D terminé
     EndMode2D();
@@ -1039,37 +1071,37 @@ void Renderer::renderUI(const Simulation& simulation) {
     float textSpacing = fontLoaded ? 1.5f : 1.0f;
     float textSize = 17.0f;
     DrawTextEx(gameFont, "Temps:", {15.0f, (float)yPos}, textSize, textSpacing, {150, 150, 150, 255});
-    ss << (int)simulation.getSimulationTime() << "s";
+    ss << (int)frame.simulationTime << "s";
     DrawTextEx(gameFont, ss.str().c_str(), {140.0f, (float)yPos}, textSize, textSpacing, WHITE);
     yPos += lineHeight;
     
     // Véhicules
     ss.str("");
     DrawTextEx(gameFont, "Vehicules:", {15.0f, (float)yPos}, textSize, textSpacing, {150, 150, 150, 255});
-    ss << simulation.getVehicles().size();
+    ss << frame.vehicleCount;
     DrawTextEx(gameFont, ss.str().c_str(), {140.0f, (float)yPos}, textSize, textSpacing, {100, 200, 255, 255});
     yPos += lineHeight;
     
     // Événements actifs
     ss.str("");
     DrawTextEx(gameFont, "Evenements:", {15.0f, (float)yPos}, textSize, textSpacing, {150, 150, 150, 255});
-    ss << simulation.getEvents().size();
-    Color eventCountColor = simulation.getEvents().size() > 0 ? ORANGE : WHITE;
+    ss << frame.events.size();
+    Color eventCountColor = frame.events.size() > 0 ? ORANGE : WHITE;
     DrawTextEx(gameFont, ss.str().c_str(), {140.0f, (float)yPos}, textSize, textSpacing, eventCountColor);
     yPos += lineHeight;
     
     // Reroutages
     ss.str("");
     DrawTextEx(gameFont, "Reroutages:", {15.0f, (float)yPos}, textSize, textSpacing, {150, 150, 150, 255});
-    ss << simulation.getTotalReroutings();
+    ss << frame.totalReroutings;
     DrawTextEx(gameFont, ss.str().c_str(), {140.0f, (float)yPos}, textSize, textSpacing, {100, 255, 100, 255});
     yPos += lineHeight;
     
     // Mode
     ss.str("");
     DrawTextEx(gameFont, "Mode:", {15.0f, (float)yPos}, textSize, textSpacing, {150, 150, 150, 255});
-    ss << (simulation.getMode() == SimulationMode::DYNAMIC ? "Dynamique" : "Normal");
-    Color modeColor = simulation.getMode() == SimulationMode::DYNAMIC ? 
+    ss << (frame.mode == SimulationMode::DYNAMIC ? "Dynamique" : "Normal");
+    Color modeColor = frame.mode == SimulationMode::DYNAMIC ? 
                       (Color){100, 255, 100, 255} : (Color){200, 200, 200, 255};
     DrawTextEx(gameFont, ss.str().c_str(), {140.0f, (float)yPos}, textSize, textSpacing, modeColor);
     yPos += lineHeight;
@@ -1077,14 +1109,19 @@ void Renderer::renderUI(const Simulation& simulation) {
     // État pause/play
     ss.str("");
     DrawTextEx(gameFont, "Etat:", {15.0f, (float)yPos}, textSize, textSpacing, {150, 150, 150, 255});
-    ss << (simulation.getIsPaused() ? "PAUSE" : "EN COURS");
-    DrawTextEx(gameFont, ss.str().c_str(), {140.0f, (float)yPos}, textSize, textSpacing, simulation.getIsPaused() ? ORANGE : GREEN);
+    ss << (frame.paused ? "PAUSE" : "EN COURS");
+    DrawTextEx(gameFont, ss.str().c_str(), {140.0f, (float)yPos}, textSize, textSpacing, frame.paused ? ORANGE : GREEN);
     yPos += lineHeight;
     
     // Vitesse de simulation
     ss.str("");
     DrawTextEx(gameFont, "Vitesse:", {15.0f, (float)yPos}, textSize, textSpacing, {150, 150, 150, 255});
-    ss << std::fixed << std::setprecision(1) << simulation.getTimeScale() << "x";
+    if (frame.fastForward) {
+        // Facteur réellement atteint (limité par le budget de temps réel par image)
+        ss << "TURBO " << std::fixed << std::setprecision(0) << frame.effectiveTimeScale << "x";
+    } else {
+        ss << std::fixed << std::setprecision(1) << frame.timeScale << "x";
+    }
     DrawTextEx(gameFont, ss.str().c_str(), {140.0f, (float)yPos}, textSize, textSpacing, YELLOW);
     
     // BOUTONS DE CONTRÔLE - En bas du panneau - Plus grands
@@ -1095,8 +1132,8 @@ void Renderer::renderUI(const Simulation& simulation) {
     
     // Bouton Play/Pause - Plus grand
     int buttonX = 15;
-    Color playPauseColor = simulation.getIsPaused() ? GREEN : ORANGE;
-    DrawButton(simulation.getIsPaused() ? "PLAY" : "PAUSE", buttonX, buttonY, buttonWidth, buttonHeight, playPauseColor, WHITE, gameFont);
+    Color playPauseColor = frame.paused ? GREEN : ORANGE;
+    DrawButton(frame.paused ? "PLAY" : "PAUSE", buttonX, buttonY, buttonWidth, buttonHeight, playPauseColor, WHITE, gameFont);
     buttonX += buttonWidth + buttonSpacing;
     
     // Bouton Vitesse - - Plus grand
@@ -1108,7 +1145,7 @@ void Renderer::renderUI(const Simulation& simulation) {
     buttonX += 35 + buttonSpacing;
     
     // Bouton Mode - Plus grand
-    Color modeButtonColor = simulation.getMode() == SimulationMode::DYNAMIC ? 
+    Color modeButtonColor = frame.mode == SimulationMode::DYNAMIC ? 
                            (Color){100, 200, 100, 255} : (Color){200, 200, 200, 255};
     DrawButton("MODE", buttonX, buttonY, 70, buttonHeight, modeButtonColor, WHITE, gameFont);
     buttonX += 70 + buttonSpacing;
@@ -1119,7 +1156,7 @@ void Renderer::renderUI(const Simulation& simulation) {
     DrawButton("MUSIC", buttonX, buttonY, 70, buttonHeight, musicButtonColor, WHITE, gameFont);
     
     // Panneau des événements actifs (à droite) - AGRANDI
-    const auto& events = simulation.getEvents();
+    const auto& events = frame.events;
     int eventPanelWidth = 350;  // Agrandi de 275 à 350
     int eventPanelX = screenWidth - eventPanelWidth - 5;
     int eventPanelY = 5;
@@ -1134,11 +1171,11 @@ void Renderer::renderUI(const Simulation& simulation) {
         int eventY = eventPanelY + 45;
         int eventIndex = 0;
         for (const auto& event : events) {
-            if (!event || !event->isActive() || eventIndex >= 4) break; // Max 4 événements affichés (augmenté)
+            if (!event.active || eventIndex >= 4) break; // Max 4 événements affichés (augmenté)
             
             Color eventTypeColor;
             std::string eventName;
-            switch (event->getType()) {
+            switch (event.type) {
                 case EventType::ACCIDENT:
                     eventTypeColor = RED;
                     eventName = "ACCIDENT";
@@ -1164,7 +1201,7 @@ void Renderer::renderUI(const Simulation& simulation) {
             DrawTextEx(gameFont, eventName.c_str(), {(float)(eventPanelX + 25), (float)(eventY + 5)}, 16.0f, 1.0f, WHITE);
             
             // Durée restante - Plus grand avec police personnalisée
-            float remaining = event->getDuration() - event->getElapsedTime();
+            float remaining = event.duration - event.elapsedTime;
             ss.str("");
             ss << (int)remaining << "s restantes";
             DrawTextEx(gameFont, ss.str().c_str(), {(float)(eventPanelX + 25), (float)(eventY + 22)}, 14.0f, 1.0f, {150, 150, 150, 255});
@@ -1225,7 +1262,70 @@ void Renderer::renderUI(const Simulation& simulation) {
     }
 }
 
-void Renderer::handleButtonClicks(Simulation& simulation) {
+void Renderer::renderProfiler() {
+    // Interface en coordonnées écran, comme renderUI
+    EndMode2D();
+    
+    // À droite du panneau SIMULATION (320 px), avant le panneau des événements
+    const int panelX = 330;
+    const int panelY = 5;
+    const int panelWidth = 340;
+    const int rowHeight = 20;
+    const int panelHeight = 42 + static_cast<int>(FrameProfiler::PHASE_COUNT) * rowHeight + 76;
+    DrawRectangle(panelX, panelY, panelWidth, panelHeight, {20, 20, 20, 220});
+    DrawRectangleLines(panelX, panelY, panelWidth, panelHeight, {100, 100, 100, 255});
+    DrawTextEx(gameFont, "PROFIL (ms / image)", {(float)(panelX + 10), (float)(panelY + 12)}, 20.0f, 1.5f, {200, 200, 200, 255});
+    DrawLineEx({(float)(panelX + 10), (float)(panelY + 32)}, {(float)(panelX + panelWidth - 10), (float)(panelY + 32)}, 1.5f, {100, 100, 100, 255});
+    
+    // Une ligne par phase : moyenne / maximum sur l'historique, puis une barre par image
+    // (hauteur pleine = une image à 60 images/s ; la plus récente à droite)
+    const float frameBudget = 1000.0f / 60.0f;
+    const int graphWidth = static_cast<int>(FrameProfiler::HISTORY);
+    const int graphHeight = 14;
+    const int graphX = panelX + panelWidth - graphWidth - 10;
+    std::stringstream ss;
+    ss << std::fixed << std::setprecision(2);
+    int rowY = panelY + 42;
+    for (size_t i = 0; i < FrameProfiler::PHASE_COUNT; i++) {
+        ProfilePhase phase = static_cast<ProfilePhase>(i);
+        DrawTextEx(gameFont, FrameProfiler::getPhaseName(phase), {(float)(panelX + 10), (float)rowY}, 14.0f, 1.0f, {150, 150, 150, 255});
+        ss.str("");
+        ss << profiler.getAverage(phase) << " / " << profiler.getMax(phase);
+        DrawTextEx(gameFont, ss.str().c_str(), {(float)(panelX + 120), (float)rowY}, 14.0f, 1.0f, WHITE);
+        
+        int baseY = rowY + graphHeight;
+        DrawRectangle(graphX, rowY, graphWidth, graphHeight, {40, 40, 40, 255});
+        for (size_t age = 0; age < profiler.getFrameCount(); age++) {
+            float share = profiler.getFrame(age).phaseTime[i] / frameBudget;
+            int height = static_cast<int>(std::min(1.0f, share) * graphHeight + 0.5f);
+            if (height > 0) {
+                Color color = share < 0.25f ? (Color){100, 255, 100, 255} :
+                              share < 0.5f ? (Color){255, 200, 0, 255} : (Color){255, 50, 50, 255};
+                int x = graphX + graphWidth - 1 - static_cast<int>(age);
+                DrawLine(x, baseY - height, x, baseY, color);
+            }
+        }
+        rowY += rowHeight;
+    }
+    
+    // Compteurs moyens par image
+    DrawLineEx({(float)(panelX + 10), (float)(rowY + 2)}, {(float)(panelX + panelWidth - 10), (float)(rowY + 2)}, 1.0f, {100, 100, 100, 255});
+    rowY += 10;
+    ss << std::setprecision(1);
+    const char* labels[] = {"Recherches / image", "Reroutages / image", "Allocations / image"};
+    float values[] = {profiler.getAverageSearches(), profiler.getAverageReroutes(), profiler.getAverageAllocations()};
+    for (int i = 0; i < 3; i++) {
+        DrawTextEx(gameFont, labels[i], {(float)(panelX + 10), (float)rowY}, 14.0f, 1.0f, {150, 150, 150, 255});
+        ss.str("");
+        ss << values[i];
+        DrawTextEx(gameFont, ss.str().c_str(), {(float)(panelX + 180), (float)rowY}, 14.0f, 1.0f, {100, 200, 255, 255});
+        rowY += rowHeight;
+    }
+    
+    BeginMode2D(camera);
+}
+
+void Renderer::handleButtonClicks(SimulationRunner& runner, const FrameSnapshot& frame) {
     if (!IsMouseButtonPressed(MOUSE_LEFT_BUTTON)) {
         return;
     }
@@ -1240,7 +1340,7 @@ void Renderer::handleButtonClicks(Simulation& simulation) {
     // Bouton Play/Pause (15, 210, 75, 28)
     if (mousePos.x >= 15 && mousePos.x <= 15 + buttonWidth && 
         mousePos.y >= buttonY && mousePos.y <= buttonY + buttonHeight) {
-        simulation.togglePause();
+        runner.post(SimulationCommand::make(CommandType::TOGGLE_PAUSE));
         std::cout << "Bouton Play/Pause clique!" << std::endl;
         return;
     }
@@ -1248,8 +1348,8 @@ void Renderer::handleButtonClicks(Simulation& simulation) {
     // Bouton Vitesse - (95, 210, 35, 28)
     if (mousePos.x >= 95 && mousePos.x <= 95 + 35 && 
         mousePos.y >= buttonY && mousePos.y <= buttonY + buttonHeight) {
-        float newScale = simulation.getTimeScale() - 0.5f;
-        simulation.setTimeScale(newScale);
+        float newScale = frame.timeScale - 0.5f;
+        runner.post(SimulationCommand::make(CommandType::SET_TIME_SCALE, 0, newScale));
         std::cout << "Vitesse reduite a " << newScale << "x" << std::endl;
         return;
     }
@@ -1257,8 +1357,8 @@ void Renderer::handleButtonClicks(Simulation& simulation) {
     // Bouton Vitesse + (135, 210, 35, 28)
     if (mousePos.x >= 135 && mousePos.x <= 135 + 35 && 
         mousePos.y >= buttonY && mousePos.y <= buttonY + buttonHeight) {
-        float newScale = simulation.getTimeScale() + 0.5f;
-        simulation.setTimeScale(newScale);
+        float newScale = frame.timeScale + 0.5f;
+        runner.post(SimulationCommand::make(CommandType::SET_TIME_SCALE, 0, newScale));
         std::cout << "Vitesse augmentee a " << newScale << "x" << std::endl;
         return;
     }
@@ -1266,10 +1366,10 @@ void Renderer::handleButtonClicks(Simulation& simulation) {
     // Bouton Mode (175, 210, 70, 28) - Coordonnées corrigées
     if (mousePos.x >= 175 && mousePos.x <= 175 + 70 && 
         mousePos.y >= buttonY && mousePos.y <= buttonY + buttonHeight) {
-        SimulationMode currentMode = simulation.getMode();
+        SimulationMode currentMode = frame.mode;
         SimulationMode newMode = (currentMode == SimulationMode::DYNAMIC) ? 
                                 SimulationMode::NORMAL : SimulationMode::DYNAMIC;
-        simulation.setMode(newMode);
+        runner.post(SimulationCommand::make(CommandType::SET_MODE, static_cast<int>(newMode)));
         std::cout << "Mode change: " << (newMode == SimulationMode::DYNAMIC ? "Dynamique" : "Normal") << std::endl;
         return;
     }
@@ -1287,8 +1387,9 @@ void Renderer::updateCamera() {
     // Zoom avec la molette
     float wheel = GetMouseWheelMove();
     if (wheel != 0) {
-        camera.zoom += wheel * 0.1f;
-        camera.zoom = std::max(0.1f, std::min(3.0f, camera.zoom));
+        // Pas proportionnel au zoom : utilisable de la ville entière (grands réseaux) au carrefour
+        camera.zoom *= 1.0f + wheel * 0.1f;
+        camera.zoom = std::max(MIN_ZOOM, std::min(3.0f, camera.zoom));
     }
     
     // Déplacement avec les flèches ou WASD
@@ -1355,8 +1456,8 @@ void Renderer::fitGraphToWindow(const Graph& graph) {
     float zoomY = availableHeight / graphHeight;
     float zoom = std::min(zoomX, zoomY);
     
-    // Limiter le zoom pour éviter qu'il soit trop petit ou trop grand
-    zoom = std::max(0.5f, std::min(3.0f, zoom));
+    // Limiter le zoom pour éviter qu'il soit trop grand (un grand réseau peut être vu en entier)
+    zoom = std::max(MIN_ZOOM, std::min(3.0f, zoom));
     
     // Appliquer le zoom et centrer
     camera.zoom = zoom;
@@ -1385,6 +1486,16 @@ Vector2 Renderer::screenToWorld(int x, int y) const {
     return result;
 }
 
+void Renderer::getVisibleArea(float& minX, float& minY, float& maxX, float& maxY) const {
+    // Rectangle du monde couvert par la fenêtre (sans rotation de caméra)
+    Vector2 topLeft = screenToWorld(0, 0);
+    Vector2 bottomRight = screenToWorld(screenWidth, screenHeight);
+    minX = topLeft.x;
+    minY = topLeft.y;
+    maxX = bottomRight.x;
+    maxY = bottomRight.y;
+}
+
 void Renderer::addNotification(const std::string& text, Color color, float duration) {
     Notification notif;
     notif.text = text;
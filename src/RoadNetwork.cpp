@@ -0,0 +1,133 @@
+#include "RoadNetwork.h"
+#include "BinaryIO.h"
+#include <cstring>
+#include <initializer_list>
+
+namespace {
+uint32_t floatBits(float value) {
+    uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    return bits;
+}
+
+// Ajoute des mots de 32 bits (octet de poids faible d'abord) à une empreinte FNV-1a
+void mixWords(uint64_t& hash, std::initializer_list<uint32_t> words) {
+    for (uint32_t word : words) {
+        unsigned char bytes[4] = {static_cast<unsigned char>(word), static_cast<unsigned char>(word >> 8),
+                                  static_cast<unsigned char>(word >> 16), static_cast<unsigned char>(word >> 24)};
+        hash = fnv1a64(bytes, sizeof(bytes), hash);
+    }
+}
+}
+
+RoadNetwork::RoadNetwork(const RoadNetwork& other)
+    : routes(other.routes), adjacencyList(other.adjacencyList),
+      routeIndexById(other.routeIndexById), nodeIndexById(other.nodeIndexById),
+      denseRouteIds(other.denseRouteIds), denseNodeIds(other.denseNodeIds),
+      nodeHash(other.nodeHash), routeHash(other.routeHash) {
+    nodes.reserve(other.nodes.size());
+    for (const auto& node : other.nodes) {
+        nodes.push_back(std::make_unique<Node>(*node));
+    }
+}
+
+void RoadNetwork::reserve(size_t nodeCount, size_t routeCount) {
+    nodes.reserve(nodeCount);
+    adjacencyList.reserve(nodeCount);
+    if (!denseNodeIds) {
+        nodeIndexById.reserve(nodeCount);
+    }
+    if (!denseRouteIds) {
+        routeIndexById.reserve(routeCount);
+    }
+}
+
+void RoadNetwork::addNode(int id, float x, float y) {
+    int index = static_cast<int>(nodes.size());
+    nodes.push_back(std::make_unique<Node>(id, x, y));
+    mixWords(nodeHash, {static_cast<uint32_t>(id), floatBits(x), floatBits(y)});
+    if (denseNodeIds && id != index) {
+        // Premier identifiant hors séquence : l'index devient nécessaire
+        denseNodeIds = false;
+        for (int i = 0; i < index; i++) {
+            nodeIndexById.emplace(i, i);
+        }
+    }
+    if (!denseNodeIds) {
+        nodeIndexById.emplace(id, index);
+    }
+}
+
+void RoadNetwork::addRoute(int id, int fromNode, int toNode, float length, float speed, int capacity) {
+    routes.push_back(RouteAttributes{id, fromNode, toNode, length, speed, capacity});
+    mixWords(routeHash, {static_cast<uint32_t>(id), static_cast<uint32_t>(fromNode), static_cast<uint32_t>(toNode),
+                         floatBits(length), floatBits(speed), static_cast<uint32_t>(capacity)});
+    int index = static_cast<int>(routes.size()) - 1;
+    if (denseRouteIds && id != index) {
+        denseRouteIds = false;
+        for (int i = 0; i < index; i++) {
+            routeIndexById.emplace(i, i);
+        }
+    }
+    if (!denseRouteIds) {
+        routeIndexById.emplace(id, index);
+    }
+
+    // Mise à jour de la liste d'adjacence (bidirectionnelle) ; place pour un carrefour à 4 branches
+    // dès la première route : une seule allocation par nœud sur les grands réseaux
+    for (int node : {fromNode, toNode}) {
+        std::vector<int>& incident = adjacencyList[node];
+        if (incident.empty()) {
+            incident.reserve(4);
+        }
+        incident.push_back(index);
+    }
+}
+
+const Node* RoadNetwork::getNode(int id) const {
+    if (denseNodeIds) {
+        return id >= 0 && id < static_cast<int>(nodes.size()) ? nodes[id].get() : nullptr;
+    }
+    auto it = nodeIndexById.find(id);
+    return it != nodeIndexById.end() ? nodes[it->second].get() : nullptr;
+}
+
+int RoadNetwork::getRouteIndex(int routeId) const {
+    if (denseRouteIds) {
+        return routeId >= 0 && routeId < static_cast<int>(routes.size()) ? routeId : -1;
+    }
+    auto it = routeIndexById.find(routeId);
+    return it != routeIndexById.end() ? it->second : -1;
+}
+
+int RoadNetwork::findRouteIndex(int fromNode, int toNode) const {
+    for (int routeIdx : getRoutesFromNode(fromNode)) {
+        const RouteAttributes& route = routes[routeIdx];
+        if ((route.fromNode == fromNode && route.toNode == toNode) ||
+            (route.fromNode == toNode && route.toNode == fromNode)) {
+            return routeIdx;
+        }
+    }
+    return -1;
+}
+
+std::vector<int> RoadNetwork::getNeighbors(int nodeId) const {
+    std::vector<int> neighbors;
+    for (int routeIdx : getRoutesFromNode(nodeId)) {
+        const RouteAttributes& route = routes[routeIdx];
+        neighbors.push_back(route.toNode != nodeId ? route.toNode : route.fromNode);
+    }
+    return neighbors;
+}
+
+const std::vector<int>& RoadNetwork::getRoutesFromNode(int nodeId) const {
+    static const std::vector<int> none;
+    auto it = adjacencyList.find(nodeId);
+    return it != adjacencyList.end() ? it->second : none;
+}
+
+uint64_t RoadNetwork::getFingerprint() const {
+    uint64_t hash = nodeHash;
+    mixWords(hash, {static_cast<uint32_t>(routeHash), static_cast<uint32_t>(routeHash >> 32)});
+    return hash;
+}
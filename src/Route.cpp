@@ -2,9 +2,16 @@
 #include <algorithm>
 
 Route::Route(int id, int from, int to, float len, float speed, int cap)
-    : id(id), fromNode(from), toNode(to), length(len), 
-      baseSpeed(speed), currentSpeed(speed), vehicleCount(0), 
-      capacity(cap), state(RouteState::NORMAL) {
+    : attributes(nullptr), ownAttributes(std::make_unique<RouteAttributes>(RouteAttributes{id, from, to, len, speed, cap})),
+      currentSpeed(speed), vehicleCount(0), inducedLoad(0), state(RouteState::NORMAL),
+      version(0), changeLog(nullptr), changeLogIndex(-1), changePending(false) {
+    attributes = ownAttributes.get();
+}
+
+Route::Route(const RouteAttributes& attributes)
+    : attributes(&attributes), currentSpeed(attributes.baseSpeed), vehicleCount(0), inducedLoad(0),
+      state(RouteState::NORMAL),
+      version(0), changeLog(nullptr), changeLogIndex(-1), changePending(false) {
 }
 
 float Route::getTravelTime() const {
@@ -17,14 +24,14 @@ float Route::getTravelTime() const {
     }
     
     // Temps de parcours de base (en secondes)
-    float baseTravelTime = (length / currentSpeed) * 3600.0f;
+    float baseTravelTime = (attributes->length / currentSpeed) * 3600.0f;
     
     // Load balancing: pénalité basée sur la congestion pour éviter que tous prennent la même route
     // Utilise la vitesse actuelle comme indicateur de congestion (vitesse réduite = congestion)
     float loadPenalty = 0.0f;
-    if (baseSpeed > 0 && currentSpeed < baseSpeed) {
+    if (attributes->baseSpeed > 0 && currentSpeed < attributes->baseSpeed) {
         // Plus la vitesse est réduite, plus la route est congestionnée
-        float congestionLevel = 1.0f - (currentSpeed / baseSpeed);
+        float congestionLevel = 1.0f - (currentSpeed / attributes->baseSpeed);
         // Pénalité progressive: congestion légère (+10%), moyenne (+50%), forte (+150%)
         loadPenalty = baseTravelTime * congestionLevel * congestionLevel * 1.5f;
     }
@@ -49,19 +56,23 @@ void Route::removeVehicle() {
     }
 }
 
+void Route::applyVehicleDelta(int delta) {
+    vehicleCount = std::max(0, vehicleCount + delta);
+}
+
 void Route::updateSpeed() {
     if (state == RouteState::BLOCKED || state == RouteState::ACCIDENT) {
         currentSpeed = 0;
         return;
     }
     
-    // Calcul de la vitesse basée sur la congestion
-    float congestionRatio = static_cast<float>(vehicleCount) / static_cast<float>(capacity);
+    // Calcul de la vitesse basée sur la congestion (véhicules réels + charge des événements)
+    float congestionRatio = static_cast<float>(vehicleCount + inducedLoad) / static_cast<float>(attributes->capacity);
     congestionRatio = std::min(congestionRatio, 1.0f);
     
     // Réduction de vitesse proportionnelle à la congestion
     // À 100% de capacité, la vitesse est réduite à 20% de la vitesse de base
-    currentSpeed = baseSpeed * (1.0f - 0.8f * congestionRatio);
+    currentSpeed = attributes->baseSpeed * (1.0f - 0.8f * congestionRatio);
     
     if (state == RouteState::CONGESTED) {
         currentSpeed *= 0.5f; // Réduction supplémentaire pour congestion
@@ -71,19 +82,50 @@ void Route::updateSpeed() {
 }
 
 void Route::setState(RouteState newState) {
+    bool changed = (newState != state);
     state = newState;
     updateSpeed();
+    if (changed) {
+        notifyChange();
+    }
 }
 
 void Route::setCongestion(float congestionLevel) {
     congestionLevel = std::clamp(congestionLevel, 0.0f, 1.0f);
-    vehicleCount = static_cast<int>(capacity * congestionLevel);
+    int previousLoad = inducedLoad;
+    RouteState previousState = state;
+    inducedLoad = static_cast<int>(attributes->capacity * congestionLevel);
     if (congestionLevel > 0.7f) {
         state = RouteState::CONGESTED;
     } else if (state == RouteState::CONGESTED) {
         state = RouteState::NORMAL;
     }
     updateSpeed();
+    // Les événements réappliquent leurs effets à chaque frame : ne notifier que les vrais changements
+    if (inducedLoad != previousLoad || state != previousState) {
+        notifyChange();
+    }
+}
+
+void Route::restoreState(RouteState savedState, int savedVehicleCount, int savedInducedLoad, float savedSpeed) {
+    state = savedState;
+    vehicleCount = std::max(0, savedVehicleCount);
+    inducedLoad = std::max(0, savedInducedLoad);
+    currentSpeed = savedSpeed;
+}
+
+void Route::attachChangeLog(std::vector<int>* log, int index) {
+    changeLog = log;
+    changeLogIndex = index;
+    changePending = false;
+}
+
+void Route::notifyChange() {
+    version++;
+    if (changeLog && !changePending) {
+        changePending = true;
+        changeLog->push_back(changeLogIndex);
+    }
 }
 
 bool Route::isUsable() const {
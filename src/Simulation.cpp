@@ -3,99 +3,191 @@
 #include "Vehicle.h"
 #include "PathPlanner.h"
 #include "Event.h"
+#include "TaskScheduler.h"
+#include "FrameSnapshot.h"
+#include "Tracing.h"
+#include "CityGenerator.h"
+#include "ConfigLoader.h"
 #include <random>
 #include <algorithm>
+#include <cstdio>
+#include <cstring>
 #include <iostream>
+#include <fstream>
+#include <sstream>
+#include <chrono>
 
-Simulation::Simulation()
-    : mode(SimulationMode::DYNAMIC), simulationTime(0.0f), timeScale(1.0f),
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#define SIMULATION_HAS_FORK 1
+#endif
+
+namespace {
+// En-tête d'un point de reprise : signature, version, taille et somme de contrôle du contenu
+const char CHECKPOINT_MAGIC[4] = {'T', 'S', 'C', 'K'};
+const size_t CHECKPOINT_HEADER_SIZE = 4 + 4 + 8 + 8;
+
+uint64_t elapsedNanoseconds(std::chrono::steady_clock::time_point start) {
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - start).count());
+}
+
+#ifdef SIMULATION_HAS_FORK
+// Écriture du processus fils : appels système seuls (ni allocation, ni flux, ni verrou)
+bool writeFileDirect(const char* temporary, const char* path, const unsigned char* data, size_t size) {
+    int fd = ::open(temporary, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0) {
+        return false;
+    }
+    while (size > 0) {
+        ssize_t written = ::write(fd, data, size);
+        if (written <= 0) {
+            ::close(fd);
+            ::unlink(temporary);
+            return false;
+        }
+        data += written;
+        size -= static_cast<size_t>(written);
+    }
+    if (::close(fd) != 0 || ::rename(temporary, path) != 0) {
+        ::unlink(temporary);
+        return false;
+    }
+    return true;
+}
+#endif
+}
+
+Simulation::Simulation(unsigned int threadCount)
+    : regionCount(0), trafficModel(TrafficModel::CONTINUOUS), hasFocusArea(false), focusArea{0.0f, 0.0f, 0.0f, 0.0f}, positionsStale(false), mode(SimulationMode::DYNAMIC), simulationTime(0.0f), timeScale(1.0f),
       isPaused(false),  // Initialiser isPaused à false
-      vehicleCount(50), eventCount(2), reroutingEnabled(true),  // Plus de véhicules pour ville dynamique
+      fastForward(false), fixedTimeStep(FIXED_TIME_STEP), pendingTime(0.0f), frameBudget(0.012f),
+      effectiveTimeScale(1.0f), measuredRealTime(0.0f), measuredSimulatedTime(0.0f),
+      vehicleCount(50), eventCount(2), reroutingEnabled(true), verbose(true),  // Plus de véhicules pour ville dynamique
       rng(std::random_device{}()), nextEventTime(10.0f), eventInterval(20.0f),  // Événements plus fréquents
-      totalReroutings(0), averageTravelTime(0.0f) {
+      eventTypes{EventType::ACCIDENT, EventType::TRAFFIC_JAM, EventType::ROAD_CLOSURE, EventType::EMERGENCY},
+      totalReroutings(0), averageTravelTime(0.0f), nextVehicleId(0), tickDelta(0.0f),
+      checkpointProcess(0), checkpointSaved(true), nextObserverId(0) {
     
     graph = std::make_unique<Graph>();
     pathPlanner = std::make_unique<PathPlanner>(graph.get());
+    scheduler = std::make_unique<TaskScheduler>(threadCount);
+    statistics.setSlotCount(scheduler->getThreadCount());
 }
 
 Simulation::~Simulation() {
+    // Pas de processus fils orphelin
+    waitForCheckpoint();
 }
 
 void Simulation::initialize(const std::string& configPath) {
-    // Création d'un graphe de test si pas de config
     if (configPath.empty()) {
-        createTestGraph();
+        initialize(loadTopology(configPath));
+        return;
+    }
+    // Réseau et paramètres lus en une passe ; les paramètres précèdent la création des véhicules
+    std::cout << "Chargement de la configuration depuis: " << configPath << std::endl;
+    auto topology = std::make_shared<RoadNetwork>();
+    SimulationConfig settings;
+    std::string error;
+    if (ConfigLoader::load(configPath, *topology, settings, error)) {
+        applyConfig(settings);
     } else {
-        graph->loadFromConfig(configPath);
+        std::cout << "ERREUR: configuration " << configPath << ": " << error << std::endl;
+        topology = std::make_shared<RoadNetwork>();
     }
-    
-    // Création des véhicules
-    createVehicles();
+    initialize(std::move(topology));
 }
 
-void Simulation::createTestGraph() {
-    // Création d'un réseau routier organisé avec structure claire
-    // Structure : Grille principale avec quelques rond-points bien organisés au centre
-    float spacing = 130.0f; // Espacement entre nœuds
-    int nodeId = 0;
-    int routeId = 0;
-    
-    // Créer une grille principale 6x6 pour structure claire et organisée
-    int gridSize = 6;
-    std::vector<std::vector<int>> nodeGrid(gridSize, std::vector<int>(gridSize, -1));
-    
-    // 1. Créer les nœuds en grille régulière
-    for (int i = 0; i < gridSize; i++) {
-        for (int j = 0; j < gridSize; j++) {
-            nodeGrid[i][j] = nodeId;
-            graph->addNode(nodeId++, j * spacing, i * spacing);
-        }
+void Simulation::applyConfig(const SimulationConfig& settings) {
+    if (settings.vehicleCount >= 0) {
+        vehicleCount = settings.vehicleCount;
+    }
+    if (settings.eventCount >= 0) {
+        setEventCount(settings.eventCount);
+    }
+    if (settings.timeScale > 0.0f) {
+        setTimeScale(settings.timeScale);
+    }
+    if (settings.mode == "NORMAL" || settings.mode == "DYNAMIC") {
+        setMode(settings.mode == "NORMAL" ? SimulationMode::NORMAL : SimulationMode::DYNAMIC);
+    } else if (!settings.mode.empty()) {
+        std::cout << "ATTENTION: mode inconnu ignore: " << settings.mode << std::endl;
+    }
+    if (settings.eventInterval > 0.0f) {
+        setEventInterval(settings.eventInterval);
     }
     
-    // 2. Créer les routes principales horizontales (toutes les routes)
-    for (int i = 0; i < gridSize; i++) {
-        for (int j = 0; j < gridSize - 1; j++) {
-            int from = nodeGrid[i][j];
-            int to = nodeGrid[i][j + 1];
-            graph->addRoute(routeId++, from, to, spacing, 60.0f, 30);
+    const char* typeNames[] = {"ACCIDENT", "TRAFFIC_JAM", "ROAD_CLOSURE", "EMERGENCY"};
+    std::vector<EventType> types;
+    for (const std::string& name : settings.eventTypes) {
+        auto known = std::find(std::begin(typeNames), std::end(typeNames), name);
+        if (known == std::end(typeNames)) {
+            std::cout << "ATTENTION: type d'evenement inconnu ignore: " << name << std::endl;
+            continue;
         }
+        types.push_back(static_cast<EventType>(known - std::begin(typeNames)));
     }
+    setEventTypes(types);
+}
+
+void Simulation::setEventTypes(const std::vector<EventType>& types) {
+    if (!types.empty()) {
+        eventTypes = types;
+    }
+}
+
+std::shared_ptr<const RoadNetwork> Simulation::loadTopology(const std::string& configPath) {
+    // Réseau de démonstration (grille 6x6) si pas de config
+    if (configPath.empty()) {
+        return CityGenerator::generate(CityOptions());
+    }
+    Graph builder;
+    builder.loadFromConfig(configPath);
+    return builder.getTopology();
+}
+
+void Simulation::initialize(std::shared_ptr<const RoadNetwork> topology) {
+    // Les véhicules libèrent les routes de l'ancienne topologie avant le remplacement
+    clearVehicles();
+    graph->setTopology(std::move(topology));
+    statistics.reset(simulationTime);
     
-    // 3. Créer les routes principales verticales (toutes les routes)
-    for (int i = 0; i < gridSize - 1; i++) {
-        for (int j = 0; j < gridSize; j++) {
-            int from = nodeGrid[i][j];
-            int to = nodeGrid[i + 1][j];
-            graph->addRoute(routeId++, from, to, spacing, 60.0f, 30);
-        }
+    // Le découpage dépend du graphe : le reconstruire avant de créer les véhicules
+    if (regionCount > 1) {
+        rebuildPartition();
     }
+    
+    // Création des véhicules
+    createVehicles();
 }
 
 void Simulation::createVehicles() {
-    vehicles.clear();
+    clearVehicles();
     
     const auto& nodes = graph->getNodes();
-    std::cout << "Nombre de noeuds dans le graphe: " << nodes.size() << std::endl;
+    if (verbose) {
+        std::cout << "Nombre de noeuds dans le graphe: " << nodes.size() << std::endl;
+    }
     if (nodes.size() < 2) {
         std::cout << "ERREUR: Pas assez de noeuds pour creer des vehicules!" << std::endl;
         return;
     }
     
     // Trouver les nœuds qui ont des connexions (routes)
-    std::vector<int> connectedNodes;
-    for (const auto& node : nodes) {
-        std::vector<int> routes = graph->getRoutesFromNode(node->id);
-        if (!routes.empty()) {
-            connectedNodes.push_back(node->id);
-        }
-    }
+    refreshConnectedNodes();
     
     if (connectedNodes.empty()) {
         std::cout << "ERREUR: Aucun noeud connecte dans le graphe!" << std::endl;
         return;
     }
     
-    std::cout << "Noeuds connectes: " << connectedNodes.size() << " sur " << nodes.size() << std::endl;
+    if (verbose) {
+        std::cout << "Noeuds connectes: " << connectedNodes.size() << " sur " << nodes.size() << std::endl;
+    }
     
     std::uniform_int_distribution<int> nodeDist(0, connectedNodes.size() - 1);
     int vehiclesCreated = 0;
@@ -132,188 +224,719 @@ void Simulation::createVehicles() {
         }
         
         if (!path.empty() && path.size() >= 2) {
-            auto vehicle = std::make_unique<Vehicle>(vehiclesCreated, start, end);
-            vehicle->setPath(path);
+            auto vehicle = std::make_unique<Vehicle>(nextVehicleId++, start, end);
+            assignPath(vehicle.get(), path);
+            depart(vehicle.get());
             // Initialiser la position au nœud de départ
-            Node* startNode = graph->getNode(start);
+            const Node* startNode = graph->getNode(start);
             if (startNode) {
                 vehicle->calculatePosition(*graph);
             }
             vehicles.push_back(std::move(vehicle));
             vehiclesCreated++;
-        } else {
+        } else if (verbose) {
             std::cout << "ATTENTION: Pas de chemin trouve pour vehicule " << i 
                       << " (de " << start << " a " << end << ")" << std::endl;
         }
     }
     
-    std::cout << "Vehicules crees avec succes: " << vehiclesCreated << " sur " << vehicleCount << " demandes" << std::endl;
+    if (verbose) {
+        std::cout << "Vehicules crees avec succes: " << vehiclesCreated << " sur " << vehicleCount << " demandes" << std::endl;
+    }
 }
 
 void Simulation::setMode(SimulationMode mode) {
     this->mode = mode;
     reroutingEnabled = (mode == SimulationMode::DYNAMIC);
+    // Candidats tenus seulement avec le reroutage : les véhicules déjà signalés y reviennent
+    rerouteCandidates.clear();
+    if (reroutingEnabled && dynamics) {
+        for (const auto& vehicle : vehicles) {
+            if (vehicle->needsReroutingCheck()) {
+                rerouteCandidates.push_back(vehicle.get());
+            }
+        }
+    }
 }
 
 void Simulation::setVehicleCount(int count) {
     vehicleCount = count;
-    createVehicles();
+    // Avant initialize, le graphe est vide : les véhicules seront créés avec le réseau
+    if (!graph->getNodes().empty()) {
+        createVehicles();
+    }
 }
 
 void Simulation::setEventCount(int count) {
     eventCount = count;
 }
 
+void Simulation::setPathfindingStrategy(std::unique_ptr<PathfindingStrategy> strategy) {
+    pathPlanner->setStrategy(std::move(strategy));
+}
+
 void Simulation::update(float deltaTime) {
+    TRACE_ZONE("Simulation::update");
+    auto updateStart = std::chrono::steady_clock::now();
     // Toujours mettre à jour le temps et les événements (même en pause pour l'affichage)
     // Mais ne pas faire avancer la simulation si en pause
     if (!isPaused) {
-        simulationTime += deltaTime * timeScale;
+        simulationTime += deltaTime;
+    }
+    
+    // Les phases du tick forment un graphe de dépendances exécuté par l'ordonnanceur
+    tickDelta = deltaTime;
+    if (tickGraph.size() == 0) {
+        buildTickGraph();
     }
+    scheduler->run(tickGraph);
+    profile.ticks++;
+    profile.updateTime += elapsedNanoseconds(updateStart);
     
-    // Mise à jour des événements (seulement si pas en pause)
     if (!isPaused) {
-        for (auto& event : events) {
-            if (!event) continue;
+        for (const auto& observer : tickObservers) {
+            observer.second(*this);
+        }
+    }
+}
+
+SimulationProfile Simulation::getProfile() const {
+    SimulationProfile result = profile;
+    SearchStats searches = pathPlanner->getSearchStats();
+    result.pathfindingTime = searches.time;
+    result.searches = searches.searches;
+    return result;
+}
+
+int Simulation::addTickObserver(std::function<void(const Simulation&)> observer) {
+    tickObservers.emplace_back(nextObserverId, std::move(observer));
+    return nextObserverId++;
+}
+
+void Simulation::removeTickObserver(int observerId) {
+    tickObservers.erase(
+        std::remove_if(tickObservers.begin(), tickObservers.end(),
+            [observerId](const auto& observer) { return observer.first == observerId; }),
+        tickObservers.end()
+    );
+}
+
+int Simulation::advance(float realDeltaTime) {
+    if (isPaused) {
+        pendingTime = 0.0f;
+        effectiveTimeScale = 0.0f;
+        measuredRealTime = 0.0f;
+        measuredSimulatedTime = 0.0f;
+        update(realDeltaTime);
+        return 0;
+    }
+    
+    // Pas fixes jusqu'à couvrir le temps demandé ou épuiser le budget de l'image
+    float scale = fastForward ? MAX_TIME_SCALE : timeScale;
+    auto start = std::chrono::steady_clock::now();
+    pendingTime += realDeltaTime * scale;
+    int wanted = static_cast<int>(pendingTime / fixedTimeStep + 1e-3f);
+    int steps = 0;
+    while (steps < wanted) {
+        update(fixedTimeStep);
+        steps++;
+        std::chrono::duration<float> elapsed = std::chrono::steady_clock::now() - start;
+        if (elapsed.count() >= frameBudget) {
+            break;
+        }
+    }
+    // Reste inférieur à un pas reporté ; retard au-delà du budget abandonné (pas d'emballement)
+    pendingTime = std::max(0.0f, pendingTime - wanted * fixedTimeStep);
+    
+    // Facteur atteint mesuré sur au moins un quart de seconde (un appel ne fait souvent aucun tick)
+    measuredRealTime += realDeltaTime;
+    measuredSimulatedTime += steps * fixedTimeStep;
+    if (measuredRealTime >= 0.25f) {
+        effectiveTimeScale = measuredSimulatedTime / measuredRealTime;
+        measuredRealTime = 0.0f;
+        measuredSimulatedTime = 0.0f;
+    }
+    return steps;
+}
+
+void Simulation::buildTickGraph() {
+    // events -> routeChanges -> vehicles -> traffic -> arrivals -> spawnPlan ----> spawnCommit
+    //                                                           \-> statistics -/
+    // Les statistiques lisent les véhicules pendant que les nouveaux trajets sont planifiés ;
+    // les nouveaux véhicules ne sont ajoutés qu'une fois les deux terminés.
+    int eventsTask = tickGraph.addTask("events", [this] {
+        TRACE_ZONE("tick.events");
+        // Mise à jour des événements (seulement si pas en pause)
+        if (!isPaused) {
+            updateEvents(tickDelta);
+        }
+    });
+    int changesTask = tickGraph.addTask("routeChanges", [this] {
+        TRACE_ZONE("tick.routeChanges");
+        // Changements d'état des routes (événements) -> véhicules concernés uniquement
+        processRouteChanges();
+    });
+    int vehiclesTask = tickGraph.addTask("vehicles", [this] {
+        TRACE_ZONE("tick.vehicles");
+        auto start = std::chrono::steady_clock::now();
+        // Mise à jour des véhicules (TOUJOURS, même en pause pour le rendu)
+        updateVehicles(tickDelta);
+        profile.trafficTime += elapsedNanoseconds(start);
+    });
+    int trafficTask = tickGraph.addTask("traffic", [this] {
+        TRACE_ZONE("tick.traffic");
+        auto start = std::chrono::steady_clock::now();
+        // Mise à jour du trafic (seulement si pas en pause)
+        if (!isPaused) {
+            graph->updateTraffic();
+        }
+        profile.trafficTime += elapsedNanoseconds(start);
+    });
+    int arrivalsTask = tickGraph.addTask("arrivals", [this] {
+        TRACE_ZONE("tick.arrivals");
+        // Supprimer les véhicules arrivés (seulement si pas en pause)
+        if (!isPaused) {
+            removeArrivedVehicles();
+        }
+    });
+    int spawnPlanTask = tickGraph.addTask("spawnPlan", [this] {
+        TRACE_ZONE("tick.spawnPlan");
+        auto start = std::chrono::steady_clock::now();
+        if (!isPaused) {
+            planSpawns();
+        }
+        profile.spawnTime += elapsedNanoseconds(start);
+    });
+    int statisticsTask = tickGraph.addTask("statistics", [this] {
+        TRACE_ZONE("tick.statistics");
+        // Mise à jour des statistiques
+        updateStatistics();
+    });
+    int spawnCommitTask = tickGraph.addTask("spawnCommit", [this] {
+        TRACE_ZONE("tick.spawnCommit");
+        auto start = std::chrono::steady_clock::now();
+        if (!isPaused) {
+            commitSpawns();
+        }
+        profile.spawnTime += elapsedNanoseconds(start);
+    });
+    
+    tickGraph.precede(eventsTask, changesTask);
+    tickGraph.precede(changesTask, vehiclesTask);
+    tickGraph.precede(vehiclesTask, trafficTask);
+    tickGraph.precede(trafficTask, arrivalsTask);
+    tickGraph.precede(arrivalsTask, spawnPlanTask);
+    tickGraph.precede(arrivalsTask, statisticsTask);
+    tickGraph.precede(spawnPlanTask, spawnCommitTask);
+    tickGraph.precede(statisticsTask, spawnCommitTask);
+}
+
+void Simulation::updateEvents(float deltaTime) {
+    for (auto& event : events) {
+        if (!event) continue;
+
+        try {
+            event->update(deltaTime);
+
+            Route* route = graph->getRoute(event->getRouteId());
+            if (route && event->isActive()) {
+                event->applyToRoute(route);
+            } else if (route && event->isFinished()) {
+                // Réinitialiser la route (et retirer la charge simulée par l'événement)
+                route->setCongestion(0.0f);
+                route->setState(RouteState::NORMAL);
+            }
+        } catch (...) {
+            // Ignorer les erreurs d'événement
+            continue;
+        }
+    }
+
+    // Suppression des événements terminés
+    events.erase(
+        std::remove_if(events.begin(), events.end(),
+            [](const std::unique_ptr<Event>& e) { return e->isFinished(); }),
+        events.end()
+    );
+
+    // Déclenchement d'événements aléatoires
+    if (simulationTime >= nextEventTime && static_cast<int>(events.size()) < eventCount) {
+        triggerRandomEvent();
+        nextEventTime = simulationTime + eventInterval;
+    }
+}
+
+void Simulation::removeArrivedVehicles() {
+    for (auto& region : regions) {
+        region.vehicles.erase(
+            std::remove_if(region.vehicles.begin(), region.vehicles.end(),
+                [](const Vehicle* v) { return v->hasReachedDestination(); }),
+            region.vehicles.end());
+    }
+    rerouteCandidates.erase(
+        std::remove_if(rerouteCandidates.begin(), rerouteCandidates.end(),
+            [](const Vehicle* v) { return v->hasReachedDestination(); }),
+        rerouteCandidates.end());
+    unsigned int slot = scheduler->getThreadIndex();
+    for (auto& vehicle : vehicles) {
+        if (vehicle->hasReachedDestination()) {
+            unindexVehicleRoutes(vehicle.get(), vehicle->getCurrentRouteIndex(),
+                                 vehicle->getPathRoutes().size());
+            float travelTime = simulationTime - vehicle->getDepartureTime();
+            statistics.recordTrip(slot, travelTime, travelTime - vehicle->getFreeFlowTime());
+        }
+    }
+    vehicles.erase(
+        std::remove_if(vehicles.begin(), vehicles.end(),
+            [](const std::unique_ptr<Vehicle>& v) { return v->hasReachedDestination(); }),
+        vehicles.end()
+    );
+}
+
+void Simulation::planSpawns() {
+    // Tirage séquentiel des paires départ/destination (ordre du générateur aléatoire fixe),
+    // puis planification des trajets en parallèle
+    spawnRequests.clear();
+    spawnPaths.clear();
+    
+    int missing = vehicleCount - static_cast<int>(vehicles.size());
+    if (missing <= 0 || graph->getNodes().size() < 2 || connectedNodes.size() < 2) {
+        return;
+    }
+    
+    std::uniform_int_distribution<int> nodeDist(0, connectedNodes.size() - 1);
+    for (int i = 0; i < missing; i++) {
+        int startIdx = nodeDist(rng);
+        int endIdx = nodeDist(rng);
+        
+        // S'assurer que start != end
+        int attempts = 0;
+        while (endIdx == startIdx && attempts < 10) {
+            endIdx = nodeDist(rng);
+            attempts++;
+        }
+        
+        if (endIdx == startIdx) break; // Impossible de trouver deux nœuds différents
+        
+        spawnRequests.emplace_back(connectedNodes[startIdx], connectedNodes[endIdx]);
+    }
+    
+    spawnPaths = pathPlanner->planPaths(spawnRequests, scheduler.get());
+}
+
+void Simulation::commitSpawns() {
+    // Créer de nouveaux véhicules pour maintenir le nombre cible
+    for (size_t i = 0; i < spawnPaths.size(); i++) {
+        const std::vector<int>& path = spawnPaths[i];
+        if (path.size() < 2) {
+            break; // Pas de chemin trouvé, arrêter d'essayer
+        }
+        
+        int start = spawnRequests[i].first;
+        int end = spawnRequests[i].second;
+        auto vehicle = std::make_unique<Vehicle>(nextVehicleId++, start, end);
+        assignPath(vehicle.get(), path);
+        depart(vehicle.get());
+        const Node* startNode = graph->getNode(start);
+        if (startNode) {
+            vehicle->calculatePosition(*graph);
+        }
+        vehicles.push_back(std::move(vehicle));
+    }
+    spawnRequests.clear();
+    spawnPaths.clear();
+}
+
+void Simulation::refreshConnectedNodes() {
+    // Nœuds ayant au moins une route (départs/destinations possibles)
+    connectedNodes.clear();
+    for (const auto& node : graph->getNodes()) {
+        if (!graph->getRoutesFromNode(node->id).empty()) {
+            connectedNodes.push_back(node->id);
+        }
+    }
+}
+
+void Simulation::updateVehicles(float deltaTime) {
+    if (dynamics) {
+        updateModelVehicles(deltaTime);
+        return;
+    }
+    if (partition) {
+        updateRegionVehicles(deltaTime);
+        return;
+    }
+    
+    // Phase 1 (parallèle) : chaque véhicule avance et calcule son éventuel nouveau chemin.
+    // Le graphe n'est que lu pendant cette phase (les soldes d'occupation sont différés
+    // jusqu'à updateTraffic), il sert donc d'instantané commun à tous les threads.
+    // Phase 2 (séquentielle, dans l'ordre des véhicules) : application des résultats.
+    // Le résultat est ainsi identique quel que soit le nombre de threads.
+    vehicleSteps.resize(vehicles.size());
+    float effectiveDeltaTime = isPaused ? 0.0f : deltaTime;
+    bool allowRerouting = !isPaused && reroutingEnabled;
+    
+    scheduler->parallelFor(vehicles.size(), VEHICLE_GRAIN, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; i++) {
+            Vehicle* vehicle = vehicles[i].get();
+            VehicleStep& step = vehicleSteps[i];
+            step.valid = false;
+            step.replanned = false;
+            step.newPath.clear();
+            
+            if (!vehicle || vehicle->hasReachedDestination()) {
+                continue;
+            }
             
             try {
-                event->update(deltaTime);
+                // Toujours mettre à jour les véhicules (même en pause pour le rendu)
+                // Mais seulement avancer si pas en pause
+                step.edgeBefore = vehicle->getCurrentRouteIndex();
+                vehicle->update(effectiveDeltaTime, *graph);
+                step.edgeAfter = vehicle->getCurrentRouteIndex();
+                step.valid = true;
                 
-                Route* route = graph->getRoute(event->getRouteId());
-                if (route && event->isActive()) {
-                    event->applyToRoute(route);
-                } else if (route && event->isFinished()) {
-                    // Réinitialiser la route
-                    route->setState(RouteState::NORMAL);
+                // Vérifier si reroutage nécessaire (seulement si pas en pause)
+                if (allowRerouting && vehicle->needsReroutingCheck()) {
+                    int currentPos = vehicle->getCurrentNode();
+                    int target = vehicle->getTargetNode();
+                    
+                    if (currentPos >= 0 && target >= 0) {
+                        auto planStart = std::chrono::steady_clock::now();
+                        step.newPath = pathPlanner->replanPath(
+                            currentPos, target, vehicle->getPath(), currentPos);
+                        // Chemin vide : pas d'alternative, le véhicule reste arrêté
+                        // et le flag needsRerouting reste à true pour réessayer plus tard
+                        step.replanned = !step.newPath.empty();
+                        if (step.replanned) {
+                            statistics.recordReroute(scheduler->getThreadIndex(), elapsedNanoseconds(planStart));
+                        }
+                    }
                 }
+            } catch (const std::exception& e) {
+                // Log l'erreur pour debug
+                std::cout << "ERREUR dans vehicle->update: " << e.what() << std::endl;
             } catch (...) {
-                // Ignorer les erreurs d'événement
-                continue;
+                // Ignorer les erreurs de mise à jour d'un véhicule
             }
         }
+    });
+    
+    for (size_t i = 0; i < vehicles.size(); i++) {
+        Vehicle* vehicle = vehicles[i].get();
+        const VehicleStep& step = vehicleSteps[i];
+        if (!step.valid) {
+            continue;
+        }
         
-        // Suppression des événements terminés
-        events.erase(
-            std::remove_if(events.begin(), events.end(),
-                [](const std::unique_ptr<Event>& e) { return e->isFinished(); }),
-            events.end()
-        );
+        if (step.edgeAfter > step.edgeBefore) {
+            // Routes quittées : le véhicule ne les emprunte plus
+            recordRouteExits(vehicle, step.edgeBefore, step.edgeAfter);
+            unindexVehicleRoutes(vehicle, step.edgeBefore, step.edgeAfter);
+            queueEdgeOccupancy(vehicle, step.edgeBefore, -1);
+            queueEdgeOccupancy(vehicle, step.edgeAfter, +1);
+        }
         
-        // Déclenchement d'événements aléatoires
-        if (simulationTime >= nextEventTime && static_cast<int>(events.size()) < eventCount) {
-            triggerRandomEvent();
-            nextEventTime = simulationTime + eventInterval;
+        if (step.replanned) {
+            assignPath(vehicle, step.newPath);
+            vehicle->clearReroutingFlag();
+            totalReroutings++;
         }
     }
+}
+
+void Simulation::updateRegionVehicles(float deltaTime) {
+    // Phase 1 (une tâche par région) : chaque région fait avancer ses véhicules et tient
+    // seule l'index et les soldes d'occupation de ses routes. Un véhicule qui entre sur
+    // une route d'une autre région est déposé dans la boîte aux lettres correspondante.
+    float effectiveDeltaTime = isPaused ? 0.0f : deltaTime;
+    bool allowRerouting = !isPaused && reroutingEnabled;
     
-    // Mise à jour des véhicules (TOUJOURS, même en pause pour le rendu)
-    for (auto& vehicle : vehicles) {
-        if (!vehicle) continue;
-        
-        if (vehicle->hasReachedDestination()) {
-            continue;
+    scheduler->parallelFor(regions.size(), 1, [&](size_t begin, size_t end) {
+        for (size_t r = begin; r < end; r++) {
+            updateRegion(static_cast<int>(r), effectiveDeltaTime, allowRerouting);
+        }
+    });
+    
+    // Limite de tick : chaque région reçoit les véhicules qui entrent chez elle
+    scheduler->parallelFor(regions.size(), 1, [&](size_t begin, size_t end) {
+        for (size_t r = begin; r < end; r++) {
+            RegionState& region = regions[r];
+            handoffs.drain(static_cast<int>(r), [&region](const Handoff& handoff) {
+                region.vehicles.push_back(handoff.vehicle);
+                if (handoff.routeIndex >= 0) {
+                    region.occupancyDeltas.emplace_back(handoff.routeIndex, +1);
+                }
+            });
+        }
+    });
+    
+    // Phase 2 (séquentielle) : soldes régionaux vers le graphe, puis reroutages
+    // dans l'ordre des IDs, comme sans découpage
+    std::vector<std::pair<Vehicle*, std::vector<int>>*> reroutes;
+    for (auto& region : regions) {
+        for (const auto& delta : region.occupancyDeltas) {
+            graph->queueVehicleDelta(delta.first, delta.second);
+        }
+        region.occupancyDeltas.clear();
+        for (auto& reroute : region.reroutes) {
+            reroutes.push_back(&reroute);
         }
+    }
+    std::sort(reroutes.begin(), reroutes.end(),
+        [](const std::pair<Vehicle*, std::vector<int>>* a, const std::pair<Vehicle*, std::vector<int>>* b) {
+            return a->first->getId() < b->first->getId();
+        });
+    for (auto* reroute : reroutes) {
+        assignPath(reroute->first, reroute->second);
+        reroute->first->clearReroutingFlag();
+        totalReroutings++;
+    }
+    for (auto& region : regions) {
+        region.reroutes.clear();
+    }
+}
+
+void Simulation::updateRegion(int regionIndex, float deltaTime, bool allowRerouting) {
+    RegionState& region = regions[regionIndex];
+    size_t kept = 0;
+    
+    for (size_t i = 0; i < region.vehicles.size(); i++) {
+        Vehicle* vehicle = region.vehicles[i];
+        int destination = regionIndex;
         
-        try {
-            // Toujours mettre à jour les véhicules (même en pause pour le rendu)
-            // Mais seulement avancer si pas en pause
-            float effectiveDeltaTime = isPaused ? 0.0f : deltaTime;
-            vehicle->update(effectiveDeltaTime, *graph);
-            
-            // Vérifier si reroutage nécessaire (seulement si pas en pause)
-            if (!isPaused && reroutingEnabled && vehicle->needsReroutingCheck()) {
-                int currentPos = vehicle->getCurrentNode();
-                int target = vehicle->getTargetNode();
+        if (!vehicle->hasReachedDestination()) {
+            try {
+                int edgeBefore = vehicle->getCurrentRouteIndex();
+                vehicle->update(deltaTime, *graph);
+                int edgeAfter = vehicle->getCurrentRouteIndex();
+                
+                if (edgeAfter > edgeBefore) {
+                    // Route quittée : elle appartient à cette région
+                    recordRouteExits(vehicle, edgeBefore, edgeAfter);
+                    unindexVehicleRoutes(vehicle, edgeBefore, edgeAfter);
+                    const auto& pathRoutes = vehicle->getPathRoutes();
+                    if (edgeBefore >= 0 && edgeBefore < static_cast<int>(pathRoutes.size()) && pathRoutes[edgeBefore] >= 0) {
+                        region.occupancyDeltas.emplace_back(pathRoutes[edgeBefore], -1);
+                    }
+                    int nextRoute = edgeAfter < static_cast<int>(pathRoutes.size()) ? pathRoutes[edgeAfter] : -1;
+                    destination = vehicleRegion(vehicle);
+                    if (destination != regionIndex) {
+                        handoffs.post(regionIndex, destination, Handoff{vehicle, nextRoute});
+                    } else if (nextRoute >= 0) {
+                        region.occupancyDeltas.emplace_back(nextRoute, +1);
+                    }
+                }
                 
-                if (currentPos >= 0 && target >= 0) {
-                    std::vector<int> newPath = pathPlanner->replanPath(
-                        currentPos, target, vehicle->getPath(), currentPos);
+                if (allowRerouting && vehicle->needsReroutingCheck()) {
+                    int currentPos = vehicle->getCurrentNode();
+                    int target = vehicle->getTargetNode();
                     
-                    if (!newPath.empty()) {
-                        vehicle->setPath(newPath);
-                        vehicle->clearReroutingFlag();
-                        totalReroutings++;
-                    } else {
-                        // Pas de chemin alternatif trouvé - le véhicule reste arrêté
-                        // Le flag needsRerouting reste à true pour réessayer plus tard
+                    if (currentPos >= 0 && target >= 0) {
+                        auto planStart = std::chrono::steady_clock::now();
+                        std::vector<int> newPath = pathPlanner->replanPath(
+                            currentPos, target, vehicle->getPath(), currentPos);
+                        if (!newPath.empty()) {
+                            statistics.recordReroute(scheduler->getThreadIndex(), elapsedNanoseconds(planStart));
+                            region.reroutes.emplace_back(vehicle, std::move(newPath));
+                        }
                     }
                 }
+            } catch (const std::exception& e) {
+                std::cout << "ERREUR dans vehicle->update: " << e.what() << std::endl;
+            } catch (...) {
+                // Ignorer les erreurs de mise à jour d'un véhicule
             }
-        } catch (const std::exception& e) {
-            // Log l'erreur pour debug
-            std::cout << "ERREUR dans vehicle->update: " << e.what() << std::endl;
-            continue;
-        } catch (...) {
-            // Ignorer les erreurs de mise à jour d'un véhicule
+        }
+        
+        if (destination == regionIndex) {
+            region.vehicles[kept++] = vehicle;
+        }
+    }
+    region.vehicles.resize(kept);
+}
+
+void Simulation::updateModelVehicles(float deltaTime) {
+    // Le modèle de trafic fait avancer les véhicules ; les mouvements sont ensuite appliqués
+    // à l'index et à l'occupation des routes comme pour le modèle continu
+    if (!isPaused) {
+        vehicleMoves.clear();
+        dynamics->step(deltaTime, vehicleMoves, rerouteCandidates, scheduler.get());
+        for (const auto& move : vehicleMoves) {
+            recordRouteExits(move.vehicle, move.fromEdge, move.fromEdge + 1);
+            unindexVehicleRoutes(move.vehicle, move.fromEdge, move.fromEdge + 1);
+            queueEdgeOccupancy(move.vehicle, move.fromEdge, -1);
+            queueEdgeOccupancy(move.vehicle, move.fromEdge + 1, +1);
+        }
+        if (reroutingEnabled) {
+            rerouteBlockedVehicles();
+        } else {
+            rerouteCandidates.clear();   // Signalés une seule fois : repris par setMode
+        }
+        // Position de rendu calculée à la demande (refreshVehiclePositions) : le tick
+        // ne coûte que les têtes de file et les mouvements
+        positionsStale = true;
+    }
+}
+
+void Simulation::refreshVehiclePositions() const {
+    if (dynamics && positionsStale) {
+        dynamics->refreshPositions(scheduler.get());
+        positionsStale = false;
+    }
+}
+
+void Simulation::rerouteBlockedVehicles() {
+    // Candidats : signalés par le flux de changements ou bloqués en tête de file
+    std::sort(rerouteCandidates.begin(), rerouteCandidates.end(),
+        [](const Vehicle* a, const Vehicle* b) { return a->getId() < b->getId(); });
+    rerouteCandidates.erase(std::unique(rerouteCandidates.begin(), rerouteCandidates.end()),
+                            rerouteCandidates.end());
+    rerouteCandidates.erase(std::remove_if(rerouteCandidates.begin(), rerouteCandidates.end(),
+        [](const Vehicle* v) { return v->hasReachedDestination() || !v->needsReroutingCheck(); }),
+        rerouteCandidates.end());
+    if (rerouteCandidates.empty()) {
+        return;
+    }
+    
+    std::vector<std::pair<int, int>> requests;
+    requests.reserve(rerouteCandidates.size());
+    for (const Vehicle* vehicle : rerouteCandidates) {
+        requests.emplace_back(vehicle->getCurrentNode(), vehicle->getTargetNode());
+    }
+    // Un chemin du lot n'est disponible qu'à la fin du lot : c'est la latence de chaque reroutage
+    auto planStart = std::chrono::steady_clock::now();
+    std::vector<std::vector<int>> newPaths = pathPlanner->planPaths(requests, scheduler.get());
+    uint64_t latency = elapsedNanoseconds(planStart);
+    unsigned int slot = scheduler->getThreadIndex();
+    
+    // Pas d'alternative : le véhicule reste candidat et réessaiera au prochain tick
+    size_t kept = 0;
+    for (size_t i = 0; i < rerouteCandidates.size(); i++) {
+        Vehicle* vehicle = rerouteCandidates[i];
+        if (newPaths[i].empty()) {
+            rerouteCandidates[kept++] = vehicle;
             continue;
         }
+        assignPath(vehicle, newPaths[i]);
+        vehicle->clearReroutingFlag();
+        statistics.recordReroute(slot, latency);
+        totalReroutings++;
+    }
+    rerouteCandidates.resize(kept);
+}
+
+void Simulation::setTrafficModel(TrafficModel model) {
+    if (model == trafficModel) {
+        return;
     }
+    // Le modèle suivant reprend la progression laissée par le précédent
+    refreshVehiclePositions();
+    trafficModel = model;
+    rerouteCandidates.clear();
     
-    // Mise à jour du trafic (seulement si pas en pause)
-    if (!isPaused) {
-        graph->updateTraffic();
+    if (trafficModel == TrafficModel::MESOSCOPIC) {
+        dynamics = std::make_unique<QueueModel>(graph.get());
+    } else if (trafficModel == TrafficModel::MICROSCOPIC) {
+        dynamics = std::make_unique<CarFollowingModel>(graph.get());
+    } else if (trafficModel == TrafficModel::HYBRID) {
+        auto hybrid = std::make_unique<HybridModel>(graph.get());
+        if (hasFocusArea) {
+            hybrid->setFocusArea(focusArea[0], focusArea[1], focusArea[2], focusArea[3]);
+        }
+        dynamics = std::move(hybrid);
+    } else {
+        dynamics.reset();
     }
     
-    // Supprimer les véhicules arrivés et créer de nouveaux véhicules
-    if (!isPaused) {
-        vehicles.erase(
-            std::remove_if(vehicles.begin(), vehicles.end(),
-                [](const std::unique_ptr<Vehicle>& v) { return v->hasReachedDestination(); }),
-            vehicles.end()
-        );
-        
-        // Créer de nouveaux véhicules pour maintenir le nombre cible
-        while (static_cast<int>(vehicles.size()) < vehicleCount) {
-            const auto& nodes = graph->getNodes();
-            if (nodes.size() < 2) break;
-            
-            // Trouver les nœuds qui ont des connexions
-            std::vector<int> connectedNodes;
-            for (const auto& node : nodes) {
-                std::vector<int> routes = graph->getRoutesFromNode(node->id);
-                if (!routes.empty()) {
-                    connectedNodes.push_back(node->id);
-                }
-            }
-            
-            if (connectedNodes.empty()) break;
-            
-            std::uniform_int_distribution<int> nodeDist(0, connectedNodes.size() - 1);
-            int startIdx = nodeDist(rng);
-            int endIdx = nodeDist(rng);
-            
-            // S'assurer que start != end
-            int attempts = 0;
-            while (endIdx == startIdx && connectedNodes.size() > 1 && attempts < 10) {
-                endIdx = nodeDist(rng);
-                attempts++;
-            }
-            
-            if (endIdx == startIdx) break; // Impossible de trouver deux nœuds différents
-            
-            int start = connectedNodes[startIdx];
-            int end = connectedNodes[endIdx];
-            
-            // Planifier le chemin
-            std::vector<int> path = pathPlanner->planPath(start, end);
-            
-            if (!path.empty() && path.size() >= 2) {
-                int newId = vehicles.empty() ? 0 : vehicles.back()->getId() + 1;
-                auto vehicle = std::make_unique<Vehicle>(newId, start, end);
-                vehicle->setPath(path);
-                Node* startNode = graph->getNode(start);
-                if (startNode) {
-                    vehicle->calculatePosition(*graph);
-                }
-                vehicles.push_back(std::move(vehicle));
-            } else {
-                break; // Pas de chemin trouvé, arrêter d'essayer
+    if (dynamics) {
+        // Les véhicules entrent dans le modèle dans l'ordre de leur avancement sur la route
+        std::vector<Vehicle*> ordered;
+        ordered.reserve(vehicles.size());
+        for (const auto& vehicle : vehicles) {
+            ordered.push_back(vehicle.get());
+        }
+        std::stable_sort(ordered.begin(), ordered.end(),
+            [](const Vehicle* a, const Vehicle* b) { return a->getProgress() > b->getProgress(); });
+        for (Vehicle* vehicle : ordered) {
+            dynamics->enter(vehicle, 1.0f - vehicle->getProgress());
+            if (vehicle->needsReroutingCheck()) {
+                rerouteCandidates.push_back(vehicle);
             }
         }
+    } else {
+        // Les régions ne sont pas tenues à jour par les modèles de trafic
+        if (partition) {
+            rebuildPartition();
+        }
     }
-    
-    // Mise à jour des statistiques
-    updateStatistics();
+}
+
+void Simulation::setFocusArea(float minX, float minY, float maxX, float maxY) {
+    hasFocusArea = true;
+    focusArea[0] = minX;
+    focusArea[1] = minY;
+    focusArea[2] = maxX;
+    focusArea[3] = maxY;
+    if (trafficModel == TrafficModel::HYBRID) {
+        static_cast<HybridModel*>(dynamics.get())->setFocusArea(minX, minY, maxX, maxY);
+    }
+}
+
+void Simulation::setRegionCount(int count) {
+    regionCount = count;
+    if (regionCount > 1 && !graph->getNodes().empty()) {
+        rebuildPartition();
+    } else {
+        partition.reset();
+        regions.clear();
+        handoffs.resize(0);
+    }
+}
+
+void Simulation::rebuildPartition() {
+    partition = std::make_unique<GraphPartition>(*graph, regionCount);
+    regions.clear();
+    regions.resize(partition->getRegionCount());
+    handoffs.resize(partition->getRegionCount());
+    for (const auto& vehicle : vehicles) {
+        regions[vehicleRegion(vehicle.get())].vehicles.push_back(vehicle.get());
+    }
+}
+
+int Simulation::vehicleRegion(const Vehicle* vehicle) const {
+    // Région de la route occupée, à défaut celle du nœud courant
+    const auto& pathRoutes = vehicle->getPathRoutes();
+    size_t edge = vehicle->getCurrentRouteIndex();
+    int region = edge < pathRoutes.size() ? partition->getRouteRegion(pathRoutes[edge]) : -1;
+    if (region < 0) {
+        region = partition->getNodeRegion(vehicle->getCurrentNode());
+    }
+    return std::max(0, region);
+}
+
+void Simulation::moveVehicleRegion(Vehicle* vehicle, int fromRegion, int toRegion) {
+    if (fromRegion == toRegion) {
+        return;
+    }
+    if (fromRegion >= 0) {
+        auto& owned = regions[fromRegion].vehicles;
+        auto it = std::find(owned.begin(), owned.end(), vehicle);
+        if (it != owned.end()) {
+            *it = owned.back();
+            owned.pop_back();
+        }
+    }
+    regions[toRegion].vehicles.push_back(vehicle);
+}
+
+void Simulation::setThreadCount(unsigned int count) {
+    scheduler = std::make_unique<TaskScheduler>(count);
+    statistics.setSlotCount(scheduler->getThreadCount());
+}
+
+unsigned int Simulation::getThreadCount() const {
+    return scheduler->getThreadCount();
 }
 
 void Simulation::triggerRandomEvent() {
@@ -328,8 +951,7 @@ void Simulation::triggerRandomEvent() {
     float severity = severityDist(rng);
     float duration = durationDist(rng);
     
-    EventType type = static_cast<EventType>(
-        std::uniform_int_distribution<int>(0, 3)(rng));
+    EventType type = eventTypes[std::uniform_int_distribution<int>(0, static_cast<int>(eventTypes.size()) - 1)(rng)];
     
     addEvent(type, routeId, severity, duration);
 }
@@ -352,50 +974,618 @@ void Simulation::addEvent(EventType type, int routeId, float severity, float dur
 }
 
 void Simulation::rerouteAffectedVehicles(int routeId) {
-    for (auto& vehicle : vehicles) {
-        if (vehicle->hasReachedDestination()) {
+    TRACE_ZONE("Simulation::rerouteAffectedVehicles");
+    int routeIdx = graph->getRouteIndex(routeId);
+    if (routeIdx < 0 || routeIdx >= static_cast<int>(routeVehicles.size())) {
+        return;
+    }
+    
+    // Copie : assignPath modifie l'index pendant le parcours.
+    // Tri par ID pour un ordre de reroutage indépendant de l'historique de l'index.
+    std::vector<Vehicle*> affected;
+    affected.reserve(routeVehicles[routeIdx].size());
+    for (const RouteUser& user : routeVehicles[routeIdx]) {
+        affected.push_back(user.vehicle);
+    }
+    std::sort(affected.begin(), affected.end(),
+        [](const Vehicle* a, const Vehicle* b) { return a->getId() < b->getId(); });
+    
+    affected.erase(std::remove_if(affected.begin(), affected.end(),
+        [](const Vehicle* v) { return v->hasReachedDestination(); }), affected.end());
+    
+    // Recherches indépendantes (le graphe ne change pas pendant le lot) : planifiées en parallèle
+    std::vector<std::pair<int, int>> requests;
+    requests.reserve(affected.size());
+    for (const Vehicle* vehicle : affected) {
+        requests.emplace_back(vehicle->getCurrentNode(), vehicle->getTargetNode());
+    }
+    auto planStart = std::chrono::steady_clock::now();
+    std::vector<std::vector<int>> newPaths = pathPlanner->planPaths(requests, scheduler.get());
+    uint64_t latency = elapsedNanoseconds(planStart);
+    
+    for (size_t i = 0; i < affected.size(); i++) {
+        if (!newPaths[i].empty()) {
+            assignPath(affected[i], newPaths[i]);
+            statistics.recordReroute(scheduler->getThreadIndex(), latency);
+            totalReroutings++;
+        }
+    }
+}
+
+void Simulation::assignPath(Vehicle* vehicle, const std::vector<int>& path) {
+    bool modeled = (dynamics != nullptr);
+    bool regional = (partition && !modeled);
+    // Véhicule neuf (sans chemin) : il n'appartient encore à aucune région
+    int oldRegion = (regional && !vehicle->getPath().empty()) ? vehicleRegion(vehicle) : -1;
+    unindexVehicleRoutes(vehicle, vehicle->getCurrentRouteIndex(), vehicle->getPathRoutes().size());
+    queueEdgeOccupancy(vehicle, vehicle->getCurrentRouteIndex(), -1);
+    if (modeled) {
+        dynamics->remove(vehicle);
+    }
+    vehicle->setPath(path, *graph);
+    indexVehicleRoutes(vehicle, 0, vehicle->getPathRoutes().size());
+    queueEdgeOccupancy(vehicle, 0, +1);
+    if (modeled) {
+        dynamics->enter(vehicle);
+    }
+    if (regional) {
+        moveVehicleRegion(vehicle, oldRegion, vehicleRegion(vehicle));
+    }
+}
+
+void Simulation::queueEdgeOccupancy(const Vehicle* vehicle, int edge, int delta) {
+    const auto& pathRoutes = vehicle->getPathRoutes();
+    if (edge >= 0 && edge < static_cast<int>(pathRoutes.size())) {
+        graph->queueVehicleDelta(pathRoutes[edge], delta);
+    }
+}
+
+void Simulation::recordRouteExits(const Vehicle* vehicle, int firstEdge, int lastEdge) {
+    const auto& pathRoutes = vehicle->getPathRoutes();
+    unsigned int slot = scheduler->getThreadIndex();
+    lastEdge = std::min(lastEdge, static_cast<int>(pathRoutes.size()));
+    for (int edge = std::max(0, firstEdge); edge < lastEdge; edge++) {
+        statistics.recordRouteExit(slot, pathRoutes[edge]);
+    }
+}
+
+void Simulation::clearVehicles() {
+    // Les véhicules retirés libèrent la route qu'ils occupaient
+    for (const auto& vehicle : vehicles) {
+        queueEdgeOccupancy(vehicle.get(), vehicle->getCurrentRouteIndex(), -1);
+    }
+    vehicles.clear();
+    for (auto& region : regions) {
+        region.vehicles.clear();
+    }
+    if (dynamics) {
+        dynamics->reset();
+    }
+    rerouteCandidates.clear();
+    resetRouteIndex();
+}
+
+void Simulation::indexVehicleRoutes(Vehicle* vehicle, size_t firstEdge, size_t lastEdge) {
+    const auto& pathRoutes = vehicle->getPathRoutes();
+    lastEdge = std::min(lastEdge, pathRoutes.size());
+    for (size_t i = firstEdge; i < lastEdge; i++) {
+        int routeIdx = pathRoutes[i];
+        if (routeIdx >= 0 && routeIdx < static_cast<int>(routeVehicles.size())) {
+            auto& users = routeVehicles[routeIdx];
+            vehicle->setRouteSlot(i, static_cast<uint32_t>(users.size()));
+            users.push_back(RouteUser{vehicle, static_cast<uint32_t>(i)});
+        }
+    }
+}
+
+void Simulation::unindexVehicleRoutes(Vehicle* vehicle, size_t firstEdge, size_t lastEdge) {
+    const auto& pathRoutes = vehicle->getPathRoutes();
+    lastEdge = std::min(lastEdge, pathRoutes.size());
+    for (size_t i = firstEdge; i < lastEdge; i++) {
+        int routeIdx = pathRoutes[i];
+        if (routeIdx < 0 || routeIdx >= static_cast<int>(routeVehicles.size())) {
             continue;
         }
-        
-        const auto& path = vehicle->getPath();
-        // Vérifier si le véhicule utilise ou va utiliser cette route
-        bool affected = false;
-        for (size_t i = 0; i < path.size() - 1; i++) {
-            int from = path[i];
-            int to = path[i + 1];
-            
-            Route* route = nullptr;
-            for (const auto& r : graph->getRoutes()) {
-                if ((r->getFromNode() == from && r->getToNode() == to) ||
-                    (r->getFromNode() == to && r->getToNode() == from)) {
-                    route = r.get();
-                    break;
-                }
+        // Retrait en O(1) : le dernier usager prend la place libérée (l'ordre de la liste
+        // n'a pas d'importance) et son rang est corrigé. Les routes quittées pendant la
+        // mise à jour parallèle appartiennent à la région du thread : pas d'accès concurrent.
+        auto& users = routeVehicles[routeIdx];
+        uint32_t slot = vehicle->getRouteSlot(i);
+        if (slot >= users.size() || users[slot].vehicle != vehicle) {
+            continue;
+        }
+        users[slot] = users.back();
+        users[slot].vehicle->setRouteSlot(users[slot].edge, slot);
+        users.pop_back();
+    }
+}
+
+void Simulation::processRouteChanges() {
+    for (int routeIdx : graph->consumeRouteChanges()) {
+        const Route* route = graph->getRoutes()[routeIdx].get();
+        if (route->isUsable() || routeIdx >= static_cast<int>(routeVehicles.size())) {
+            continue;
+        }
+        for (const RouteUser& user : routeVehicles[routeIdx]) {
+            if (user.vehicle->needsReroutingCheck()) {
+                continue;   // Déjà signalé (et candidat)
             }
-            
-            if (route && route->getId() == routeId) {
-                affected = true;
-                break;
+            user.vehicle->requestRerouting();
+            if (dynamics && reroutingEnabled) {
+                rerouteCandidates.push_back(user.vehicle);
             }
         }
+    }
+}
+
+void Simulation::resetRouteIndex() {
+    routeVehicles.assign(graph->getRoutes().size(), std::vector<RouteUser>());
+    statistics.setRouteCount(graph->getRoutes().size());
+}
+
+void Simulation::depart(Vehicle* vehicle) {
+    float freeFlow = 0.0f;
+    for (int routeIdx : vehicle->getPathRoutes()) {
+        const Route* route = routeIdx >= 0 ? graph->getRoutes()[routeIdx].get() : nullptr;
+        if (route && route->getBaseSpeed() > 0.0f) {
+            freeFlow += route->getLength() / (route->getBaseSpeed() / 3.6f);
+        }
+    }
+    vehicle->setDeparture(simulationTime, freeFlow);
+}
+
+void Simulation::updateStatistics() {
+    // Moyenne sans fusion des histogrammes : une somme par thread
+    averageTravelTime = statistics.getMeanTravelTime();
+}
+
+void Simulation::captureSnapshot(FrameSnapshot& frame) const {
+    refreshVehiclePositions();
+    // Les tableaux gardent leur capacité : pas d'allocation une fois le régime établi
+    frame.vehicles.clear();
+    for (const auto& vehicle : vehicles) {
+        if (!vehicle->hasReachedDestination()) {
+            // Position précédente renseignée par le producteur de l'instantané (SimulationRunner)
+            float x = vehicle->getX(), y = vehicle->getY(), angle = vehicle->getAngle();
+            frame.vehicles.push_back(VehicleSnapshot{vehicle->getId(), vehicle->getVehicleType(),
+                                                     x, y, angle, x, y, angle});
+        }
+    }
+    
+    const auto& routes = graph->getRoutes();
+    frame.routeStates.resize(routes.size());
+    for (size_t i = 0; i < routes.size(); i++) {
+        frame.routeStates[i] = routes[i]->getState();
+    }
+    
+    frame.events.clear();
+    for (const auto& event : events) {
+        frame.events.push_back(EventSnapshot{event->getId(), event->getType(), event->getRouteId(),
+                                             event->getDuration(), event->getElapsedTime(), event->isActive()});
+    }
+    
+    frame.vehicleCount = vehicles.size();
+    frame.simulationTime = simulationTime;
+    frame.totalReroutings = totalReroutings;
+    frame.mode = mode;
+    frame.trafficModel = trafficModel;
+    frame.paused = isPaused;
+    frame.timeScale = timeScale;
+    frame.fastForward = fastForward;
+    frame.effectiveTimeScale = effectiveTimeScale;
+    frame.profile = getProfile();
+}
+
+void Simulation::encodeCheckpoint(BinaryWriter& out) const {
+    out.reserve(CHECKPOINT_HEADER_SIZE + graph->getRoutes().size() * 16 + vehicles.size() * 32);
+    for (char c : CHECKPOINT_MAGIC) {
+        out.writeU8(static_cast<uint8_t>(c));
+    }
+    out.writeU32(CHECKPOINT_VERSION);
+    out.writeU64(0);  // Taille et somme de contrôle, complétées une fois le contenu écrit
+    out.writeU64(0);
+    writeCheckpoint(out);
+    size_t payload = out.size() - CHECKPOINT_HEADER_SIZE;
+    out.patchU64(8, payload);
+    out.patchU64(16, fnv1a64(out.data().data() + CHECKPOINT_HEADER_SIZE, payload));
+}
+
+bool Simulation::saveCheckpoint(const std::string& path) const {
+    BinaryWriter out;
+    encodeCheckpoint(out);
+    return writeCheckpointFile(path, out);
+}
+
+bool Simulation::writeCheckpointFile(const std::string& path, const BinaryWriter& out) {
+    // Écriture dans un fichier temporaire renommé à la fin : un point de reprise
+    // existant n'est jamais remplacé par un fichier incomplet
+    std::string temporary = path + ".tmp";
+    std::ofstream file(temporary, std::ios::binary | std::ios::trunc);
+    if (file) {
+        file.write(reinterpret_cast<const char*>(out.data().data()), static_cast<std::streamsize>(out.size()));
+        file.close();
+    }
+    if (!file) {
+        std::cout << "ERREUR: ecriture du point de reprise impossible: " << temporary << std::endl;
+        std::remove(temporary.c_str());
+        return false;
+    }
+    if (std::rename(temporary.c_str(), path.c_str()) != 0) {
+        std::remove(path.c_str());
+        if (std::rename(temporary.c_str(), path.c_str()) != 0) {
+            std::cout << "ERREUR: impossible de renommer le point de reprise en " << path << std::endl;
+            std::remove(temporary.c_str());
+            return false;
+        }
+    }
+    return true;
+}
+
+bool Simulation::saveCheckpointInBackground(const std::string& path) {
+#ifdef SIMULATION_HAS_FORK
+    if (checkpointProcess != 0) {
+        return false;
+    }
+    // Encodage dans ce processus : les threads de l'ordonnanceur n'existent pas dans le
+    // fils, et un verrou (ordonnanceur, flux, allocateur) tenu par l'un d'eux au moment
+    // du fork y resterait pris
+    BinaryWriter out;
+    encodeCheckpoint(out);
+    std::string temporary = path + ".tmp";
+    std::cout.flush();  // Sinon le tampon de sortie serait écrit deux fois
+    pid_t child = ::fork();
+    if (child == 0) {
+        _exit(writeFileDirect(temporary.c_str(), path.c_str(), out.data().data(), out.size()) ? 0 : 1);
+    }
+    if (child > 0) {
+        checkpointProcess = child;
+        return true;
+    }
+    std::cout << "ATTENTION: fork impossible, sauvegarde synchrone" << std::endl;
+    checkpointSaved = writeCheckpointFile(path, out);
+#else
+    checkpointSaved = saveCheckpoint(path);
+#endif
+    return checkpointSaved;
+}
+
+bool Simulation::waitForCheckpoint() {
+#ifdef SIMULATION_HAS_FORK
+    if (checkpointProcess != 0) {
+        int status = 0;
+        pid_t done = waitpid(static_cast<pid_t>(checkpointProcess), &status, 0);
+        checkpointProcess = 0;
+        checkpointSaved = done > 0 && WIFEXITED(status) && WEXITSTATUS(status) == 0;
+    }
+#endif
+    bool saved = checkpointSaved;
+    checkpointSaved = true;
+    return saved;
+}
+
+bool Simulation::loadCheckpoint(const std::string& path) {
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    std::streamoff fileSize = file ? static_cast<std::streamoff>(file.tellg()) : -1;
+    if (fileSize < 0) {
+        std::cout << "ERREUR: point de reprise introuvable: " << path << std::endl;
+        return false;
+    }
+    std::vector<unsigned char> data(static_cast<size_t>(fileSize));
+    file.seekg(0);
+    file.read(reinterpret_cast<char*>(data.data()), static_cast<std::streamsize>(data.size()));
+    if (!file || data.size() < CHECKPOINT_HEADER_SIZE ||
+        std::memcmp(data.data(), CHECKPOINT_MAGIC, sizeof(CHECKPOINT_MAGIC)) != 0) {
+        std::cout << "ERREUR: " << path << " n'est pas un point de reprise" << std::endl;
+        return false;
+    }
+    
+    BinaryReader header(data.data() + sizeof(CHECKPOINT_MAGIC), CHECKPOINT_HEADER_SIZE - sizeof(CHECKPOINT_MAGIC));
+    uint32_t version = header.readU32();
+    uint64_t payload = header.readU64();
+    uint64_t checksum = header.readU64();
+    if (version != CHECKPOINT_VERSION) {
+        std::cout << "ERREUR: version de point de reprise non supportee: " << version << std::endl;
+        return false;
+    }
+    if (payload != data.size() - CHECKPOINT_HEADER_SIZE ||
+        fnv1a64(data.data() + CHECKPOINT_HEADER_SIZE, static_cast<size_t>(payload)) != checksum) {
+        std::cout << "ERREUR: point de reprise corrompu: " << path << std::endl;
+        return false;
+    }
+    
+    BinaryReader in(data.data() + CHECKPOINT_HEADER_SIZE, static_cast<size_t>(payload));
+    uint64_t nodeCount = in.readVarint();
+    uint64_t routeCount = in.readVarint();
+    uint64_t fingerprint = in.readU64();
+    if (nodeCount != graph->getNodes().size() || routeCount != graph->getRoutes().size() ||
+        fingerprint != graph->getFingerprint()) {
+        std::cout << "ERREUR: le point de reprise a ete ecrit pour un autre reseau" << std::endl;
+        return false;
+    }
+    return readCheckpoint(in);
+}
+
+void Simulation::writeCheckpoint(BinaryWriter& out) const {
+    refreshVehiclePositions();
+    const auto& routes = graph->getRoutes();
+    out.writeVarint(graph->getNodes().size());
+    out.writeVarint(routes.size());
+    out.writeU64(graph->getFingerprint());
+    
+    // Horloges, paramètres et compteurs
+    out.writeFloat(simulationTime);
+    out.writeFloat(pendingTime);
+    out.writeU8(static_cast<uint8_t>(mode));
+    out.writeU8(static_cast<uint8_t>(trafficModel));
+    out.writeU8(isPaused ? 1 : 0);
+    out.writeU8(fastForward ? 1 : 0);
+    out.writeFloat(timeScale);
+    out.writeFloat(fixedTimeStep);
+    out.writeSigned(vehicleCount);
+    out.writeSigned(eventCount);
+    out.writeFloat(nextEventTime);
+    out.writeFloat(eventInterval);
+    out.writeSigned(totalReroutings);
+    out.writeSigned(nextVehicleId);
+    out.writeU8(hasFocusArea ? 1 : 0);
+    for (float bound : focusArea) {
+        out.writeFloat(bound);
+    }
+    // Générateur aléatoire : représentation standard de l'état (portable entre compilateurs)
+    std::ostringstream rngState;
+    rngState << rng;
+    out.writeString(rngState.str());
+    
+    // Routes : état, occupation, vitesse et solde pas encore appliqué (updateTraffic)
+    for (size_t i = 0; i < routes.size(); i++) {
+        const Route* route = routes[i].get();
+        out.writeU8(static_cast<uint8_t>(route->getState()));
+        out.writeVarint(route->getVehicleCount());
+        out.writeVarint(route->getInducedLoad());
+        out.writeFloat(route->getCurrentSpeed());
+        out.writeSigned(graph->getPendingVehicleDelta(static_cast<int>(i)));
+    }
+    const std::vector<int>& changes = graph->getPendingRouteChanges();
+    out.writeVarint(changes.size());
+    for (int routeIdx : changes) {
+        out.writeVarint(routeIdx);
+    }
+    statistics.write(out);
+    
+    out.writeVarint(events.size());
+    for (const auto& event : events) {
+        out.writeSigned(event->getId());
+        out.writeU8(static_cast<uint8_t>(event->getType()));
+        out.writeSigned(event->getRouteId());
+        out.writeFloat(event->getSeverity());
+        out.writeFloat(event->getDuration());
+        out.writeFloat(event->getElapsedTime());
+        out.writeU8(event->isActive() ? 1 : 0);
+    }
+    
+    // Véhicules dans l'ordre croissant des identifiants ; identifiants et nœuds du
+    // chemin codés par écart au précédent (un octet en général). La position de
+    // rendu est celle du dernier tick (elle ne se déduit pas toujours de la progression).
+    out.writeVarint(vehicles.size());
+    int previousId = -1;
+    for (const auto& vehicle : vehicles) {
+        out.writeSigned(vehicle->getId() - previousId);
+        previousId = vehicle->getId();
+        out.writeSigned(vehicle->getCurrentNode());
+        out.writeSigned(vehicle->getTargetNode());
+        out.writeVarint(vehicle->getCurrentRouteIndex());
+        out.writeFloat(vehicle->getProgress());
+        out.writeU8(vehicle->needsReroutingCheck() ? 1 : 0);
+        out.writeFloat(vehicle->getX());
+        out.writeFloat(vehicle->getY());
+        out.writeFloat(vehicle->getAngle());
+        out.writeFloat(vehicle->getDepartureTime());
+        out.writeFloat(vehicle->getFreeFlowTime());
+        const std::vector<int>& path = vehicle->getPath();
+        out.writeVarint(path.size());
+        int previousNode = 0;
+        for (int node : path) {
+            out.writeSigned(static_cast<int64_t>(node) - previousNode);
+            previousNode = node;
+        }
+    }
+    
+    if (dynamics) {
+        dynamics->saveState(out);
+    }
+}
+
+bool Simulation::readCheckpoint(BinaryReader& in) {
+    // Paramètres lus et vérifiés avant toute modification
+    float savedTime = in.readFloat();
+    float savedPending = in.readFloat();
+    uint8_t savedMode = in.readU8();
+    uint8_t savedModel = in.readU8();
+    bool savedPaused = in.readU8() != 0;
+    bool savedFastForward = in.readU8() != 0;
+    float savedScale = in.readFloat();
+    float savedStep = in.readFloat();
+    int savedVehicleCount = static_cast<int>(in.readSigned());
+    int savedEventCount = static_cast<int>(in.readSigned());
+    float savedNextEvent = in.readFloat();
+    float savedEventInterval = in.readFloat();
+    int savedReroutings = static_cast<int>(in.readSigned());
+    int savedNextVehicleId = static_cast<int>(in.readSigned());
+    bool savedFocus = in.readU8() != 0;
+    float savedArea[4];
+    for (float& bound : savedArea) {
+        bound = in.readFloat();
+    }
+    std::istringstream rngState(in.readString());
+    std::mt19937 savedRng;
+    rngState >> savedRng;
+    if (!in.ok() || rngState.fail() || savedMode > static_cast<uint8_t>(SimulationMode::DYNAMIC) ||
+        savedModel > static_cast<uint8_t>(TrafficModel::HYBRID)) {
+        std::cout << "ERREUR: parametres du point de reprise invalides" << std::endl;
+        return false;
+    }
+    
+    clearVehicles();
+    events.clear();
+    simulationTime = savedTime;
+    pendingTime = savedPending;
+    setMode(static_cast<SimulationMode>(savedMode));
+    isPaused = savedPaused;
+    fastForward = savedFastForward;
+    setTimeScale(savedScale);
+    setFixedTimeStep(savedStep);
+    vehicleCount = savedVehicleCount;
+    eventCount = savedEventCount;
+    nextEventTime = savedNextEvent;
+    eventInterval = savedEventInterval;
+    totalReroutings = savedReroutings;
+    nextVehicleId = savedNextVehicleId;
+    hasFocusArea = savedFocus;
+    std::copy(savedArea, savedArea + 4, focusArea);
+    rng = savedRng;
+    measuredRealTime = 0.0f;
+    measuredSimulatedTime = 0.0f;
+    // Modèle vide (véhicules retirés ci-dessus) : son état est restauré après les véhicules
+    setTrafficModel(static_cast<TrafficModel>(savedModel));
+    
+    // À partir d'ici une incohérence vide la simulation plutôt que de la laisser à moitié restaurée
+    auto fail = [this]() {
+        clearVehicles();
+        events.clear();
+        std::cout << "ERREUR: contenu du point de reprise incoherent, simulation videe" << std::endl;
+        return false;
+    };
+    
+    const auto& routes = graph->getRoutes();
+    std::vector<int> pendingDeltas(routes.size(), 0);
+    for (size_t i = 0; i < routes.size(); i++) {
+        uint8_t state = in.readU8();
+        int count = static_cast<int>(in.readVarint());
+        int load = static_cast<int>(in.readVarint());
+        float speed = in.readFloat();
+        pendingDeltas[i] = static_cast<int>(in.readSigned());
+        if (state > static_cast<uint8_t>(RouteState::ACCIDENT)) {
+            return fail();
+        }
+        routes[i]->restoreState(static_cast<RouteState>(state), count, load, speed);
+    }
+    std::vector<int> changes(in.readCount());
+    for (int& routeIdx : changes) {
+        routeIdx = static_cast<int>(in.readVarint());
+    }
+    graph->restorePendingState(pendingDeltas, changes);
+    if (!statistics.read(in)) {
+        return fail();
+    }
+    averageTravelTime = statistics.getMeanTravelTime();
+    
+    size_t eventTotal = in.readCount();
+    for (size_t i = 0; i < eventTotal; i++) {
+        int id = static_cast<int>(in.readSigned());
+        uint8_t type = in.readU8();
+        int routeId = static_cast<int>(in.readSigned());
+        float severity = in.readFloat();
+        float duration = in.readFloat();
+        float elapsed = in.readFloat();
+        bool active = in.readU8() != 0;
+        if (type > static_cast<uint8_t>(EventType::EMERGENCY)) {
+            return fail();
+        }
+        auto event = std::make_unique<Event>(id, static_cast<EventType>(type), routeId, severity, duration);
+        event->restoreState(elapsed, active);
+        events.push_back(std::move(event));
+    }
+    
+    size_t vehicleTotal = in.readCount();
+    vehicles.reserve(vehicleTotal);
+    int previousId = -1;
+    std::vector<int> path;
+    for (size_t i = 0; i < vehicleTotal; i++) {
+        int id = previousId + static_cast<int>(in.readSigned());
+        int node = static_cast<int>(in.readSigned());
+        int target = static_cast<int>(in.readSigned());
+        size_t edge = static_cast<size_t>(in.readVarint());
+        float progress = in.readFloat();
+        bool rerouting = in.readU8() != 0;
+        float x = in.readFloat();
+        float y = in.readFloat();
+        float angle = in.readFloat();
+        float departure = in.readFloat();
+        float freeFlow = in.readFloat();
+        path.resize(in.readCount());
+        int64_t previousNode = 0;
+        for (int& pathNode : path) {
+            previousNode += in.readSigned();
+            pathNode = static_cast<int>(previousNode);
+        }
+        // Identifiants croissants : recherche par dichotomie pour l'état du modèle
+        if (!in.ok() || id <= previousId || (!path.empty() && edge >= path.size())) {
+            return fail();
+        }
+        previousId = id;
         
-        if (affected) {
-            int currentPos = vehicle->getCurrentNode();
-            int target = vehicle->getTargetNode();
-            std::vector<int> newPath = pathPlanner->replanPath(
-                currentPos, target, path, currentPos);
-            
-            if (!newPath.empty()) {
-                vehicle->setPath(newPath);
-                totalReroutings++;
+        auto vehicle = std::make_unique<Vehicle>(id, node, target);
+        vehicle->setPath(path, *graph);
+        vehicle->restoreState(node, static_cast<int>(edge), progress, rerouting);
+        vehicle->restorePosition(x, y, angle);
+        vehicle->setDeparture(departure, freeFlow);
+        indexVehicleRoutes(vehicle.get(), edge, vehicle->getPathRoutes().size());
+        vehicles.push_back(std::move(vehicle));
+    }
+    if (nextVehicleId <= previousId) {
+        return fail();
+    }
+    
+    if (dynamics) {
+        auto findVehicle = [this](int id) -> Vehicle* {
+            auto it = std::lower_bound(vehicles.begin(), vehicles.end(), id,
+                [](const std::unique_ptr<Vehicle>& vehicle, int value) { return vehicle->getId() < value; });
+            return (it != vehicles.end() && (*it)->getId() == id) ? it->get() : nullptr;
+        };
+        if (!dynamics->loadState(in, findVehicle)) {
+            return fail();
+        }
+        positionsStale = false;   // Positions relues : celles du point de reprise
+        for (const auto& vehicle : vehicles) {
+            if (vehicle->needsReroutingCheck()) {
+                rerouteCandidates.push_back(vehicle.get());
             }
         }
+    } else if (partition) {
+        rebuildPartition();
+    }
+    if (!in.ok() || !in.atEnd()) {
+        return fail();
     }
+    
+    refreshConnectedNodes();
+    return true;
 }
 
-void Simulation::updateStatistics() {
-    // Calcul des statistiques de base
-    // (peut être étendu)
+std::unique_ptr<Simulation> Simulation::fork(unsigned int threadCount) const {
+    auto copy = std::make_unique<Simulation>(threadCount);
+    if (const PathfindingStrategy* strategy = pathPlanner->getStrategy()) {
+        copy->setPathfindingStrategy(strategy->clone());
+    }
+    copy->graph->setTopology(graph->getTopology());
+    copy->regionCount = regionCount;
+    copy->eventTypes = eventTypes;
+    if (regionCount > 1 && !graph->getNodes().empty()) {
+        copy->rebuildPartition();
+    }
+    
+    BinaryWriter state;
+    state.reserve(graph->getRoutes().size() * 16 + vehicles.size() * 48);
+    writeCheckpoint(state);
+    BinaryReader in(state.data().data(), state.size());
+    in.readVarint();  // Nombre de nœuds, de routes et empreinte : même topologie par construction
+    in.readVarint();
+    in.readU64();
+    if (!copy->readCheckpoint(in)) {
+        return nullptr;
+    }
+    copy->isPaused = false;
+    return copy;
 }
 
 void Simulation::printStatistics() const {
@@ -404,6 +1594,25 @@ void Simulation::printStatistics() const {
     std::cout << "Nombre de véhicules: " << vehicles.size() << std::endl;
     std::cout << "Nombre d'événements actifs: " << events.size() << std::endl;
     std::cout << "Total reroutages: " << totalReroutings << std::endl;
+    
+    StatisticsReport report = getStatistics();
+    std::cout << "Trajets termines: " << report.travelTime.count << std::endl;
+    std::cout << "Temps de parcours: moyenne " << report.travelTime.mean << "s, p50 " << report.travelTime.p50
+              << "s, p95 " << report.travelTime.p95 << "s, p99 " << report.travelTime.p99 << "s" << std::endl;
+    std::cout << "Retard sur le parcours a vide: moyenne " << report.delay.mean << "s, p95 " << report.delay.p95
+              << "s, p99 " << report.delay.p99 << "s" << std::endl;
+    std::cout << "Calcul d'un reroutage: p50 " << report.rerouteLatency.p50 << "us, p99 "
+              << report.rerouteLatency.p99 << "us" << std::endl;
+    
+    SearchStats searches = getSearchStats();
+    if (searches.searches > 0) {
+        double perSearch = 1.0 / searches.searches;
+        std::cout << "Recherches de chemin: " << searches.searches << " (par recherche: "
+                  << searches.nodesSettled * perSearch << " noeuds fixes, "
+                  << searches.edgesRelaxed * perSearch << " aretes relachees, "
+                  << searches.heapPops * perSearch << " sorties du tas, "
+                  << searches.time * perSearch * 1e-3 << "us)" << std::endl;
+    }
     std::cout << "Mode: " << (mode == SimulationMode::DYNAMIC ? "Dynamique" : "Normal") << std::endl;
 }
 
@@ -0,0 +1,174 @@
+#include "SimulationRunner.h"
+#include "Tracing.h"
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+
+SimulationRunner::SimulationRunner(Simulation& simulation)
+    : simulation(simulation), running(false), failed(false), triggeredEvents(0),
+      checkpointPath("checkpoint.bin"), previewPending(false), completedPreviews(0), lastPreview{},
+      lastTickTime(0.0), tickInterval(0.0f) {
+}
+
+SimulationRunner::~SimulationRunner() {
+    stop();
+}
+
+void SimulationRunner::start() {
+    if (running.load(std::memory_order_acquire)) {
+        return;
+    }
+    // Le rendu dispose d'un état dès la première image
+    publish(true);
+    failed.store(false, std::memory_order_release);
+    running.store(true, std::memory_order_release);
+    thread = std::thread(&SimulationRunner::loop, this);
+}
+
+void SimulationRunner::stop() {
+    running.store(false, std::memory_order_release);
+    if (thread.joinable()) {
+        thread.join();
+    }
+}
+
+const FrameSnapshot& SimulationRunner::acquireSnapshot() {
+    snapshots.update();
+    return snapshots.readBuffer();
+}
+
+void SimulationRunner::loop() {
+    TRACE_THREAD_NAME("simulation");
+    using Clock = std::chrono::steady_clock;
+    const auto period = std::chrono::duration_cast<Clock::duration>(std::chrono::duration<float>(LOOP_PERIOD));
+    auto last = Clock::now();
+    int errorCount = 0;
+
+    while (running.load(std::memory_order_acquire)) {
+        auto cycleStart = Clock::now();
+        // Même limite que la boucle de rendu : pas de saut après une pause du processus
+        float deltaTime = std::min(0.1f, std::chrono::duration<float>(cycleStart - last).count());
+        last = cycleStart;
+
+        try {
+            runOnce(deltaTime);
+            errorCount = 0;
+        } catch (const std::exception& e) {
+            std::cout << "ERREUR dans le thread de simulation: " << e.what() << std::endl;
+            errorCount++;
+        } catch (...) {
+            std::cout << "ERREUR inconnue dans le thread de simulation" << std::endl;
+            errorCount++;
+        }
+        if (errorCount >= MAX_ERRORS) {
+            std::cout << "Trop d'erreurs dans le thread de simulation, arret." << std::endl;
+            failed.store(true, std::memory_order_release);
+            running.store(false, std::memory_order_release);
+            break;
+        }
+
+        std::this_thread::sleep_until(cycleStart + period);
+    }
+}
+
+void SimulationRunner::runOnce(float realDeltaTime) {
+    SimulationCommand command;
+    bool changed = false;
+    while (commands.pop(command)) {
+        apply(command);
+        changed = true;
+    }
+    if (previewPending && preview.isReady()) {
+        previewPending = false;
+        const WhatIfReport& report = preview.wait();
+        if (report.completed) {
+            lastPreview = report;
+            completedPreviews++;
+            changed = true;
+        }
+    }
+    int ticks = simulation.advance(realDeltaTime);
+    if (ticks > 0 || changed) {
+        publish(ticks > 0);
+    }
+}
+
+void SimulationRunner::apply(const SimulationCommand& command) {
+    switch (command.type) {
+        case CommandType::TOGGLE_PAUSE:
+            simulation.togglePause();
+            break;
+        case CommandType::SET_TIME_SCALE:
+            simulation.setTimeScale(command.value);
+            break;
+        case CommandType::TOGGLE_FAST_FORWARD:
+            simulation.toggleFastForward();
+            break;
+        case CommandType::SET_MODE:
+            simulation.setMode(static_cast<SimulationMode>(command.count));
+            break;
+        case CommandType::SET_TRAFFIC_MODEL:
+            simulation.setTrafficModel(static_cast<TrafficModel>(command.count));
+            break;
+        case CommandType::TRIGGER_EVENT:
+            simulation.triggerRandomEvent();
+            triggeredEvents++;
+            break;
+        case CommandType::SET_VEHICLE_COUNT:
+            simulation.setVehicleCount(command.count);
+            break;
+        case CommandType::SET_FOCUS_AREA:
+            simulation.setFocusArea(command.area[0], command.area[1], command.area[2], command.area[3]);
+            break;
+        case CommandType::SAVE_CHECKPOINT:
+            // Une seule sauvegarde à la fois : la précédente est attendue
+            simulation.waitForCheckpoint();
+            simulation.saveCheckpointInBackground(checkpointPath);
+            break;
+        case CommandType::LOAD_CHECKPOINT:
+            simulation.waitForCheckpoint();
+            simulation.loadCheckpoint(checkpointPath);
+            break;
+        case CommandType::PREVIEW_CLOSURE:
+            // Ignoré si un aperçu est déjà en cours
+            if (preview.start(simulation, IncidentSpec{EventType::ROAD_CLOSURE, command.count, 1.0f, command.value})) {
+                previewPending = true;
+            }
+            break;
+    }
+}
+
+void SimulationRunner::publish(bool ticked) {
+    FrameSnapshot& frame = snapshots.writeBuffer();
+    simulation.captureSnapshot(frame);
+    frame.triggeredEvents = triggeredEvents;
+    frame.completedPreviews = completedPreviews;
+    frame.previewRouteId = lastPreview.incident.routeId;
+    frame.previewDelay = lastPreview.delayPerTrip;
+    frame.previewLostTrips = lastPreview.lostTrips;
+
+    if (ticked) {
+        double now = snapshotClock();
+        tickInterval = lastTickTime > 0.0 ? std::min(MAX_TICK_INTERVAL, static_cast<float>(now - lastTickTime)) : 0.0f;
+        lastTickTime = now;
+        previousTick.swap(lastTick);
+        lastTick.assign(frame.vehicles.begin(), frame.vehicles.end());
+    }
+
+    // Position au tick précédent : fusion par identifiant (les deux listes sont triées) ;
+    // un véhicule apparu depuis garde sa position actuelle
+    size_t previous = 0;
+    for (VehicleSnapshot& vehicle : frame.vehicles) {
+        while (previous < previousTick.size() && previousTick[previous].id < vehicle.id) {
+            previous++;
+        }
+        if (previous < previousTick.size() && previousTick[previous].id == vehicle.id) {
+            vehicle.previousX = previousTick[previous].x;
+            vehicle.previousY = previousTick[previous].y;
+            vehicle.previousAngle = previousTick[previous].angle;
+        }
+    }
+    frame.tickTime = lastTickTime;
+    frame.tickInterval = tickInterval;
+    snapshots.publish();
+}
@@ -0,0 +1,122 @@
+#include "StatisticsEngine.h"
+
+namespace {
+
+DistributionSummary summarize(const Histogram& histogram, double unit) {
+    DistributionSummary summary;
+    summary.count = histogram.getCount();
+    summary.mean = histogram.getMean() * unit;
+    summary.p50 = histogram.percentile(0.50) * unit;
+    summary.p95 = histogram.percentile(0.95) * unit;
+    summary.p99 = histogram.percentile(0.99) * unit;
+    summary.max = histogram.getMax() * unit;
+    return summary;
+}
+
+} // namespace
+
+StatisticsEngine::StatisticsEngine()
+    : slots(1), routeCount(0), windowStart(0.0f) {
+}
+
+void StatisticsEngine::setSlotCount(unsigned int count) {
+    if (count == 0 || count == slots.size()) {
+        return;
+    }
+    Slot all = merged();
+    slots.assign(count, Slot());
+    for (Slot& slot : slots) {
+        slot.routeExits.assign(routeCount, 0);
+    }
+    slots[0] = std::move(all);
+}
+
+void StatisticsEngine::setRouteCount(size_t count) {
+    routeCount = count;
+    for (Slot& slot : slots) {
+        slot.routeExits.resize(routeCount, 0);
+    }
+}
+
+void StatisticsEngine::reset(float now) {
+    for (Slot& slot : slots) {
+        slot.travelTime.clear();
+        slot.delay.clear();
+        slot.rerouteLatency.clear();
+        slot.routeExits.assign(routeCount, 0);
+    }
+    windowStart = now;
+}
+
+float StatisticsEngine::getMeanTravelTime() const {
+    uint64_t count = 0;
+    uint64_t sum = 0;
+    for (const Slot& slot : slots) {
+        count += slot.travelTime.getCount();
+        sum += slot.travelTime.getSum();
+    }
+    return count > 0 ? static_cast<float>(static_cast<double>(sum) / count / 1000.0) : 0.0f;
+}
+
+uint64_t StatisticsEngine::getTripCount() const {
+    uint64_t count = 0;
+    for (const Slot& slot : slots) {
+        count += slot.travelTime.getCount();
+    }
+    return count;
+}
+
+StatisticsReport StatisticsEngine::report(float now) const {
+    Slot all = merged();
+    StatisticsReport result;
+    result.window = now - windowStart;
+    result.travelTime = summarize(all.travelTime, 1e-3);
+    result.delay = summarize(all.delay, 1e-3);
+    result.rerouteLatency = summarize(all.rerouteLatency, 1e-3);
+    result.routeExits = std::move(all.routeExits);
+    return result;
+}
+
+void StatisticsEngine::write(BinaryWriter& out) const {
+    Slot all = merged();
+    out.writeFloat(windowStart);
+    all.travelTime.write(out);
+    all.delay.write(out);
+    all.rerouteLatency.write(out);
+    out.writeVarint(all.routeExits.size());
+    for (uint64_t exits : all.routeExits) {
+        out.writeVarint(exits);
+    }
+}
+
+bool StatisticsEngine::read(BinaryReader& in) {
+    Slot all;
+    float savedStart = in.readFloat();
+    if (!all.travelTime.read(in) || !all.delay.read(in) || !all.rerouteLatency.read(in)) {
+        return false;
+    }
+    all.routeExits.resize(in.readCount());
+    for (uint64_t& exits : all.routeExits) {
+        exits = in.readVarint();
+    }
+    if (!in.ok() || all.routeExits.size() != routeCount) {
+        return false;
+    }
+    reset(savedStart);
+    slots[0] = std::move(all);
+    return true;
+}
+
+StatisticsEngine::Slot StatisticsEngine::merged() const {
+    Slot all;
+    all.routeExits.assign(routeCount, 0);
+    for (const Slot& slot : slots) {
+        all.travelTime.merge(slot.travelTime);
+        all.delay.merge(slot.delay);
+        all.rerouteLatency.merge(slot.rerouteLatency);
+        for (size_t i = 0; i < routeCount && i < slot.routeExits.size(); i++) {
+            all.routeExits[i] += slot.routeExits[i];
+        }
+    }
+    return all;
+}
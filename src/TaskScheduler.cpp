@@ -0,0 +1,228 @@
+#include "TaskScheduler.h"
+#include "Tracing.h"
+#include <algorithm>
+#include <exception>
+
+namespace {
+    // Thread courant : ordonnanceur auquel il appartient et index de sa file
+    thread_local const TaskScheduler* tlsScheduler = nullptr;
+    thread_local unsigned int tlsQueueIndex = 0;
+
+    // Première exception levée par un groupe de tâches
+    struct ErrorSlot {
+        std::mutex mutex;
+        std::exception_ptr error;
+
+        void capture() {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (!error) {
+                error = std::current_exception();
+            }
+        }
+
+        void rethrow() {
+            if (error) {
+                std::rethrow_exception(error);
+            }
+        }
+    };
+}
+
+int TaskGraph::addTask(const std::string& name, std::function<void()> work) {
+    tasks.push_back(Node{name, std::move(work), {}, 0});
+    return static_cast<int>(tasks.size()) - 1;
+}
+
+void TaskGraph::precede(int before, int after) {
+    tasks[before].successors.push_back(after);
+    tasks[after].dependencyCount++;
+}
+
+TaskScheduler::TaskScheduler(unsigned int threadCount)
+    : queuedTasks(0), stopping(false) {
+    if (threadCount == 0) {
+        threadCount = std::max(1u, std::thread::hardware_concurrency());
+    }
+    for (unsigned int i = 0; i < threadCount; i++) {
+        queues.push_back(std::make_unique<WorkerQueue>());
+    }
+    // Le thread appelant fait partie du pool (file 0)
+    for (unsigned int i = 1; i < threadCount; i++) {
+        workers.emplace_back(&TaskScheduler::workerLoop, this, i);
+    }
+}
+
+TaskScheduler::~TaskScheduler() {
+    {
+        std::lock_guard<std::mutex> lock(sleepMutex);
+        stopping = true;
+    }
+    sleepCondition.notify_all();
+    for (auto& worker : workers) {
+        worker.join();
+    }
+}
+
+unsigned int TaskScheduler::currentQueue() const {
+    return tlsScheduler == this ? tlsQueueIndex : 0;
+}
+
+void TaskScheduler::push(Task task) {
+    // Compté avant d'être visible : un voleur qui la prend aussitôt ne fait jamais passer
+    // le compteur sous zéro (il reboucle sinon à SIZE_MAX et réveille les workers en continu)
+    queuedTasks.fetch_add(1);
+    WorkerQueue& queue = *queues[currentQueue()];
+    {
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        queue.tasks.push_back(std::move(task));
+    }
+    // Prendre le verrou garantit qu'un worker en train de s'endormir voit la nouvelle tâche
+    { std::lock_guard<std::mutex> lock(sleepMutex); }
+    sleepCondition.notify_one();
+}
+
+bool TaskScheduler::tryPop(Task& task) {
+    unsigned int self = currentQueue();
+    {
+        WorkerQueue& own = *queues[self];
+        std::lock_guard<std::mutex> lock(own.mutex);
+        if (!own.tasks.empty()) {
+            task = std::move(own.tasks.back());
+            own.tasks.pop_back();
+            queuedTasks.fetch_sub(1);
+            return true;
+        }
+    }
+    // Vol : la tâche la plus ancienne (le plus gros morceau de travail restant) d'un autre thread
+    size_t count = queues.size();
+    for (size_t offset = 1; offset < count; offset++) {
+        WorkerQueue& victim = *queues[(self + offset) % count];
+        std::lock_guard<std::mutex> lock(victim.mutex);
+        if (!victim.tasks.empty()) {
+            task = std::move(victim.tasks.front());
+            victim.tasks.pop_front();
+            queuedTasks.fetch_sub(1);
+            return true;
+        }
+    }
+    return false;
+}
+
+void TaskScheduler::helpUntilZero(const std::atomic<size_t>& remaining) {
+    Task task;
+    int idle = 0;
+    while (remaining.load() > 0) {
+        if (tryPop(task)) {
+            task();
+            task = nullptr;
+            idle = 0;
+        } else if (++idle < SPIN_COUNT) {
+            std::this_thread::yield();
+        } else {
+            // Plus rien à prendre : endormi jusqu'à une nouvelle tâche ou la fin du groupe
+            // (un thread extérieur qui attend un long bloc ne monopolise pas un cœur)
+            std::unique_lock<std::mutex> lock(sleepMutex);
+            sleepCondition.wait(lock, [this, &remaining] { return remaining.load() == 0 || queuedTasks.load() > 0; });
+            idle = 0;
+        }
+    }
+}
+
+void TaskScheduler::finishTask(std::atomic<size_t>& remaining) {
+    if (remaining.fetch_sub(1) == 1) {
+        // Dernière tâche du groupe : réveille le thread qui l'attend s'il dort
+        { std::lock_guard<std::mutex> lock(sleepMutex); }
+        sleepCondition.notify_all();
+    }
+}
+
+void TaskScheduler::workerLoop(unsigned int index) {
+    tlsScheduler = this;
+    tlsQueueIndex = index;
+    TRACE_THREAD_NAME("worker " + std::to_string(index));
+    Task task;
+    while (true) {
+        if (tryPop(task)) {
+            task();
+            task = nullptr;
+            continue;
+        }
+        std::unique_lock<std::mutex> lock(sleepMutex);
+        sleepCondition.wait(lock, [this] { return stopping || queuedTasks.load() > 0; });
+        if (stopping) {
+            return;
+        }
+    }
+}
+
+void TaskScheduler::parallelFor(size_t count, size_t grain,
+                                const std::function<void(size_t, size_t)>& body) {
+    if (count == 0) {
+        return;
+    }
+    grain = std::max<size_t>(1, grain);
+    if (workers.empty() || count <= grain) {
+        body(0, count);
+        return;
+    }
+
+    size_t chunks = (count + grain - 1) / grain;
+    std::atomic<size_t> remaining(chunks);
+    ErrorSlot errors;
+
+    for (size_t chunk = 0; chunk < chunks; chunk++) {
+        size_t begin = chunk * grain;
+        size_t end = std::min(begin + grain, count);
+        push([this, &body, &remaining, &errors, begin, end] {
+            try {
+                body(begin, end);
+            } catch (...) {
+                errors.capture();
+            }
+            finishTask(remaining);
+        });
+    }
+
+    helpUntilZero(remaining);
+    errors.rethrow();
+}
+
+void TaskScheduler::run(const TaskGraph& graph) {
+    size_t count = graph.tasks.size();
+    if (count == 0) {
+        return;
+    }
+
+    std::unique_ptr<std::atomic<int>[]> pending(new std::atomic<int>[count]);
+    for (size_t i = 0; i < count; i++) {
+        pending[i].store(graph.tasks[i].dependencyCount);
+    }
+    std::atomic<size_t> remaining(count);
+    ErrorSlot errors;
+
+    // Exécute une tâche puis libère ses successeurs devenus prêts
+    std::function<void(int)> schedule = [&](int id) {
+        push([&, id] {
+            try {
+                graph.tasks[id].work();
+            } catch (...) {
+                errors.capture();
+            }
+            for (int successor : graph.tasks[id].successors) {
+                if (pending[successor].fetch_sub(1) == 1) {
+                    schedule(successor);
+                }
+            }
+            finishTask(remaining);
+        });
+    };
+
+    for (size_t i = 0; i < count; i++) {
+        if (graph.tasks[i].dependencyCount == 0) {
+            schedule(static_cast<int>(i));
+        }
+    }
+
+    helpUntilZero(remaining);
+    errors.rethrow();
+}
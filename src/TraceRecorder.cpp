@@ -0,0 +1,227 @@
+#include "TraceRecorder.h"
+#include "Simulation.h"
+#include "Vehicle.h"
+#include "Event.h"
+#include <chrono>
+#include <cmath>
+
+TraceRecorder::TraceRecorder()
+    : simulation(nullptr), observerId(-1), nextEventTraceId(0), tickCount(0),
+      bytesRecorded(0), finishing(false), writeFailed(false) {
+}
+
+TraceRecorder::~TraceRecorder() {
+    stop();
+}
+
+bool TraceRecorder::start(const std::string& path, Simulation& target) {
+    if (simulation) {
+        return false;
+    }
+    file.open(path, std::ios::binary | std::ios::trunc);
+    if (!file) {
+        return false;
+    }
+
+    trackedVehicles.clear();
+    trackedEvents.clear();
+    nextEventTraceId = 0;
+    tickCount = 0;
+    bytesRecorded = 0;
+    block.clear();
+    block.reserve(BLOCK_SIZE + BLOCK_SIZE / 4);
+
+    const Graph* graph = target.getGraph();
+    for (char c : TRACE_MAGIC) {
+        block.writeU8(static_cast<uint8_t>(c));
+    }
+    block.writeU32(TRACE_VERSION);
+    block.writeU64(graph->getFingerprint());
+    block.writeVarint(graph->getNodes().size());
+    block.writeVarint(graph->getRoutes().size());
+    block.writeU8(static_cast<uint8_t>(target.getTrafficModel()));
+    routeStates.assign(graph->getRoutes().size(), static_cast<uint8_t>(RouteState::NORMAL));
+
+    finishing.store(false, std::memory_order_release);
+    writeFailed.store(false, std::memory_order_release);
+    writer = std::thread(&TraceRecorder::writerLoop, this);
+
+    // Premier tick : l'état courant complet (différence avec un état vide)
+    record(target);
+    observerId = target.addTickObserver([this](const Simulation& current) { record(current); });
+    simulation = &target;
+    return true;
+}
+
+bool TraceRecorder::stop() {
+    if (!simulation) {
+        return true;
+    }
+    simulation->removeTickObserver(observerId);
+    simulation = nullptr;
+
+    block.writeU8(static_cast<uint8_t>(TraceTag::END));
+    flushBlock();
+    finishing.store(true, std::memory_order_release);
+    writer.join();
+
+    bool ok = !writeFailed.load(std::memory_order_acquire);
+    file.close();
+    return ok && !file.fail();
+}
+
+void TraceRecorder::record(const Simulation& current) {
+    block.writeU8(static_cast<uint8_t>(TraceTag::TICK));
+    block.writeFloat(current.getSimulationTime());
+    tickCount++;
+    current.refreshVehiclePositions();   // Progression écrite avec chaque nouveau chemin
+
+    // Véhicules : parcours simultané des deux listes triées par identifiant ;
+    // les écarts d'identifiants repartent de zéro à chaque tick
+    int lastId = 0;
+    size_t tracked = 0;
+    nextVehicles.clear();
+    for (const auto& vehicle : current.getVehicles()) {
+        if (vehicle->hasReachedDestination()) {
+            continue;
+        }
+        int id = vehicle->getId();
+        while (tracked < trackedVehicles.size() && trackedVehicles[tracked].id < id) {
+            block.writeU8(static_cast<uint8_t>(TraceTag::ARRIVE));
+            block.writeVarint(static_cast<uint64_t>(trackedVehicles[tracked].id - lastId));
+            lastId = trackedVehicles[tracked].id;
+            tracked++;
+        }
+        int edge = vehicle->getCurrentRouteIndex();
+        if (tracked < trackedVehicles.size() && trackedVehicles[tracked].id == id) {
+            const TrackedVehicle& previous = trackedVehicles[tracked];
+            if (previous.pathVersion != vehicle->getPathVersion() || previous.vehicle != vehicle.get()) {
+                writeVehicle(TraceTag::PATH, *vehicle, lastId);
+            } else if (previous.edge != edge) {
+                block.writeU8(static_cast<uint8_t>(TraceTag::EDGE));
+                block.writeVarint(static_cast<uint64_t>(id - lastId));
+                block.writeVarint(static_cast<uint64_t>(edge));
+                lastId = id;
+            }
+            tracked++;
+        } else {
+            writeVehicle(TraceTag::VEHICLE, *vehicle, lastId);
+        }
+        nextVehicles.push_back(TrackedVehicle{id, edge, vehicle->getPathVersion(), vehicle.get()});
+    }
+    for (; tracked < trackedVehicles.size(); tracked++) {
+        block.writeU8(static_cast<uint8_t>(TraceTag::ARRIVE));
+        block.writeVarint(static_cast<uint64_t>(trackedVehicles[tracked].id - lastId));
+        lastId = trackedVehicles[tracked].id;
+    }
+    trackedVehicles.swap(nextVehicles);
+
+    // Routes : seuls les changements d'état
+    const auto& routes = current.getGraph()->getRoutes();
+    int lastRoute = 0;
+    for (size_t i = 0; i < routes.size() && i < routeStates.size(); i++) {
+        uint8_t state = static_cast<uint8_t>(routes[i]->getState());
+        if (state != routeStates[i]) {
+            block.writeU8(static_cast<uint8_t>(TraceTag::ROUTE));
+            block.writeVarint(i - static_cast<size_t>(lastRoute));
+            block.writeU8(state);
+            lastRoute = static_cast<int>(i);
+            routeStates[i] = state;
+        }
+    }
+
+    // Événements : l'ordre de la liste est conservé (suppressions sur place, ajouts
+    // à la fin) ; un même objet est reconnu par son adresse, sa route et un temps
+    // écoulé qui ne décroît pas (une adresse libérée peut être réutilisée)
+    size_t event = 0;
+    nextEvents.clear();
+    for (const auto& entry : current.getEvents()) {
+        auto matches = [&entry](const TrackedEvent& known) {
+            return known.event == entry.get() && known.routeId == entry->getRouteId() &&
+                   entry->getElapsedTime() >= known.elapsedTime;
+        };
+        while (event < trackedEvents.size() && !matches(trackedEvents[event])) {
+            block.writeU8(static_cast<uint8_t>(TraceTag::EVENT_END));
+            block.writeVarint(static_cast<uint64_t>(trackedEvents[event].traceId));
+            event++;
+        }
+        int traceId;
+        if (event < trackedEvents.size()) {
+            traceId = trackedEvents[event].traceId;
+            event++;
+        } else {
+            traceId = nextEventTraceId++;
+            block.writeU8(static_cast<uint8_t>(TraceTag::EVENT_START));
+            block.writeVarint(static_cast<uint64_t>(entry->getId()));
+            block.writeU8(static_cast<uint8_t>(entry->getType()));
+            block.writeSigned(entry->getRouteId());
+            block.writeFloat(entry->getDuration());
+            block.writeFloat(entry->getElapsedTime());
+        }
+        nextEvents.push_back(TrackedEvent{entry.get(), traceId, entry->getRouteId(), entry->getElapsedTime()});
+    }
+    for (; event < trackedEvents.size(); event++) {
+        block.writeU8(static_cast<uint8_t>(TraceTag::EVENT_END));
+        block.writeVarint(static_cast<uint64_t>(trackedEvents[event].traceId));
+    }
+    trackedEvents.swap(nextEvents);
+
+    if (block.size() >= BLOCK_SIZE) {
+        flushBlock();
+    }
+}
+
+void TraceRecorder::writeVehicle(TraceTag tag, const Vehicle& vehicle, int& lastId) {
+    block.writeU8(static_cast<uint8_t>(tag));
+    block.writeVarint(static_cast<uint64_t>(vehicle.getId() - lastId));
+    lastId = vehicle.getId();
+    if (tag == TraceTag::VEHICLE) {
+        block.writeU8(static_cast<uint8_t>(vehicle.getVehicleType()));
+    }
+    block.writeVarint(static_cast<uint64_t>(vehicle.getCurrentRouteIndex()));
+    block.writeVarint(static_cast<uint64_t>(std::lround(vehicle.getProgress() * PROGRESS_SCALE)));
+
+    // Chemin : premier nœud puis écarts entre nœuds successifs (voisins proches en général)
+    const std::vector<int>& path = vehicle.getPath();
+    block.writeVarint(path.size());
+    int previous = 0;
+    for (int node : path) {
+        block.writeSigned(node - previous);
+        previous = node;
+    }
+}
+
+void TraceRecorder::flushBlock() {
+    if (block.size() == 0) {
+        return;
+    }
+    bytesRecorded += block.size();
+    std::vector<unsigned char> data = block.take();
+    // File pleine : le thread d'écriture a pris du retard, la simulation l'attend
+    while (!blocks.push(std::move(data))) {
+        std::this_thread::yield();
+    }
+    block.reserve(BLOCK_SIZE + BLOCK_SIZE / 4);
+}
+
+void TraceRecorder::writerLoop() {
+    std::vector<unsigned char> data;
+    for (;;) {
+        // Lu avant de vider la file : tout bloc transmis avant la fin est écrit
+        bool done = finishing.load(std::memory_order_acquire);
+        while (blocks.pop(data)) {
+            file.write(reinterpret_cast<const char*>(data.data()), static_cast<std::streamsize>(data.size()));
+            if (!file) {
+                writeFailed.store(true, std::memory_order_release);
+            }
+        }
+        if (done) {
+            break;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    }
+    file.flush();
+    if (!file) {
+        writeFailed.store(true, std::memory_order_release);
+    }
+}
@@ -0,0 +1,320 @@
+#include "TraceReplayer.h"
+#include "TraceRecorder.h"
+#include "Simulation.h"
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <iterator>
+#include <limits>
+#include <unordered_map>
+
+namespace {
+const float OPEN_END = std::numeric_limits<float>::infinity();
+}
+
+TraceReplayer::TraceReplayer(const Graph& graph)
+    : graph(graph), trafficModel(TrafficModel::CONTINUOUS), complete(false) {
+}
+
+bool TraceReplayer::open(const std::string& path) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file) {
+        return false;
+    }
+    std::vector<unsigned char> data((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    BinaryReader in(data.data(), data.size());
+
+    for (char c : TraceRecorder::TRACE_MAGIC) {
+        if (in.readU8() != static_cast<uint8_t>(c)) {
+            return false;
+        }
+    }
+    if (in.readU32() != TraceRecorder::TRACE_VERSION || in.readU64() != graph.getFingerprint() ||
+        in.readVarint() != graph.getNodes().size() || in.readVarint() != graph.getRoutes().size()) {
+        return false;
+    }
+    uint8_t model = in.readU8();
+    if (!in.ok()) {
+        return false;
+    }
+
+    tickTimes.clear();
+    tracks.clear();
+    events.clear();
+    rerouteTimes.clear();
+    routeHistory.assign(graph.getRoutes().size(), {});
+    trafficModel = static_cast<TrafficModel>(model);
+    complete = parse(in);
+    return true;
+}
+
+bool TraceReplayer::parse(BinaryReader& in) {
+    // Véhicules en circulation : parcours, chemin actuel et tronçon en cours
+    struct LiveVehicle {
+        size_t track;
+        std::vector<int> path;
+        bool onLeg;
+    };
+    std::unordered_map<int, LiveVehicle> live;
+    auto readPath = [&in](std::vector<int>& path) {
+        path.resize(in.readCount());
+        int previous = 0;
+        for (int& node : path) {
+            node = previous + static_cast<int>(in.readSigned());
+            previous = node;
+        }
+    };
+    auto readProgress = [&in]() {
+        return std::min(1.0f, static_cast<float>(in.readVarint()) / TraceRecorder::PROGRESS_SCALE);
+    };
+    auto closeLeg = [&](LiveVehicle& vehicle, float time, float progress) {
+        if (vehicle.onLeg) {
+            TraceLeg& leg = tracks[vehicle.track].legs.back();
+            leg.endTime = time;
+            leg.endProgress = progress;
+            vehicle.onLeg = false;
+        }
+    };
+    auto openLeg = [&](LiveVehicle& vehicle, int edge, float time, float progress) {
+        if (edge >= 0 && static_cast<size_t>(edge) + 1 < vehicle.path.size()) {
+            tracks[vehicle.track].legs.push_back(makeLeg(vehicle.path, edge, time, progress));
+            vehicle.onLeg = true;
+        }
+    };
+
+    float now = 0.0f;
+    int lastId = 0;
+    size_t lastRoute = 0;
+    std::vector<int> path;
+    bool failed = false;
+    bool ended = false;
+    while (!failed && in.ok() && !in.atEnd()) {
+        TraceTag tag = static_cast<TraceTag>(in.readU8());
+        if (tag == TraceTag::END) {
+            ended = true;
+            break;
+        }
+        if (tag == TraceTag::TICK) {
+            now = in.readFloat();
+            if (!in.ok()) {
+                break;
+            }
+            tickTimes.push_back(now);
+            lastId = 0;
+            lastRoute = 0;
+            continue;
+        }
+        if (tickTimes.empty()) {
+            break;
+        }
+
+        switch (tag) {
+            case TraceTag::VEHICLE: {
+                int id = lastId + static_cast<int>(in.readVarint());
+                int type = in.readU8();
+                int edge = static_cast<int>(in.readVarint());
+                float progress = readProgress();
+                readPath(path);
+                if (!in.ok()) {
+                    break;
+                }
+                lastId = id;
+                LiveVehicle& vehicle = live[id];
+                vehicle.track = tracks.size();
+                vehicle.path = path;
+                vehicle.onLeg = false;
+                tracks.push_back(VehicleTrack{id, type, now, OPEN_END, false, 0, {}});
+                openLeg(vehicle, edge, now, progress);
+                break;
+            }
+            case TraceTag::EDGE: {
+                int id = lastId + static_cast<int>(in.readVarint());
+                int edge = static_cast<int>(in.readVarint());
+                auto it = live.find(id);
+                if (!in.ok() || it == live.end()) {
+                    failed = true;
+                    break;
+                }
+                lastId = id;
+                closeLeg(it->second, now, 1.0f);
+                openLeg(it->second, edge, now, 0.0f);
+                break;
+            }
+            case TraceTag::PATH: {
+                int id = lastId + static_cast<int>(in.readVarint());
+                int edge = static_cast<int>(in.readVarint());
+                float progress = readProgress();
+                readPath(path);
+                auto it = live.find(id);
+                if (!in.ok() || it == live.end()) {
+                    failed = true;
+                    break;
+                }
+                lastId = id;
+                LiveVehicle& vehicle = it->second;
+                if (vehicle.onLeg) {
+                    // Fin du tronçon : même arête poursuivie, arête terminée, ou arrêt sur place
+                    const TraceLeg& leg = tracks[vehicle.track].legs.back();
+                    bool sameEdge = edge >= 0 && static_cast<size_t>(edge) + 1 < path.size() &&
+                                    path[edge] == leg.fromNode && path[edge + 1] == leg.toNode;
+                    bool edgeDone = edge >= 0 && static_cast<size_t>(edge) < path.size() && path[edge] == leg.toNode;
+                    closeLeg(vehicle, now, sameEdge ? progress : (edgeDone ? 1.0f : leg.startProgress));
+                }
+                vehicle.path = path;
+                openLeg(vehicle, edge, now, progress);
+                tracks[vehicle.track].reroutings++;
+                rerouteTimes.push_back(now);
+                break;
+            }
+            case TraceTag::ARRIVE: {
+                int id = lastId + static_cast<int>(in.readVarint());
+                auto it = live.find(id);
+                if (!in.ok() || it == live.end()) {
+                    failed = true;
+                    break;
+                }
+                lastId = id;
+                closeLeg(it->second, now, 1.0f);
+                VehicleTrack& track = tracks[it->second.track];
+                track.endTime = now;
+                track.arrived = true;
+                live.erase(it);
+                break;
+            }
+            case TraceTag::ROUTE: {
+                size_t route = lastRoute + static_cast<size_t>(in.readVarint());
+                uint8_t state = in.readU8();
+                if (!in.ok() || route >= routeHistory.size()) {
+                    failed = true;
+                    break;
+                }
+                lastRoute = route;
+                routeHistory[route].emplace_back(now, static_cast<RouteState>(state));
+                break;
+            }
+            case TraceTag::EVENT_START: {
+                TraceEvent event;
+                event.id = static_cast<int>(in.readVarint());
+                event.type = static_cast<EventType>(in.readU8());
+                event.routeId = static_cast<int>(in.readSigned());
+                event.duration = in.readFloat();
+                event.startElapsed = in.readFloat();
+                event.startTime = now;
+                event.endTime = OPEN_END;
+                if (in.ok()) {
+                    events.push_back(event);
+                }
+                break;
+            }
+            case TraceTag::EVENT_END: {
+                uint64_t traceId = in.readVarint();
+                if (!in.ok() || traceId >= events.size()) {
+                    failed = true;
+                    break;
+                }
+                events[traceId].endTime = now;
+                break;
+            }
+            default:
+                failed = true;
+                break;
+        }
+    }
+
+    // Tronçons en cours en fin de trace : fin estimée à la vitesse de base de la route
+    for (auto& entry : live) {
+        if (entry.second.onLeg) {
+            closeOpenLeg(tracks[entry.second.track].legs.back());
+        }
+    }
+    return ended && in.ok();
+}
+
+TraceLeg TraceReplayer::makeLeg(const std::vector<int>& path, int edge, float time, float progress) const {
+    int fromNode = path[edge];
+    int toNode = path[edge + 1];
+    return TraceLeg{fromNode, toNode, graph.findRouteIndex(fromNode, toNode), time, OPEN_END, progress, progress};
+}
+
+void TraceReplayer::closeOpenLeg(TraceLeg& leg) const {
+    const Route* route = leg.route >= 0 ? graph.getRoutes()[leg.route].get() : nullptr;
+    if (!route || route->getLength() <= 0.0f || route->getBaseSpeed() <= 0.0f) {
+        leg.endTime = leg.startTime;
+        return;
+    }
+    // Même conversion que Vehicle::update (km/h -> m/s)
+    leg.endTime = leg.startTime + (1.0f - leg.startProgress) * route->getLength() / (route->getBaseSpeed() / 3.6f);
+    leg.endProgress = 1.0f;
+}
+
+RouteState TraceReplayer::getRouteState(size_t route, float time) const {
+    if (route >= routeHistory.size()) {
+        return RouteState::NORMAL;
+    }
+    const auto& history = routeHistory[route];
+    auto it = std::upper_bound(history.begin(), history.end(), time,
+        [](float value, const std::pair<float, RouteState>& change) { return value < change.first; });
+    return it == history.begin() ? RouteState::NORMAL : std::prev(it)->second;
+}
+
+void TraceReplayer::frameAt(float time, FrameSnapshot& frame) const {
+    time = std::max(getStartTime(), std::min(getEndTime(), time));
+    const float pi = 3.14159265359f;
+
+    // Parcours dans l'ordre d'apparition : aucun au-delà du premier apparu après time
+    frame.vehicles.clear();
+    for (const VehicleTrack& track : tracks) {
+        if (track.startTime > time) {
+            break;
+        }
+        if (time >= track.endTime || track.legs.empty()) {
+            continue;
+        }
+        auto leg = std::upper_bound(track.legs.begin(), track.legs.end(), time,
+            [](float value, const TraceLeg& candidate) { return value < candidate.startTime; });
+        if (leg == track.legs.begin()) {
+            continue;
+        }
+        --leg;
+        float progress = leg->endProgress;
+        if (time < leg->endTime && leg->endTime > leg->startTime) {
+            float alpha = (time - leg->startTime) / (leg->endTime - leg->startTime);
+            progress = leg->startProgress + (leg->endProgress - leg->startProgress) * alpha;
+        }
+        const Node* from = graph.getNode(leg->fromNode);
+        const Node* to = graph.getNode(leg->toNode);
+        if (!from || !to) {
+            continue;
+        }
+        float x = from->x + (to->x - from->x) * progress;
+        float y = from->y + (to->y - from->y) * progress;
+        float angle = std::atan2(to->y - from->y, to->x - from->x);
+        if (angle < 0.0f) {
+            angle += 2.0f * pi;
+        }
+        frame.vehicles.push_back(VehicleSnapshot{track.id, track.type, x, y, angle, x, y, angle});
+    }
+
+    frame.routeStates.resize(graph.getRoutes().size());
+    for (size_t i = 0; i < frame.routeStates.size(); i++) {
+        frame.routeStates[i] = getRouteState(i, time);
+    }
+
+    frame.events.clear();
+    for (const TraceEvent& event : events) {
+        if (event.startTime <= time && time < event.endTime) {
+            frame.events.push_back(EventSnapshot{event.id, event.type, event.routeId, event.duration,
+                                                 event.startElapsed + (time - event.startTime), true});
+        }
+    }
+
+    frame.vehicleCount = frame.vehicles.size();
+    frame.simulationTime = time;
+    frame.totalReroutings = static_cast<int>(
+        std::upper_bound(rerouteTimes.begin(), rerouteTimes.end(), time) - rerouteTimes.begin());
+    frame.trafficModel = trafficModel;
+    frame.paused = false;
+    frame.fastForward = false;
+    frame.tickTime = 0.0;
+    frame.tickInterval = 0.0f;
+}
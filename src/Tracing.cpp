@@ -0,0 +1,136 @@
+#include "Tracing.h"
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+
+std::mutex Tracer::registryMutex;
+std::vector<std::unique_ptr<Tracer::ThreadBuffer>> Tracer::buffers;
+
+namespace {
+
+void writeJsonString(std::ostream& out, const std::string& text) {
+    out << '"';
+    for (char c : text) {
+        if (c == '"' || c == '\\') {
+            out << '\\' << c;
+        } else if (static_cast<unsigned char>(c) < 0x20) {
+            out << ' ';
+        } else {
+            out << c;
+        }
+    }
+    out << '"';
+}
+
+} // namespace
+
+Tracer::TraceBlock* Tracer::ThreadBuffer::grow() {
+    if (blockCount == MAX_BLOCKS) {
+        dropped.fetch_add(1, std::memory_order_relaxed);
+        return nullptr;
+    }
+    TraceBlock* block = new TraceBlock();
+    tail->next.store(block, std::memory_order_release);
+    tail = block;
+    blockCount++;
+    return block;
+}
+
+Tracer::ThreadBuffer::~ThreadBuffer() {
+    // Les blocs suivants ne sont chaînés que par des pointeurs nus
+    TraceBlock* block = head->next.load(std::memory_order_relaxed);
+    while (block) {
+        TraceBlock* next = block->next.load(std::memory_order_relaxed);
+        delete block;
+        block = next;
+    }
+}
+
+Tracer::ThreadBuffer* Tracer::registerThread() {
+    std::unique_ptr<ThreadBuffer> buffer(new ThreadBuffer());
+    buffer->head.reset(new TraceBlock());
+    buffer->tail = buffer->head.get();
+    buffer->blockCount = 1;
+
+    std::lock_guard<std::mutex> lock(registryMutex);
+    buffer->threadId = static_cast<int>(buffers.size()) + 1;
+    buffer->name = "thread " + std::to_string(buffer->threadId);
+    buffers.push_back(std::move(buffer));
+    return buffers.back().get();
+}
+
+void Tracer::setThreadName(const std::string& name) {
+    ThreadBuffer* buffer = currentBuffer();
+    std::lock_guard<std::mutex> lock(registryMutex);
+    buffer->name = name;
+}
+
+uint64_t Tracer::getEventCount() {
+    std::lock_guard<std::mutex> lock(registryMutex);
+    uint64_t total = 0;
+    for (const auto& buffer : buffers) {
+        for (const TraceBlock* block = buffer->head.get(); block;
+             block = block->next.load(std::memory_order_acquire)) {
+            total += block->count.load(std::memory_order_acquire);
+        }
+    }
+    return total;
+}
+
+uint64_t Tracer::getDroppedCount() {
+    std::lock_guard<std::mutex> lock(registryMutex);
+    uint64_t total = 0;
+    for (const auto& buffer : buffers) {
+        total += buffer->dropped.load(std::memory_order_relaxed);
+    }
+    return total;
+}
+
+bool Tracer::writeChromeTrace(const std::string& path) {
+    std::ofstream file(path);
+    if (!file) {
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(registryMutex);
+
+    // Origine des temps : la première zone enregistrée
+    uint64_t origin = UINT64_MAX;
+    for (const auto& buffer : buffers) {
+        for (const TraceBlock* block = buffer->head.get(); block;
+             block = block->next.load(std::memory_order_acquire)) {
+            size_t count = block->count.load(std::memory_order_acquire);
+            for (size_t i = 0; i < count; i++) {
+                origin = std::min(origin, block->events[i].start);
+            }
+        }
+    }
+
+    // ts et dur en microsecondes (format « Trace Event » de Chrome)
+    file << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+    file << std::fixed << std::setprecision(3);
+    bool first = true;
+    for (const auto& buffer : buffers) {
+        file << (first ? "\n" : ",\n");
+        first = false;
+        file << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << buffer->threadId
+             << ",\"args\":{\"name\":";
+        writeJsonString(file, buffer->name);
+        file << "}}";
+
+        for (const TraceBlock* block = buffer->head.get(); block;
+             block = block->next.load(std::memory_order_acquire)) {
+            size_t count = block->count.load(std::memory_order_acquire);
+            for (size_t i = 0; i < count; i++) {
+                const TraceEvent& event = block->events[i];
+                file << ",\n{\"name\":";
+                writeJsonString(file, event.name);
+                file << ",\"ph\":\"X\",\"pid\":1,\"tid\":" << buffer->threadId
+                     << ",\"ts\":" << (event.start - origin) / 1000.0
+                     << ",\"dur\":" << event.duration / 1000.0 << "}";
+            }
+        }
+    }
+    file << "\n]}\n";
+    return static_cast<bool>(file);
+}
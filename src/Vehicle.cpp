@@ -9,8 +9,8 @@
 
 Vehicle::Vehicle(int id, int startNode, int targetNode)
     : id(id), currentNode(startNode), targetNode(targetNode),
-      currentRouteIndex(0), progress(0.0f), speed(50.0f),
-      needsRerouting(false), x(0.0f), y(0.0f), angle(0.0f),
+      pathVersion(0), currentRouteIndex(0), progress(0.0f), speed(50.0f),
+      needsRerouting(false), departureTime(0.0f), freeFlowTime(0.0f), x(0.0f), y(0.0f), angle(0.0f),
       vehicleType(id % 3) { // 3 types de véhicules différents (0=voiture, 1=camion, 2=bus)
     // Initialiser la position au nœud de départ
     // (sera calculée dans calculatePosition)
@@ -18,11 +18,60 @@ Vehicle::Vehicle(int id, int startNode, int targetNode)
 
 void Vehicle::setPath(const std::vector<int>& newPath) {
     path = newPath;
+    pathRoutes.clear();
+    routeSlots.clear();
+    pathVersion++;
     currentRouteIndex = 0;
     progress = 0.0f;
     needsRerouting = false;
 }
 
+void Vehicle::setPath(const std::vector<int>& newPath, const Graph& graph) {
+    setPath(newPath);
+    resolvePathRoutes(graph);
+}
+
+void Vehicle::resolvePathRoutes(const Graph& graph) {
+    pathRoutes.clear();
+    if (path.size() < 2) {
+        return;
+    }
+    pathRoutes.reserve(path.size() - 1);
+    for (size_t i = 0; i + 1 < path.size(); i++) {
+        pathRoutes.push_back(graph.findRouteIndex(path[i], path[i + 1]));
+    }
+    routeSlots.assign(pathRoutes.size(), 0);
+}
+
+void Vehicle::setProgress(float value) {
+    progress = std::isfinite(value) ? std::max(0.0f, std::min(1.0f, value)) : 0.0f;
+}
+
+void Vehicle::restoreState(int node, int edge, float edgeProgress, bool rerouting) {
+    currentNode = node;
+    currentRouteIndex = std::max(0, edge);
+    setProgress(edgeProgress);
+    needsRerouting = rerouting;
+}
+
+void Vehicle::restorePosition(float savedX, float savedY, float savedAngle) {
+    x = savedX;
+    y = savedY;
+    angle = savedAngle;
+}
+
+void Vehicle::advanceToNextRoute() {
+    if (currentRouteIndex >= static_cast<int>(path.size()) - 1) {
+        return;
+    }
+    progress = 0.0f;
+    currentRouteIndex++;
+    currentNode = path[currentRouteIndex];
+    if (currentRouteIndex >= static_cast<int>(path.size()) - 1) {
+        currentNode = targetNode;
+    }
+}
+
 void Vehicle::update(float deltaTime, const Graph& graph) {
     // Toujours calculer la position même si en pause (pour le rendu)
     calculatePosition(graph);
@@ -37,47 +86,18 @@ void Vehicle::update(float deltaTime, const Graph& graph) {
         return;
     }
     
-    // Vérifier si une route future dans le chemin est bloquée ou accidentée
-    // Cela permet de détecter les accidents avant d'y arriver
-    for (size_t i = currentRouteIndex; i < path.size() - 1; i++) {
-        int fromNode = path[i];
-        int toNode = path[i + 1];
-        
-        Route* route = nullptr;
-        for (const auto& r : graph.getRoutes()) {
-            if ((r->getFromNode() == fromNode && r->getToNode() == toNode) ||
-                (r->getFromNode() == toNode && r->getToNode() == fromNode)) {
-                route = r.get();
-                break;
-            }
-        }
-        
-        if (route && (route->getState() == RouteState::BLOCKED || 
-                      route->getState() == RouteState::ACCIDENT ||
-                      !route->isUsable())) {
-            // Route bloquée ou accidentée dans le chemin - demander reroutage
-            needsRerouting = true;
-            // Si c'est la route actuelle, arrêter immédiatement
-            if (i == static_cast<size_t>(currentRouteIndex)) {
-                return; // Arrêter le véhicule
-            }
-            // Sinon, continuer vers la route bloquée mais demander reroutage
-            break;
-        }
+    if (pathRoutes.size() + 1 != path.size()) {
+        resolvePathRoutes(graph);
     }
+    const auto& routes = graph.getRoutes();
     
-    int fromNode = path[currentRouteIndex];
+    // Les routes futures bloquées sont signalées par la simulation via le flux
+    // de changements du graphe (requestRerouting) : seule la route actuelle est vérifiée ici
     int toNode = path[currentRouteIndex + 1];
     
-    // Trouver la route entre ces deux nœuds
-    Route* currentRoute = nullptr;
-    for (const auto& route : graph.getRoutes()) {
-        if ((route->getFromNode() == fromNode && route->getToNode() == toNode) ||
-            (route->getFromNode() == toNode && route->getToNode() == fromNode)) {
-            currentRoute = route.get();
-            break;
-        }
-    }
+    // Route entre ces deux nœuds (résolue dans pathRoutes)
+    int currentRouteIdx = pathRoutes[currentRouteIndex];
+    const Route* currentRoute = currentRouteIdx >= 0 ? routes[currentRouteIdx].get() : nullptr;
     
     if (!currentRoute) {
         // Route non trouvée - essayer de passer à la suivante
@@ -148,7 +168,7 @@ void Vehicle::update(float deltaTime, const Graph& graph) {
 
 void Vehicle::calculatePosition(const Graph& graph) {
     if (path.empty() || currentRouteIndex >= static_cast<int>(path.size()) - 1) {
-        Node* node = graph.getNode(currentNode);
+        const Node* node = graph.getNode(currentNode);
         if (node) {
             x = node->x;
             y = node->y;
@@ -159,8 +179,8 @@ void Vehicle::calculatePosition(const Graph& graph) {
     int fromNodeId = path[currentRouteIndex];
     int toNodeId = path[currentRouteIndex + 1];
     
-    Node* fromNode = graph.getNode(fromNodeId);
-    Node* toNode = graph.getNode(toNodeId);
+    const Node* fromNode = graph.getNode(fromNodeId);
+    const Node* toNode = graph.getNode(toNodeId);
     
     if (fromNode && toNode) {
         // Vérifier que les coordonnées sont valides
@@ -171,26 +191,11 @@ void Vehicle::calculatePosition(const Graph& graph) {
             x = fromNode->x + (toNode->x - fromNode->x) * progress;
             y = fromNode->y + (toNode->y - fromNode->y) * progress;
             
-            // Calculer l'angle de direction avec lissage pour rotation fluide
+            // Direction de la route ; la rotation fluide est assurée par le rendu,
+            // qui interpole entre deux ticks (indépendamment de la fréquence d'images)
             float dx = toNode->x - fromNode->x;
             float dy = toNode->y - fromNode->y;
-            float targetAngle = std::atan2(dy, dx);
-            
-            // Lissage de la rotation pour éviter les changements brusques
-            float angleDiff = targetAngle - angle;
-            // Normaliser l'angle entre -PI et PI
-            while (angleDiff > PI) angleDiff -= 2.0f * PI;
-            while (angleDiff < -PI) angleDiff += 2.0f * PI;
-            
-            // Interpolation angulaire pour rotation fluide
-            float rotationSpeed = 3.0f; // Vitesse de rotation (rad/s)
-            float maxRotation = rotationSpeed * 0.016f; // Limite par frame (60 FPS)
-            
-            if (std::abs(angleDiff) > maxRotation) {
-                angle += (angleDiff > 0 ? maxRotation : -maxRotation);
-            } else {
-                angle = targetAngle;
-            }
+            angle = std::atan2(dy, dx);
             
             // Normaliser l'angle entre 0 et 2*PI
             while (angle < 0) angle += 2.0f * PI;
@@ -205,7 +210,7 @@ void Vehicle::calculatePosition(const Graph& graph) {
             }
         } else {
             // Utiliser la position du nœud actuel
-            Node* currentNode = graph.getNode(this->currentNode);
+            const Node* currentNode = graph.getNode(this->currentNode);
             if (currentNode) {
                 x = currentNode->x;
                 y = currentNode->y;
@@ -0,0 +1,99 @@
+#include "WhatIfPreview.h"
+#include "Simulation.h"
+#include "TaskScheduler.h"
+#include <chrono>
+#include <cmath>
+#include <iostream>
+
+WhatIfPreview::WhatIfPreview() : done(false), cancelled(false), report{} {
+}
+
+WhatIfPreview::~WhatIfPreview() {
+    cancel();
+    wait();
+}
+
+bool WhatIfPreview::start(const Simulation& simulation, const IncidentSpec& spec, float horizon) {
+    if (isRunning()) {
+        return false;
+    }
+    wait();
+
+    auto setupStart = std::chrono::steady_clock::now();
+    report = WhatIfReport{};
+    report.incident = spec;
+    report.horizon = horizon;
+    baseline = simulation.fork();
+    incident = simulation.fork();
+    if (!baseline || !incident) {
+        std::cout << "ERREUR: copie de la simulation impossible, apercu annule" << std::endl;
+        baseline.reset();
+        incident.reset();
+        return false;
+    }
+    // Pas de nouvel événement aléatoire : seul l'incident distingue les deux copies
+    baseline->setEventCount(0);
+    incident->setEventCount(0);
+    incident->addEvent(spec.type, spec.routeId, spec.severity, spec.duration);
+    report.setupTime = std::chrono::duration<double>(std::chrono::steady_clock::now() - setupStart).count();
+
+    done.store(false, std::memory_order_release);
+    cancelled.store(false, std::memory_order_release);
+    worker = std::thread(&WhatIfPreview::run, this);
+    return true;
+}
+
+const WhatIfReport& WhatIfPreview::wait() {
+    if (worker.joinable()) {
+        worker.join();
+    }
+    return report;
+}
+
+void WhatIfPreview::cancel() {
+    cancelled.store(true, std::memory_order_release);
+}
+
+void WhatIfPreview::run() {
+    auto runStart = std::chrono::steady_clock::now();
+    Simulation* copies[2] = {baseline.get(), incident.get()};
+    TripIndicators indicators[2] = {};
+    bool completed = true;
+
+    try {
+        // Copies indépendantes : une par thread (le thread de travail et un second)
+        TaskScheduler pool(2);
+        pool.parallelFor(2, 1, [&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; i++) {
+                Simulation& simulation = *copies[i];
+                float startTime = simulation.getSimulationTime();
+                KpiCollector collector;
+                collector.start(simulation);
+                simulation.addTickObserver([&collector](const Simulation& current) { collector.observe(current); });
+                float step = simulation.getFixedTimeStep();
+                int steps = static_cast<int>(std::ceil(report.horizon / step - 1e-3f));
+                for (int tick = 0; tick < steps && !cancelled.load(std::memory_order_relaxed); tick++) {
+                    simulation.update(step);
+                }
+                indicators[i] = collector.getIndicators(simulation.getSimulationTime() - startTime);
+            }
+        });
+    } catch (const std::exception& e) {
+        std::cout << "ERREUR pendant l'apercu: " << e.what() << std::endl;
+        completed = false;
+    }
+
+    report.baseline = indicators[0];
+    report.withIncident = indicators[1];
+    report.baselineReroutings = baseline->getTotalReroutings();
+    report.incidentReroutings = incident->getTotalReroutings();
+    report.delayPerTrip = indicators[1].meanTravelTime - indicators[0].meanTravelTime;
+    report.lostTrips = indicators[0].completedTrips - indicators[1].completedTrips;
+    report.runTime = std::chrono::duration<double>(std::chrono::steady_clock::now() - runStart).count();
+    report.completed = completed && !cancelled.load(std::memory_order_acquire);
+
+    // Les copies ne servent plus : libérées ici plutôt qu'au prochain start
+    baseline.reset();
+    incident.reset();
+    done.store(true, std::memory_order_release);
+}
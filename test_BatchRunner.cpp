@@ -0,0 +1,79 @@
+#include "../include/BatchRunner.h"
+#include "TestCheck.h"
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <string>
+
+void testExpandGrid() {
+    ScenarioGrid grid;
+    grid.vehicleCounts = {50, 100};
+    grid.eventIntervals = {20.0f};
+    grid.modes = {SimulationMode::NORMAL, SimulationMode::DYNAMIC};
+    grid.strategies = {PathfindingAlgorithm::ASTAR};
+    grid.seeds = {1, 2, 3};
+    
+    std::vector<ScenarioParameters> scenarios = BatchRunner::expandGrid(grid);
+    CHECK(scenarios.size() == 12);
+    // Les graines varient le plus vite
+    CHECK(scenarios[0].seed == 1 && scenarios[1].seed == 2 && scenarios[3].seed == 1);
+    CHECK(scenarios[0].mode == SimulationMode::NORMAL && scenarios[3].mode == SimulationMode::DYNAMIC);
+    CHECK(scenarios[6].vehicleCount == 100);
+    
+    std::cout << "Test grille de parametres: OK" << std::endl;
+}
+
+void testBatchRun() {
+    ScenarioGrid grid;
+    grid.vehicleCounts = {80};
+    grid.eventIntervals = {5.0f};
+    grid.modes = {SimulationMode::NORMAL, SimulationMode::DYNAMIC};
+    grid.strategies = {PathfindingAlgorithm::ASTAR, PathfindingAlgorithm::DIJKSTRA};
+    grid.seeds = {1, 2};
+    std::vector<ScenarioParameters> scenarios = BatchRunner::expandGrid(grid);
+    
+    BatchRunner runner;
+    runner.setDuration(60.0f);
+    runner.setThreadCount(3);
+    const std::vector<ScenarioResult>& results = runner.run(scenarios);
+    CHECK(results.size() == scenarios.size());
+    for (size_t i = 0; i < results.size(); i++) {
+        CHECK(results[i].parameters.seed == scenarios[i].seed);
+        CHECK(results[i].completedTrips > 0);
+        CHECK(results[i].meanTravelTime > 0.0f && results[i].meanTravelTime <= results[i].maxTravelTime);
+        CHECK(results[i].meanActiveVehicles > 0.0f);
+        // Pas de reroutage en mode normal
+        CHECK(scenarios[i].mode == SimulationMode::DYNAMIC || results[i].reroutings == 0);
+    }
+    
+    // Résultat indépendant du parallélisme : même scénario exécuté seul
+    ScenarioResult single = runner.runScenario(scenarios[5]);
+    CHECK(single.completedTrips == results[5].completedTrips);
+    CHECK(single.meanTravelTime == results[5].meanTravelTime);
+    CHECK(single.reroutings == results[5].reroutings);
+    
+    // Fichier agrégé : en-tête puis une ligne par combinaison (graines regroupées)
+    const std::string path = "test_batch_results.csv";
+    CHECK(runner.writeResults(path));
+    std::ifstream file(path);
+    std::string line;
+    int lines = 0;
+    while (std::getline(file, line)) {
+        if (lines > 0) {
+            CHECK(line.find(",2,") != std::string::npos);   // Deux graines par ligne
+        }
+        lines++;
+    }
+    CHECK(lines == 1 + 4);
+    std::remove(path.c_str());
+    
+    std::cout << "Test campagne parallele: OK" << std::endl;
+}
+
+int main() {
+    std::cout << "=== Tests BatchRunner ===" << std::endl;
+    testExpandGrid();
+    testBatchRun();
+    std::cout << "Tous les tests BatchRunner sont passes!" << std::endl;
+    return 0;
+}
@@ -0,0 +1,92 @@
+#include "../include/CarFollowingModel.h"
+#include "../include/Vehicle.h"
+#include "../include/Graph.h"
+#include "TestCheck.h"
+#include <cmath>
+#include <iostream>
+#include <memory>
+
+// Deux routes en série de 200 m à 54 km/h (15 m/s) ; la seconde n'accepte qu'un véhicule
+static void buildCorridor(Graph& graph) {
+    graph.addNode(0, 0.0f, 0.0f);
+    graph.addNode(1, 200.0f, 0.0f);
+    graph.addNode(2, 400.0f, 0.0f);
+    graph.addRoute(0, 0, 1, 200.0f, 54.0f, 10);
+    graph.addRoute(1, 1, 2, 200.0f, 54.0f, 1);
+}
+
+void testCarFollowingKernel() {
+    float speed[3] = {0.0f, 15.0f, 15.0f};
+    float gap[3] = {1000.0f, 1000.0f, 5.0f};
+    float approach[3] = {0.0f, 0.0f, 15.0f};
+    float acceleration[3];
+    CarFollowingModel::computeAccelerations(speed, gap, approach, 15.0f, acceleration, 3);
+
+    // À l'arrêt sur route libre : accélération maximale
+    CHECK(acceleration[0] > 0.99f * CarFollowingModel::MAX_ACCELERATION);
+    // À la vitesse désirée sur route libre : équilibre
+    CHECK(acceleration[1] < 0.0f && acceleration[1] > -0.1f);
+    // Obstacle proche à l'arrêt : freinage maximal
+    CHECK(acceleration[2] == -CarFollowingModel::MAX_BRAKING);
+
+    std::cout << "Test noyau IDM: OK" << std::endl;
+}
+
+void testCarFollowingCapacity() {
+    Graph graph;
+    buildCorridor(graph);
+    std::vector<std::unique_ptr<Vehicle>> vehicles;
+    for (int i = 0; i < 4; i++) {
+        auto vehicle = std::make_unique<Vehicle>(i, 0, 2);
+        vehicle->setPath({0, 1, 2}, graph);
+        vehicles.push_back(std::move(vehicle));
+    }
+
+    CarFollowingModel model(&graph);
+    for (int i = 0; i < 4; i++) {
+        // Véhicules échelonnés de 20 m, le premier inséré est le plus avancé
+        model.enter(vehicles[i].get(), 1.0f - (60.0f - 20.0f * i) / 200.0f);
+    }
+    CHECK(model.getLaneLength(0) == 4);
+    CHECK(std::abs(model.getLanePositions(0)[0] - 60.0f) < 0.01f);
+
+    std::vector<VehicleMove> moves;
+    std::vector<Vehicle*> blocked;
+    for (int step = 0; step < 300; step++) {
+        model.step(0.1f, moves, blocked);
+
+        // Voie triée et sans chevauchement
+        const auto& positions = model.getLanePositions(0);
+        for (size_t i = 1; i < positions.size(); i++) {
+            CHECK(positions[i - 1] - positions[i] >= CarFollowingModel::VEHICLE_LENGTH);
+        }
+        // Capacité de la route aval respectée
+        CHECK(model.getLaneLength(1) <= 1);
+    }
+
+    // 30 s : la route aval laisse passer un véhicule à la fois, les autres attendent en bout de route
+    CHECK(!moves.empty());
+    CHECK(moves[0].vehicle == vehicles[0].get());
+    CHECK(model.getLaneLength(0) > 0);
+    CHECK(model.getLanePositions(0)[0] <= 200.0f);
+
+    for (int step = 0; step < 3000 && model.getVehicleCount() > 0; step++) {
+        model.step(0.1f, moves, blocked);
+    }
+    CHECK(model.getVehicleCount() == 0);
+    CHECK(moves.size() == 8);
+    for (auto& vehicle : vehicles) {
+        CHECK(vehicle->hasReachedDestination());
+    }
+    CHECK(blocked.empty());
+
+    std::cout << "Test capacite et poursuite: OK" << std::endl;
+}
+
+int main() {
+    std::cout << "=== Tests CarFollowingModel ===" << std::endl;
+    testCarFollowingKernel();
+    testCarFollowingCapacity();
+    std::cout << "Tous les tests CarFollowingModel sont passes!" << std::endl;
+    return 0;
+}
@@ -0,0 +1,160 @@
+#include "../include/CityGenerator.h"
+#include "../include/Graph.h"
+#include "TestCheck.h"
+#include <cmath>
+#include <iostream>
+#include <queue>
+#include <vector>
+
+namespace {
+bool isConnected(const RoadNetwork& network) {
+    const auto& nodes = network.getNodes();
+    std::vector<bool> seen(nodes.size(), false);
+    std::queue<int> pending;
+    pending.push(nodes[0]->id);
+    seen[0] = true;
+    size_t reached = 1;
+    while (!pending.empty()) {
+        int node = pending.front();
+        pending.pop();
+        for (int neighbor : network.getNeighbors(node)) {
+            if (!seen[neighbor]) {
+                seen[neighbor] = true;
+                reached++;
+                pending.push(neighbor);
+            }
+        }
+    }
+    return reached == nodes.size();
+}
+
+// Deux routes sans extrémité commune qui se coupent
+bool hasCrossing(const RoadNetwork& network) {
+    auto side = [](const Node* a, const Node* b, const Node* c) {
+        float cross = (b->x - a->x) * (c->y - a->y) - (b->y - a->y) * (c->x - a->x);
+        return (cross > 1e-3f) - (cross < -1e-3f);
+    };
+    for (size_t i = 0; i < network.getRouteCount(); i++) {
+        const RouteAttributes& r = network.getRoute(i);
+        for (size_t j = i + 1; j < network.getRouteCount(); j++) {
+            const RouteAttributes& s = network.getRoute(j);
+            if (r.fromNode == s.fromNode || r.fromNode == s.toNode || r.toNode == s.fromNode || r.toNode == s.toNode) {
+                continue;
+            }
+            const Node* a = network.getNode(r.fromNode);
+            const Node* b = network.getNode(r.toNode);
+            const Node* c = network.getNode(s.fromNode);
+            const Node* d = network.getNode(s.toNode);
+            if (side(a, b, c) * side(a, b, d) < 0 && side(c, d, a) * side(c, d, b) < 0) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+}
+
+void testDefaultCity() {
+    // Les options par défaut redonnent le réseau de démonstration 6x6 (130 px, 60 km/h, capacité 30)
+    Graph reference;
+    for (int i = 0; i < 6; i++) {
+        for (int j = 0; j < 6; j++) {
+            reference.addNode(i * 6 + j, j * 130.0f, i * 130.0f);
+        }
+    }
+    int routeId = 0;
+    for (int i = 0; i < 6; i++) {
+        for (int j = 0; j < 5; j++) {
+            reference.addRoute(routeId++, i * 6 + j, i * 6 + j + 1, 130.0f, 60.0f, 30);
+        }
+    }
+    for (int i = 0; i < 5; i++) {
+        for (int j = 0; j < 6; j++) {
+            reference.addRoute(routeId++, i * 6 + j, (i + 1) * 6 + j, 130.0f, 60.0f, 30);
+        }
+    }
+
+    auto city = CityGenerator::generate(CityOptions());
+    CHECK(city->getNodes().size() == 36);
+    CHECK(city->getRouteCount() == 60);
+    CHECK(city->getFingerprint() == reference.getTopology()->getFingerprint());
+    CHECK(city->getRoute(0).baseSpeed == 60.0f);
+
+    std::cout << "Test reseau de demonstration: OK" << std::endl;
+}
+
+void testLayouts() {
+    for (CityLayout layout : {CityLayout::GRID, CityLayout::RADIAL, CityLayout::PLANAR}) {
+        CityOptions options;
+        options.layout = layout;
+        options.nodeCount = 400;
+        options.jitter = layout == CityLayout::RADIAL ? 0.0f : 0.25f;
+        options.arterialInterval = 4;
+        options.local = {50.0f, 20};
+        options.arterial = {80.0f, 50};
+        auto city = CityGenerator::generate(options);
+
+        size_t nodeCount = city->getNodes().size();
+        CHECK(nodeCount >= 350 && nodeCount <= 450);
+        CHECK(isConnected(*city));
+        CHECK(!hasCrossing(*city));
+
+        size_t arterials = 0;
+        for (size_t i = 0; i < city->getRouteCount(); i++) {
+            const RouteAttributes& route = city->getRoute(i);
+            CHECK(route.id == static_cast<int>(i));
+            const Node* from = city->getNode(route.fromNode);
+            const Node* to = city->getNode(route.toNode);
+            CHECK(std::fabs(std::hypot(to->x - from->x, to->y - from->y) - route.length) < 1e-2f);
+            CHECK(route.length > 0.3f * options.spacing);
+            if (route.capacity == 50) {
+                CHECK(route.baseSpeed == 80.0f);
+                arterials++;
+            } else {
+                CHECK(route.capacity == 20 && route.baseSpeed == 50.0f);
+            }
+        }
+        CHECK(arterials > 0 && arterials < city->getRouteCount() / 2);
+
+        // Même graine, même réseau ; autre graine, autre déformation
+        CHECK(CityGenerator::generate(options)->getFingerprint() == city->getFingerprint());
+        if (options.jitter > 0.0f) {
+            options.seed++;
+            CHECK(CityGenerator::generate(options)->getFingerprint() != city->getFingerprint());
+        }
+
+        CityLayout parsed;
+        CHECK(CityGenerator::parseLayout(CityGenerator::getLayoutName(layout), parsed) && parsed == layout);
+    }
+    CityLayout parsed;
+    CHECK(!CityGenerator::parseLayout("hexagonal", parsed));
+
+    std::cout << "Test formes de reseau: OK" << std::endl;
+}
+
+void testLargeCity() {
+    CityOptions options;
+    options.layout = CityLayout::PLANAR;
+    options.nodeCount = 250000;
+    options.jitter = 0.25f;
+    auto city = CityGenerator::generate(options);
+    CHECK(city->getNodes().size() == 250000);
+    CHECK(city->getRouteCount() > 2 * 499 * 500);
+
+    // Le graphe construit sur la topologie trouve un chemin d'un coin à l'autre
+    std::shared_ptr<const RoadNetwork> topology = city;
+    Graph graph(topology);
+    std::vector<int> path = graph.findPath(0, 249999);
+    CHECK(path.size() >= 500 && path.front() == 0 && path.back() == 249999);
+
+    std::cout << "Test grand reseau: OK" << std::endl;
+}
+
+int main() {
+    std::cout << "=== Tests CityGenerator ===" << std::endl;
+    testDefaultCity();
+    testLayouts();
+    testLargeCity();
+    std::cout << "Tous les tests CityGenerator sont passes!" << std::endl;
+    return 0;
+}
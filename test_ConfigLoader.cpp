@@ -0,0 +1,163 @@
+#include "../include/ConfigLoader.h"
+#include "../include/CityGenerator.h"
+#include "../include/Graph.h"
+#include "TestCheck.h"
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <utility>
+
+namespace {
+void writeFile(const std::string& path, const std::string& content) {
+    std::ofstream file(path, std::ios::binary);
+    file << content;
+}
+
+bool loadText(const std::string& content, RoadNetwork& network, SimulationConfig& settings, std::string& error) {
+    writeFile("test_config.json", content);
+    bool ok = ConfigLoader::load("test_config.json", network, settings, error);
+    std::remove("test_config.json");
+    return ok;
+}
+}
+
+void testLoadConfig() {
+    // Schéma de config/config.json, plus des clés inconnues, des routes avant les nœuds et une longueur absente
+    const std::string content = R"({
+  "version": {"format": [1, 2.5e0, true, null], "auteur": "Sébastien \"R\""},
+  "simulation": {"vehicleCount": 15, "eventCount": 1, "timeScale": 1.5, "mode": "NORMAL"},
+  "graph": {
+    "routes": [
+      {"id": 10, "from": 7, "to": 12, "length": 100, "speed": 60, "capacity": 20, "nom": "Rue A"},
+      {"id": 11, "from": 12, "to": 3, "length": 1.5e2, "speed": 45.5, "capacity": 10}
+    ],
+    "nodes": [
+      {"id": 7, "x": 0, "y": 0},
+      {"y": -30, "x": 100.25, "id": 12},
+      {"id": 3, "x": 100.25, "y": 120}
+    ],
+    "routes": [{"id": 12, "from": 7, "to": 3, "speed": 30, "capacity": 5}]
+  },
+  "events": {"interval": 30.0, "types": ["ACCIDENT", "ROAD_CLOSURE"]}
+}
+)";
+    RoadNetwork network;
+    SimulationConfig settings;
+    std::string error;
+    CHECK(loadText(content, network, settings, error) && error.empty());
+
+    CHECK(network.getNodes().size() == 3);
+    CHECK(network.getNode(12)->x == 100.25f && network.getNode(12)->y == -30.0f);
+    CHECK(network.getRouteCount() == 3);
+    const RouteAttributes& second = network.getRoute(network.getRouteIndex(11));
+    CHECK(second.fromNode == 12 && second.toNode == 3);
+    CHECK(second.length == 150.0f && second.baseSpeed == 45.5f && second.capacity == 10);
+    // Longueur absente : distance entre les nœuds déjà lus
+    const RouteAttributes& third = network.getRoute(network.getRouteIndex(12));
+    CHECK(std::fabs(third.length - std::hypot(100.25f, 120.0f)) < 1e-3f);
+    CHECK(network.findRouteIndex(3, 12) == network.getRouteIndex(11));
+
+    CHECK(settings.vehicleCount == 15 && settings.eventCount == 1);
+    CHECK(settings.timeScale == 1.5f && settings.mode == "NORMAL");
+    CHECK(settings.eventInterval == 30.0f);
+    CHECK(settings.eventTypes.size() == 2 && settings.eventTypes[1] == "ROAD_CLOSURE");
+
+    std::cout << "Test chargement configuration: OK" << std::endl;
+}
+
+void testErrors() {
+    RoadNetwork network;
+    SimulationConfig settings;
+    std::string error;
+    CHECK(!ConfigLoader::load("introuvable.json", network, settings, error) && !error.empty());
+
+    auto fails = [](const std::string& content, const std::string& expected) {
+        RoadNetwork network;
+        SimulationConfig settings;
+        std::string error;
+        bool ok = loadText(content, network, settings, error);
+        return !ok && error.find(expected) != std::string::npos;
+    };
+    // Document invalide et extrait attendu du message d'erreur
+    const std::pair<const char*, const char*> invalid[] = {
+        {"{\n\"graph\": {\n\"nodes\": [{\"id\": 0 \"x\": 1}]}}", "ligne 3"},
+        {"{\"graph\": {\"nodes\": [{\"id\": 0, \"x\": 1}]}}", "noeud sans"},
+        {"{\"graph\": {\"nodes\": [{\"id\": 0, \"x\": 1, \"y\": 2}, {\"id\": 0, \"x\": 3, \"y\": 4}]}}", "en double"},
+        {"{\"graph\": {\"nodes\": [{\"id\": 0, \"x\": 1, \"y\": 2}], "
+         "\"routes\": [{\"id\": 0, \"from\": 0, \"to\": 9, \"length\": 1, \"speed\": 50, \"capacity\": 5}]}}",
+         "noeud inconnu"},
+        {"{\"graph\": {\"nodes\": [{\"id\": 1.5, \"x\": 1, \"y\": 2}]}}", "entier"},
+        {"{\"simulation\": {\"mode\": \"NORMAL}}", "chaine non terminee"},
+        {"{\"simulation\": {}} {}", "apres la fin"},
+        {"{\"simulation\": {\"vehicleCount\": 10}", "attendu"},
+    };
+    for (const auto& document : invalid) {
+        CHECK(fails(document.first, document.second));
+    }
+
+    // Graph::loadFromConfig garde son réseau si la configuration est invalide
+    Graph graph;
+    graph.addNode(0, 0.0f, 0.0f);
+    writeFile("test_config_invalide.json", "{\"graph\": [}");
+    CHECK(!graph.loadFromConfig("test_config_invalide.json"));
+    std::remove("test_config_invalide.json");
+    CHECK(graph.getNodes().size() == 1);
+
+    std::cout << "Test configurations invalides: OK" << std::endl;
+}
+
+void testLargeFile() {
+    // Réseau de 40 000 nœuds écrit en JSON (plusieurs blocs de lecture) puis relu à l'identique
+    CityOptions options;
+    options.layout = CityLayout::PLANAR;
+    options.nodeCount = 40000;
+    options.jitter = 0.25f;
+    options.arterialInterval = 8;
+    auto city = CityGenerator::generate(options);
+
+    {
+        std::FILE* file = std::fopen("test_config_grand.json", "wb");
+        std::fprintf(file, "{\"graph\": {\"nodes\": [\n");
+        const auto& nodes = city->getNodes();
+        for (size_t i = 0; i < nodes.size(); i++) {
+            std::fprintf(file, "%s{\"id\": %d, \"x\": %.9g, \"y\": %.9g}", i ? ",\n" : "", nodes[i]->id, nodes[i]->x, nodes[i]->y);
+        }
+        std::fprintf(file, "],\n\"routes\": [\n");
+        for (size_t i = 0; i < city->getRouteCount(); i++) {
+            const RouteAttributes& route = city->getRoute(i);
+            std::fprintf(file, "%s{\"id\": %d, \"from\": %d, \"to\": %d, \"length\": %.9g, \"speed\": %.9g, \"capacity\": %d}",
+                         i ? ",\n" : "", route.id, route.fromNode, route.toNode, route.length, route.baseSpeed, route.capacity);
+        }
+        std::fprintf(file, "]}}\n");
+        std::fclose(file);
+    }
+
+    Graph graph;
+    auto start = std::chrono::steady_clock::now();
+    bool ok = graph.loadFromConfig("test_config_grand.json");
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    std::ifstream written("test_config_grand.json", std::ios::binary | std::ios::ate);
+    double megabytes = static_cast<double>(written.tellg()) / (1 << 20);
+    written.close();
+    std::remove("test_config_grand.json");
+
+    CHECK(ok);
+    CHECK(graph.getTopology()->getFingerprint() == city->getFingerprint());
+    CHECK(graph.getRoutes().size() == city->getRouteCount());
+    CHECK(graph.getRoute(city->getRoute(5).id)->getBaseSpeed() == city->getRoute(5).baseSpeed);
+    std::cout << "  " << megabytes << " Mo relus en " << seconds * 1000.0 << " ms" << std::endl;
+
+    std::cout << "Test grand fichier: OK" << std::endl;
+}
+
+int main() {
+    std::cout << "=== Tests ConfigLoader ===" << std::endl;
+    testLoadConfig();
+    testErrors();
+    testLargeFile();
+    std::cout << "Tous les tests ConfigLoader sont passes!" << std::endl;
+    return 0;
+}
@@ -0,0 +1,96 @@
+#include "../include/FrameProfiler.h"
+#include "../include/Simulation.h"
+#include "TestCheck.h"
+#include <cmath>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+void testFrameHistory() {
+    FrameProfiler profiler;
+    SimulationProfile simulation;
+    profiler.beginFrame(simulation, 0);
+    CHECK(profiler.getFrameCount() == 0);
+
+    // Une image : 2 ticks de 4 ms, 10 recherches, 3 reroutages, 2 ms de rendu du réseau
+    simulation.ticks = 2;
+    simulation.updateTime = 8000000;
+    simulation.pathfindingTime = 1500000;
+    simulation.searches = 10;
+    profiler.addTime(ProfilePhase::RENDER_GRAPH, 2000000);
+    profiler.beginFrame(simulation, 3);
+    CHECK(profiler.getFrameCount() == 1);
+    const FrameProfiler::Sample& frame = profiler.getFrame(0);
+    CHECK(frame.ticks == 2 && frame.searches == 10 && frame.reroutes == 3);
+    CHECK(std::fabs(frame.phaseTime[static_cast<size_t>(ProfilePhase::SIMULATION)] - 8.0f) < 1e-4f);
+    CHECK(std::fabs(frame.phaseTime[static_cast<size_t>(ProfilePhase::PATHFINDING)] - 1.5f) < 1e-4f);
+    CHECK(std::fabs(frame.phaseTime[static_cast<size_t>(ProfilePhase::RENDER_GRAPH)] - 2.0f) < 1e-4f);
+
+    // Image sans nouvel instantané : rien côté simulation
+    profiler.beginFrame(simulation, 3);
+    CHECK(profiler.getFrame(0).ticks == 0 && profiler.getFrame(0).phaseTime[0] == 0.0f);
+    CHECK(std::fabs(profiler.getAverage(ProfilePhase::SIMULATION) - 4.0f) < 1e-4f);
+    CHECK(std::fabs(profiler.getMax(ProfilePhase::SIMULATION) - 8.0f) < 1e-4f);
+    CHECK(std::fabs(profiler.getAverageSearches() - 5.0f) < 1e-4f);
+
+    // Cumuls remis à zéro (nouvelle simulation) : pas de valeur négative
+    profiler.beginFrame(SimulationProfile(), 0);
+    CHECK(profiler.getFrame(0).ticks == 0 && profiler.getFrame(0).reroutes == 0);
+
+    // Historique circulaire : seules les HISTORY dernières images restent
+    for (size_t i = 0; i < FrameProfiler::HISTORY + 10; i++) {
+        profiler.addTime(ProfilePhase::RENDER_UI, (i + 1) * 1000000);
+        profiler.beginFrame(SimulationProfile(), 0);
+    }
+    CHECK(profiler.getFrameCount() == FrameProfiler::HISTORY);
+    CHECK(std::fabs(profiler.getFrame(0).phaseTime[static_cast<size_t>(ProfilePhase::RENDER_UI)]
+                     - (FrameProfiler::HISTORY + 10)) < 1e-3f);
+    CHECK(std::fabs(profiler.getFrame(FrameProfiler::HISTORY - 1).phaseTime[static_cast<size_t>(ProfilePhase::RENDER_UI)]
+                     - 11.0f) < 1e-3f);
+    std::cout << "Test historique des images: OK" << std::endl;
+}
+
+void testAllocationCount() {
+    FrameProfiler profiler;
+    profiler.beginFrame(SimulationProfile(), 0);
+    std::vector<std::unique_ptr<int>> values;
+    values.reserve(100);
+    for (int i = 0; i < 100; i++) {
+        values.push_back(std::make_unique<int>(i));
+    }
+    profiler.beginFrame(SimulationProfile(), 0);
+    CHECK(profiler.getFrame(0).allocations >= 101);
+    std::cout << "Test comptage des allocations: OK" << std::endl;
+}
+
+void testSimulationProfile() {
+    Simulation simulation;
+    simulation.setSeed(5);
+    simulation.initialize("");
+    simulation.setVehicleCount(80);
+    uint64_t searchesBefore = simulation.getProfile().searches;
+    for (int step = 0; step < 100; step++) {
+        simulation.update(0.1f);
+    }
+
+    SimulationProfile profile = simulation.getProfile();
+    CHECK(profile.ticks == 100);
+    CHECK(profile.updateTime > 0 && profile.trafficTime > 0 && profile.spawnTime > 0);
+    CHECK(profile.trafficTime + profile.spawnTime <= profile.updateTime);
+    CHECK(profile.searches > searchesBefore && profile.pathfindingTime > 0);
+
+    // Recopié dans l'instantané publié au rendu
+    FrameSnapshot frame;
+    simulation.captureSnapshot(frame);
+    CHECK(frame.profile.ticks == profile.ticks && frame.profile.searches == profile.searches);
+    std::cout << "Test temps des phases de la simulation: OK" << std::endl;
+}
+
+int main() {
+    std::cout << "=== Tests FrameProfiler ===" << std::endl;
+    testFrameHistory();
+    testAllocationCount();
+    testSimulationProfile();
+    std::cout << "Tous les tests FrameProfiler sont passes!" << std::endl;
+    return 0;
+}
@@ -1,4 +1,6 @@
 #include "../include/Graph.h"
+#include "../include/GraphPartition.h"
+#include "TestCheck.h"
 #include <cassert>
 #include <iostream>
 
@@ -53,11 +55,164 @@ void testGraphBlockedRoute() {
     std::cout << "Test route bloquee: OK" << std::endl;
 }
 
+void testGraphRouteLookup() {
+    Graph graph;
+    graph.addNode(0, 0.0f, 0.0f);
+    graph.addNode(1, 100.0f, 0.0f);
+    graph.addNode(2, 200.0f, 0.0f);
+    graph.addRoute(10, 0, 1, 100.0f, 60.0f, 20);
+    graph.addRoute(11, 1, 2, 100.0f, 60.0f, 20);
+    
+    // Recherche par ID et par paire de nœuds (dans les deux sens)
+    assert(graph.getRouteIndex(11) == 1);
+    assert(graph.getRouteIndex(42) == -1);
+    assert(graph.findRouteIndex(1, 2) == 1);
+    assert(graph.findRouteIndex(2, 1) == 1);
+    assert(graph.findRouteIndex(0, 2) == -1);
+    
+    std::cout << "Test recherche de route: OK" << std::endl;
+}
+
+void testGraphRouteChanges() {
+    Graph graph;
+    graph.addNode(0, 0.0f, 0.0f);
+    graph.addNode(1, 100.0f, 0.0f);
+    graph.addNode(2, 200.0f, 0.0f);
+    graph.addRoute(0, 0, 1, 100.0f, 60.0f, 20);
+    graph.addRoute(1, 1, 2, 100.0f, 60.0f, 20);
+    
+    graph.getRoute(1)->setState(RouteState::BLOCKED);
+    graph.getRoute(1)->setCongestion(0.9f);
+    graph.getRoute(0)->setState(RouteState::ACCIDENT);
+    
+    // Un seul signalement par route et par lot, dans l'ordre des changements
+    std::vector<int> changes = graph.consumeRouteChanges();
+    CHECK(changes.size() == 2);
+    CHECK(changes[0] == 1);
+    CHECK(changes[1] == 0);
+    CHECK(graph.consumeRouteChanges().empty());
+    
+    graph.getRoute(1)->setState(RouteState::NORMAL);
+    CHECK(graph.consumeRouteChanges().size() == 1);
+    
+    std::cout << "Test flux de changements: OK" << std::endl;
+}
+
+void testGraphVehicleDeltas() {
+    Graph graph;
+    graph.addNode(0, 0.0f, 0.0f);
+    graph.addNode(1, 100.0f, 0.0f);
+    graph.addRoute(0, 0, 1, 100.0f, 60.0f, 20);
+    Route* route = graph.getRoute(0);
+    
+    // Les entrées/sorties sont cumulées jusqu'à updateTraffic
+    for (int i = 0; i < 12; i++) {
+        graph.queueVehicleDelta(0, +1);
+    }
+    graph.queueVehicleDelta(0, -2);
+    CHECK(route->getVehicleCount() == 0);
+    CHECK(route->getCurrentSpeed() == route->getBaseSpeed());
+    
+    graph.updateTraffic();
+    CHECK(route->getVehicleCount() == 10);
+    CHECK(route->getCurrentSpeed() < route->getBaseSpeed());
+    
+    std::cout << "Test occupation des routes: OK" << std::endl;
+}
+
+void testSharedTopology() {
+    Graph original;
+    original.addNode(0, 0.0f, 0.0f);
+    original.addNode(1, 100.0f, 0.0f);
+    original.addRoute(0, 0, 1, 100.0f, 60.0f, 20);
+    
+    // Deux graphes sur la même topologie : attributs communs, état dynamique séparé
+    std::shared_ptr<const RoadNetwork> topology = original.getTopology();
+    Graph fork(topology);
+    CHECK(fork.getTopology() == topology);
+    CHECK(&fork.getRoute(0)->getAttributes() == &original.getRoute(0)->getAttributes());
+    fork.getRoute(0)->setState(RouteState::BLOCKED);
+    CHECK(original.getRoute(0)->getState() == RouteState::NORMAL);
+    CHECK(fork.consumeRouteChanges().size() == 1);
+    CHECK(original.consumeRouteChanges().empty());
+    
+    // Modifier une topologie partagée en crée une copie privée
+    original.getRoute(0)->setCongestion(0.5f);
+    original.addNode(2, 200.0f, 0.0f);
+    original.addRoute(1, 1, 2, 100.0f, 60.0f, 20);
+    CHECK(original.getTopology() != topology);
+    CHECK(topology->getNodes().size() == 2 && topology->getRouteCount() == 1);
+    CHECK(fork.getRoutes().size() == 1 && fork.getNode(2) == nullptr);
+    CHECK(original.getRoutes().size() == 2 && original.findPath(0, 2).size() == 3);
+    CHECK(original.getRoute(0)->getInducedLoad() == 10);
+    CHECK(original.getRoute(0)->getLength() == 100.0f);
+    CHECK(fork.getFingerprint() == topology->getFingerprint());
+    CHECK(original.getFingerprint() != fork.getFingerprint());
+    
+    // Empreinte : mêmes nœuds et routes, même empreinte ; nœud déplacé ou vitesse différente, autre empreinte
+    auto build = [](float y, float speed) {
+        Graph graph;
+        graph.addNode(0, 0.0f, 0.0f);
+        graph.addNode(1, 100.0f, y);
+        graph.addRoute(0, 0, 1, 100.0f, speed, 20);
+        return graph.getFingerprint();
+    };
+    CHECK(build(0.0f, 60.0f) == topology->getFingerprint());
+    CHECK(build(50.0f, 60.0f) != topology->getFingerprint());
+    CHECK(build(0.0f, 30.0f) != topology->getFingerprint());
+    
+    std::cout << "Test topologie partagee: OK" << std::endl;
+}
+
+void testGraphPartition() {
+    Graph graph;
+    int id = 0;
+    for (int i = 0; i < 4; i++) {
+        for (int j = 0; j < 4; j++) {
+            graph.addNode(id++, j * 100.0f, i * 100.0f);
+        }
+    }
+    graph.addRoute(0, 0, 1, 100.0f, 60.0f, 20);   // Coin haut-gauche
+    graph.addRoute(1, 1, 2, 100.0f, 60.0f, 20);   // Traverse la coupe verticale
+    graph.addRoute(2, 15, 14, 100.0f, 60.0f, 20); // Coin bas-droit
+    
+    GraphPartition partition(graph, 4);
+    CHECK(partition.getRegionCount() == 4);
+    
+    // Quatre quadrants de quatre nœuds
+    std::vector<int> sizes(4, 0);
+    for (int n = 0; n < 16; n++) {
+        int region = partition.getNodeRegion(n);
+        CHECK(region >= 0 && region < 4);
+        sizes[region]++;
+    }
+    for (int size : sizes) {
+        CHECK(size == 4);
+    }
+    CHECK(partition.getNodeRegion(0) == partition.getNodeRegion(5));
+    CHECK(partition.getNodeRegion(0) != partition.getNodeRegion(15));
+    CHECK(partition.getNodeRegion(99) == -1);
+    
+    // Une route appartient à la région de son nœud de départ
+    CHECK(partition.getRouteRegion(0) == partition.getNodeRegion(0));
+    CHECK(!partition.isBoundaryRoute(0));
+    CHECK(partition.isBoundaryRoute(1));
+    CHECK(partition.getRouteRegion(1) == partition.getNodeRegion(1));
+    CHECK(partition.getRouteRegion(2) == partition.getNodeRegion(15));
+    
+    std::cout << "Test decoupage en regions: OK" << std::endl;
+}
+
 int main() {
     std::cout << "=== Tests Graph ===" << std::endl;
     testGraphCreation();
     testGraphPathfinding();
     testGraphBlockedRoute();
+    testGraphRouteLookup();
+    testGraphRouteChanges();
+    testGraphVehicleDeltas();
+    testSharedTopology();
+    testGraphPartition();
     std::cout << "Tous les tests Graph sont passes!" << std::endl;
     return 0;
 }
@@ -0,0 +1,107 @@
+#include "../include/HybridModel.h"
+#include "../include/Vehicle.h"
+#include "../include/Graph.h"
+#include "TestCheck.h"
+#include <iostream>
+#include <memory>
+
+// Trois routes en série de 200 m à 54 km/h ; celle du milieu n'accepte que 2 véhicules
+static void buildCorridor(Graph& graph) {
+    graph.addNode(0, 0.0f, 0.0f);
+    graph.addNode(1, 200.0f, 0.0f);
+    graph.addNode(2, 400.0f, 0.0f);
+    graph.addNode(3, 600.0f, 0.0f);
+    graph.addRoute(0, 0, 1, 200.0f, 54.0f, 10);
+    graph.addRoute(1, 1, 2, 200.0f, 54.0f, 2);
+    graph.addRoute(2, 2, 3, 200.0f, 54.0f, 10);
+}
+
+static std::vector<std::unique_ptr<Vehicle>> makeVehicles(const Graph& graph, int count) {
+    std::vector<std::unique_ptr<Vehicle>> vehicles;
+    for (int i = 0; i < count; i++) {
+        auto vehicle = std::make_unique<Vehicle>(i, 0, 3);
+        vehicle->setPath({0, 1, 2, 3}, graph);
+        vehicles.push_back(std::move(vehicle));
+    }
+    return vehicles;
+}
+
+void testHybridHandoff() {
+    Graph graph;
+    buildCorridor(graph);
+    auto vehicles = makeVehicles(graph, 5);
+
+    // Seule la route du milieu est dans la zone de focus (par son milieu)
+    HybridModel model(&graph);
+    model.setFocusArea(250.0f, -10.0f, 350.0f, 10.0f);
+    CHECK(!model.isMicroscopic(0) && model.isMicroscopic(1) && !model.isMicroscopic(2));
+    for (auto& vehicle : vehicles) {
+        model.enter(vehicle.get());
+    }
+    CHECK(model.getMesoModel().getQueueLength(0) == 5);
+
+    std::vector<VehicleMove> moves;
+    std::vector<Vehicle*> blocked;
+    bool sawMicro = false;
+    for (int step = 0; step < 4000 && model.getVehicleCount() > 0; step++) {
+        model.step(0.1f, moves, blocked);
+        // Capacité de la route microscopique respectée par le modèle mésoscopique amont
+        CHECK(model.getMicroModel().getLaneLength(1) <= 2);
+        sawMicro = sawMicro || model.getMicroModel().getLaneLength(1) > 0;
+
+        // Chaque véhicule en route est dans exactement un des deux modèles
+        size_t active = 0;
+        for (auto& vehicle : vehicles) {
+            active += vehicle->hasReachedDestination() ? 0 : 1;
+        }
+        CHECK(model.getVehicleCount() == active);
+    }
+
+    // Méso -> micro -> méso : tous arrivés, trois mouvements chacun, ordre FIFO conservé
+    CHECK(sawMicro);
+    CHECK(model.getVehicleCount() == 0);
+    CHECK(moves.size() == 15);
+    CHECK(moves[0].vehicle == vehicles[0].get());
+    CHECK(blocked.empty());
+
+    std::cout << "Test remise entre modeles: OK" << std::endl;
+}
+
+void testHybridFocusChange() {
+    Graph graph;
+    buildCorridor(graph);
+    auto vehicles = makeVehicles(graph, 3);
+
+    HybridModel model(&graph);
+    for (int i = 0; i < 3; i++) {
+        vehicles[i]->setProgress(0.6f - 0.2f * i);
+        model.enter(vehicles[i].get(), 1.0f - vehicles[i]->getProgress());
+    }
+    CHECK(model.getMicroRouteCount() == 0);
+
+    // La première route entre dans la zone : ses véhicules passent en microscopique à leur position
+    model.setFocusArea(-10.0f, -10.0f, 150.0f, 10.0f);
+    CHECK(model.isMicroscopic(0) && model.getMicroRouteCount() == 1);
+    CHECK(model.getMicroModel().getLaneLength(0) == 3);
+    CHECK(model.getMesoModel().getQueueLength(0) == 0);
+    const auto& positions = model.getMicroModel().getLanePositions(0);
+    CHECK(positions[0] > positions[1] && positions[1] > positions[2]);
+
+    // Sortie de la zone : retour en mésoscopique, ordre de file conservé
+    model.clearFocusArea();
+    CHECK(model.getMicroModel().getVehicleCount() == 0);
+    CHECK(model.getMesoModel().getQueueLength(0) == 3);
+    std::vector<Vehicle*> queue;
+    model.getMesoModel().getRouteVehicles(0, queue);
+    CHECK(queue[0] == vehicles[0].get() && queue[2] == vehicles[2].get());
+
+    std::cout << "Test changement de zone de focus: OK" << std::endl;
+}
+
+int main() {
+    std::cout << "=== Tests HybridModel ===" << std::endl;
+    testHybridHandoff();
+    testHybridFocusChange();
+    std::cout << "Tous les tests HybridModel sont passes!" << std::endl;
+    return 0;
+}
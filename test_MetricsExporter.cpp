@@ -0,0 +1,113 @@
+#include "../include/MetricsExporter.h"
+#include "../include/Simulation.h"
+#include "TestCheck.h"
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <string>
+
+// 120 s simulées, un échantillon par seconde : 121 échantillons sur deux blocs
+static void runExport(const std::string& path, MetricsFormat format, Simulation& simulation, MetricsExporter& exporter) {
+    simulation.setSeed(3);
+    simulation.initialize("");
+    simulation.setVehicleCount(120);
+    CHECK(exporter.start(path, simulation, format));
+    CHECK(!exporter.start(path, simulation, format));   // Déjà en cours
+    for (int step = 0; step < 1200; step++) {
+        simulation.update(0.1f);
+    }
+    CHECK(exporter.stop() && !exporter.isExporting());
+}
+
+static long fileSize(const std::string& path) {
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    return static_cast<long>(file.tellg());
+}
+
+void testColumnarExport() {
+    const std::string raw = "test_metrics_raw.bin";
+    const std::string packed = "test_metrics_packed.bin";
+
+    Simulation simulation;
+    MetricsExporter exporter;
+    runExport(packed, MetricsFormat::COLUMNAR_COMPRESSED, simulation, exporter);
+    CHECK(exporter.getSampleCount() == 121 && exporter.getDroppedSamples() == 0);
+
+    MetricsTable table;
+    CHECK(MetricsExporter::load(packed, table));
+    const auto& routes = simulation.getGraph()->getRoutes();
+    CHECK(table.getSampleCount() == 121 && table.droppedSamples == 0);
+    CHECK(table.routeIds.size() == routes.size() && table.routeSpeed.size() == routes.size());
+    for (size_t i = 0; i < table.getSampleCount(); i++) {
+        CHECK(std::fabs(table.time[i] - static_cast<float>(i)) < 0.01f);
+    }
+    CHECK(table.completedTrips.back() > table.completedTrips.front());
+
+    // Dernier échantillon : état de la simulation à la fin
+    size_t last = table.getSampleCount() - 1;
+    CHECK(table.vehicles[last] == simulation.getVehicles().size());
+    CHECK(table.completedTrips[last] == simulation.getCompletedTrips());
+    CHECK(table.reroutings[last] == static_cast<uint32_t>(simulation.getTotalReroutings()));
+    CHECK(table.meanTravelTime[last] == simulation.getAverageTravelTime());
+    for (size_t r = 0; r < routes.size(); r++) {
+        CHECK(table.routeIds[r] == routes[r]->getId());
+        CHECK(table.routeSpeed[r][last] == routes[r]->getCurrentSpeed());
+        CHECK(table.routeOccupancy[r][last] == static_cast<uint32_t>(routes[r]->getVehicleCount()));
+        CHECK(table.routeState[r][last] == static_cast<uint8_t>(routes[r]->getState()));
+    }
+
+    // Même exécution sans compression : mêmes valeurs, fichier plus gros
+    Simulation twin;
+    MetricsExporter rawExporter;
+    runExport(raw, MetricsFormat::COLUMNAR, twin, rawExporter);
+    MetricsTable rawTable;
+    CHECK(MetricsExporter::load(raw, rawTable));
+    CHECK(rawTable.time == table.time && rawTable.completedTrips == table.completedTrips);
+    CHECK(rawTable.routeSpeed == table.routeSpeed && rawTable.routeState == table.routeState);
+    CHECK(fileSize(packed) * 2 < fileSize(raw));
+
+    std::cout << "Test export en colonnes: OK (" << fileSize(raw) << " octets, " << fileSize(packed)
+              << " compresse)" << std::endl;
+    std::remove(raw.c_str());
+    std::remove(packed.c_str());
+}
+
+void testCsvExport() {
+    const std::string path = "test_metrics.csv";
+    Simulation simulation;
+    MetricsExporter exporter;
+    exporter.setSampleInterval(2.0f);
+    runExport(path, MetricsFormat::CSV, simulation, exporter);
+    CHECK(exporter.getSampleCount() == 61);
+
+    std::ifstream file(path);
+    std::string header;
+    std::getline(file, header);
+    size_t columns = 1;
+    for (char c : header) {
+        columns += (c == ',') ? 1 : 0;
+    }
+    CHECK(header.compare(0, 5, "time,") == 0);
+    CHECK(columns == 7 + 3 * simulation.getGraph()->getRoutes().size());
+    size_t lines = 0;
+    std::string line;
+    while (std::getline(file, line)) {
+        lines++;
+    }
+    CHECK(lines == exporter.getSampleCount());
+
+    // Un CSV n'est pas relu par load
+    MetricsTable table;
+    CHECK(!MetricsExporter::load(path, table));
+    std::cout << "Test export CSV: OK" << std::endl;
+    std::remove(path.c_str());
+}
+
+int main() {
+    std::cout << "=== Tests MetricsExporter ===" << std::endl;
+    testColumnarExport();
+    testCsvExport();
+    std::cout << "Tous les tests MetricsExporter sont passes!" << std::endl;
+    return 0;
+}
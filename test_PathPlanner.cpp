@@ -1,7 +1,11 @@
 #include "../include/PathPlanner.h"
 #include "../include/Graph.h"
+#include "../include/TaskScheduler.h"
+#include "TestCheck.h"
 #include <cassert>
 #include <iostream>
+#include <utility>
+#include <vector>
 
 void testPathPlanner() {
     Graph graph;
@@ -47,10 +51,68 @@ void testPathPlannerWithTraffic() {
     std::cout << "Test planificateur avec trafic: OK" << std::endl;
 }
 
+void testSearchStats() {
+    // Grille 12 x 12, routes dans les deux sens
+    Graph graph;
+    const int size = 12;
+    for (int i = 0; i < size * size; i++) {
+        graph.addNode(i, (i % size) * 100.0f, (i / size) * 100.0f);
+    }
+    int routeId = 0;
+    for (int i = 0; i < size * size; i++) {
+        if (i % size + 1 < size) {
+            graph.addRoute(routeId++, i, i + 1, 100.0f, 60.0f, 20);
+            graph.addRoute(routeId++, i + 1, i, 100.0f, 60.0f, 20);
+        }
+        if (i + size < size * size) {
+            graph.addRoute(routeId++, i, i + size, 100.0f, 60.0f, 20);
+            graph.addRoute(routeId++, i + size, i, 100.0f, 60.0f, 20);
+        }
+    }
+    
+    AStarStrategy astar;
+    DijkstraStrategy dijkstra;
+    SearchStats astarStats;
+    SearchStats dijkstraStats;
+    std::vector<std::pair<int, int>> requests;
+    for (int i = 0; i < 20; i++) {
+        requests.emplace_back((i * 37) % (size * size), (i * 91 + 50) % (size * size));
+    }
+    for (const auto& request : requests) {
+        std::vector<int> a = astar.findPath(graph, request.first, request.second, &astarStats);
+        std::vector<int> d = dijkstra.findPath(graph, request.first, request.second, &dijkstraStats);
+        CHECK(!a.empty() && !d.empty() && a.size() == d.size());
+    }
+    
+    // Chaque relâchement empile une entrée (plus le départ) ; un nœud n'est fixé qu'une fois
+    for (const SearchStats* stats : {&astarStats, &dijkstraStats}) {
+        CHECK(stats->searches == requests.size());
+        CHECK(stats->heapPushes == stats->edgesRelaxed + stats->searches);
+        CHECK(stats->nodesSettled <= stats->heapPops && stats->heapPops <= stats->heapPushes);
+        CHECK(stats->time > 0);
+    }
+    // L'heuristique guide A* : moins de nœuds explorés que Dijkstra
+    CHECK(astarStats.nodesSettled < dijkstraStats.nodesSettled);
+    
+    // Agrégation dans le planificateur, y compris pour un lot parallèle
+    PathPlanner planner(&graph, std::make_unique<DijkstraStrategy>());
+    TaskScheduler scheduler(4);
+    planner.planPaths(requests, &scheduler);
+    SearchStats total = planner.getSearchStats();
+    CHECK(total.searches == dijkstraStats.searches && total.nodesSettled == dijkstraStats.nodesSettled);
+    CHECK(total.edgesRelaxed == dijkstraStats.edgesRelaxed && total.heapPops == dijkstraStats.heapPops);
+    planner.resetSearchStats();
+    CHECK(planner.getSearchStats().searches == 0);
+    
+    std::cout << "Test compteurs de recherche: OK (A* " << astarStats.nodesSettled << " noeuds fixes, Dijkstra "
+              << dijkstraStats.nodesSettled << ")" << std::endl;
+}
+
 int main() {
     std::cout << "=== Tests PathPlanner ===" << std::endl;
     testPathPlanner();
     testPathPlannerWithTraffic();
+    testSearchStats();
     std::cout << "Tous les tests PathPlanner sont passes!" << std::endl;
     return 0;
 }
@@ -0,0 +1,104 @@
+#include "../include/QueueModel.h"
+#include "../include/Vehicle.h"
+#include "../include/Graph.h"
+#include "TestCheck.h"
+#include <iostream>
+#include <memory>
+
+// Deux routes en série de 100 m à 36 km/h (10 s de parcours) ; la seconde ne contient que 2 véhicules
+static void buildCorridor(Graph& graph) {
+    graph.addNode(0, 0.0f, 0.0f);
+    graph.addNode(1, 100.0f, 0.0f);
+    graph.addNode(2, 200.0f, 0.0f);
+    graph.addRoute(0, 0, 1, 100.0f, 36.0f, 10);
+    graph.addRoute(1, 1, 2, 100.0f, 36.0f, 2);
+}
+
+static std::vector<std::unique_ptr<Vehicle>> makeVehicles(const Graph& graph, int count) {
+    std::vector<std::unique_ptr<Vehicle>> vehicles;
+    for (int i = 0; i < count; i++) {
+        auto vehicle = std::make_unique<Vehicle>(i, 0, 2);
+        vehicle->setPath({0, 1, 2}, graph);
+        vehicles.push_back(std::move(vehicle));
+    }
+    return vehicles;
+}
+
+void testQueueModelSpillback() {
+    Graph graph;
+    buildCorridor(graph);
+    auto vehicles = makeVehicles(graph, 5);
+
+    QueueModel model(&graph);
+    for (auto& vehicle : vehicles) {
+        model.enter(vehicle.get());
+    }
+    CHECK(model.getQueueLength(0) == 5);
+
+    std::vector<VehicleMove> moves;
+    std::vector<Vehicle*> blocked;
+    for (int step = 0; step < 38; step++) {
+        model.step(0.5f, moves, blocked);
+        // La route aval pleine retient les véhicules sur la route amont
+        CHECK(model.getQueueLength(1) <= 2);
+    }
+    // t = 19 s : deux véhicules sur la route aval, personne n'en est encore sorti
+    CHECK(model.getQueueLength(1) == 2);
+    CHECK(model.getQueueLength(0) == 3);
+    CHECK(moves.size() == 2);
+
+    // Sortie FIFO : le premier entré est le premier sorti
+    CHECK(moves[0].vehicle == vehicles[0].get());
+    CHECK(moves[1].vehicle == vehicles[1].get());
+
+    for (int step = 0; step < 400 && model.getVehicleCount() > 0; step++) {
+        model.step(0.5f, moves, blocked);
+    }
+    CHECK(model.getVehicleCount() == 0);
+    CHECK(moves.size() == 10);
+    for (auto& vehicle : vehicles) {
+        CHECK(vehicle->hasReachedDestination());
+    }
+    CHECK(blocked.empty());
+
+    std::cout << "Test remontee de file: OK" << std::endl;
+}
+
+void testQueueModelFlow() {
+    Graph graph;
+    buildCorridor(graph);
+    graph.getRoute(1)->setState(RouteState::BLOCKED);
+    auto vehicles = makeVehicles(graph, 3);
+
+    QueueModel model(&graph);
+    for (auto& vehicle : vehicles) {
+        model.enter(vehicle.get());
+    }
+
+    // Route aval bloquée : la tête de file s'arrête et demande un reroutage
+    std::vector<VehicleMove> moves;
+    std::vector<Vehicle*> blocked;
+    for (int step = 0; step < 30; step++) {
+        model.step(0.5f, moves, blocked);
+    }
+    CHECK(moves.empty());
+    CHECK(!blocked.empty());
+    CHECK(blocked[0] == vehicles[0].get());
+    CHECK(vehicles[0]->needsReroutingCheck());
+    CHECK(!vehicles[1]->needsReroutingCheck());
+
+    // Retrait (reroutage) : le suivant devient tête de file
+    model.remove(vehicles[0].get());
+    CHECK(model.getQueueLength(0) == 2);
+    CHECK(model.getVehicleCount() == 2);
+
+    std::cout << "Test route aval bloquee: OK" << std::endl;
+}
+
+int main() {
+    std::cout << "=== Tests QueueModel ===" << std::endl;
+    testQueueModelSpillback();
+    testQueueModelFlow();
+    std::cout << "Tous les tests QueueModel sont passes!" << std::endl;
+    return 0;
+}
@@ -1,4 +1,5 @@
 #include "../include/Route.h"
+#include "TestCheck.h"
 #include <cassert>
 #include <iostream>
 
@@ -50,21 +51,40 @@ void testRouteStates() {
 void testTravelTime() {
     Route route(1, 0, 1, 100.0f, 60.0f, 20);
     float time = route.getTravelTime();
-    assert(time > 0);
+    CHECK(time > 0);
     
     route.setState(RouteState::BLOCKED);
     float blockedTime = route.getTravelTime();
-    assert(blockedTime > time);
+    CHECK(blockedTime > time);
     
     std::cout << "Test temps de parcours: OK" << std::endl;
 }
 
+void testRouteVersion() {
+    Route route(1, 0, 1, 100.0f, 60.0f, 20);
+    unsigned int initial = route.getVersion();
+    
+    route.setState(RouteState::ACCIDENT);
+    CHECK(route.getVersion() == initial + 1);
+    
+    // Réappliquer le même état ne compte pas comme un changement
+    route.setState(RouteState::ACCIDENT);
+    CHECK(route.getVersion() == initial + 1);
+    
+    route.setCongestion(0.5f);
+    route.setCongestion(0.5f);
+    CHECK(route.getVersion() == initial + 2);
+    
+    std::cout << "Test version route: OK" << std::endl;
+}
+
 int main() {
     std::cout << "=== Tests Route ===" << std::endl;
     testRouteCreation();
     testRouteTraffic();
     testRouteStates();
     testTravelTime();
+    testRouteVersion();
     std::cout << "Tous les tests Route sont passes!" << std::endl;
     return 0;
 }
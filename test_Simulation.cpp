@@ -0,0 +1,357 @@
+#include "../include/Simulation.h"
+#include "TestCheck.h"
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+
+// État comparable des véhicules et du nombre de reroutages
+static std::vector<float> simulationState(const Simulation& simulation) {
+    std::vector<float> state;
+    simulation.refreshVehiclePositions();
+    for (const auto& vehicle : simulation.getVehicles()) {
+        state.push_back(static_cast<float>(vehicle->getId()));
+        state.push_back(vehicle->getX());
+        state.push_back(vehicle->getY());
+        state.push_back(static_cast<float>(vehicle->getPath().size()));
+    }
+    state.push_back(static_cast<float>(simulation.getTotalReroutings()));
+    return state;
+}
+
+// Exécute une simulation déterministe et renvoie l'état final des véhicules
+static std::vector<float> runSimulation(unsigned int threads, int regions = 0,
+                                        TrafficModel model = TrafficModel::CONTINUOUS) {
+    Simulation simulation;
+    simulation.setSeed(42);
+    simulation.setThreadCount(threads);
+    simulation.setRegionCount(regions);
+    simulation.setTrafficModel(model);
+    simulation.setFocusArea(0.0f, 0.0f, 300.0f, 300.0f);
+    simulation.initialize("");
+    simulation.setVehicleCount(600);
+
+    for (int step = 0; step < 400; step++) {
+        if (step % 50 == 0) {
+            simulation.triggerRandomEvent();
+        }
+        simulation.update(0.05f);
+    }
+
+    return simulationState(simulation);
+}
+
+void testSimulationDeterminism() {
+    std::vector<float> reference = runSimulation(1);
+    CHECK(!reference.empty());
+
+    // Même graine : résultat identique quel que soit le nombre de threads
+    CHECK(runSimulation(2) == reference);
+    CHECK(runSimulation(4) == reference);
+
+    std::cout << "Test determinisme multi-thread: OK" << std::endl;
+}
+
+void testSimulationRegions() {
+    std::vector<float> reference = runSimulation(1);
+    
+    // Découpage en régions : même résultat qu'une simulation sans découpage
+    CHECK(runSimulation(1, 4) == reference);
+    CHECK(runSimulation(3, 4) == reference);
+    CHECK(runSimulation(2, 7) == reference);
+    
+    std::cout << "Test decomposition en regions: OK" << std::endl;
+}
+
+static void checkTrafficModel(TrafficModel model) {
+    Simulation simulation;
+    simulation.setSeed(7);
+    simulation.setTrafficModel(model);
+    simulation.setFocusArea(0.0f, 0.0f, 300.0f, 300.0f);
+    simulation.initialize("");
+    simulation.setVehicleCount(600);
+    int lastInitialId = simulation.getVehicles().back()->getId();
+    
+    for (int step = 0; step < 400; step++) {
+        if (step % 50 == 0) {
+            simulation.triggerRandomEvent();
+        }
+        if (step == 200) {
+            // Déplacement de la zone de focus (modèle hybride) : transfert des véhicules
+            simulation.setFocusArea(250.0f, 250.0f, 650.0f, 650.0f);
+        }
+        simulation.update(0.05f);
+        // Chaque véhicule en circulation est pris en charge par le modèle
+        CHECK(simulation.getTrafficDynamics()->getVehicleCount() == simulation.getVehicles().size());
+    }
+    // Des véhicules sont arrivés et ont été remplacés
+    CHECK(simulation.getVehicles().back()->getId() > lastInitialId);
+    
+    // Déterminisme quel que soit le nombre de threads
+    std::vector<float> reference = runSimulation(1, 0, model);
+    CHECK(runSimulation(4, 0, model) == reference);
+}
+
+void testSimulationTrafficModels() {
+    checkTrafficModel(TrafficModel::MESOSCOPIC);
+    std::cout << "Test modele mesoscopique: OK" << std::endl;
+    checkTrafficModel(TrafficModel::MICROSCOPIC);
+    std::cout << "Test modele microscopique: OK" << std::endl;
+    checkTrafficModel(TrafficModel::HYBRID);
+    std::cout << "Test modele hybride: OK" << std::endl;
+}
+
+void testSimulationClosureWithoutRerouting() {
+    Simulation simulation;
+    simulation.setSeed(5);
+    simulation.setTrafficModel(TrafficModel::MESOSCOPIC);
+    simulation.initialize("");
+    simulation.setVehicleCount(300);
+    simulation.setMode(SimulationMode::NORMAL);
+    
+    // Fermeture de la route la plus chargée pendant tout le test
+    const Route* busiest = nullptr;
+    for (const auto& route : simulation.getGraph()->getRoutes()) {
+        if (!busiest || route->getVehicleCount() > busiest->getVehicleCount()) {
+            busiest = route.get();
+        }
+    }
+    simulation.addEvent(EventType::ROAD_CLOSURE, busiest->getId(), 1.0f, 1000.0f);
+    
+    // Mode normal : les têtes de file bloquées ne s'accumulent pas dans les candidats
+    for (int step = 0; step < 400; step++) {
+        simulation.update(0.05f);
+        CHECK(simulation.getRerouteCandidateCount() == 0);
+    }
+    size_t flagged = 0;
+    for (const auto& vehicle : simulation.getVehicles()) {
+        flagged += vehicle->needsReroutingCheck() ? 1 : 0;
+    }
+    CHECK(flagged > 0);
+    
+    // Passage en mode dynamique : chaque véhicule signalé redevient candidat une seule fois
+    simulation.setMode(SimulationMode::DYNAMIC);
+    CHECK(simulation.getRerouteCandidateCount() == flagged);
+    simulation.update(0.05f);
+    CHECK(simulation.getTotalReroutings() > 0);
+    CHECK(simulation.getRerouteCandidateCount() <= flagged);
+    
+    std::cout << "Test fermeture sans reroutage: OK" << std::endl;
+}
+
+void testSimulationFastForward() {
+    Simulation simulation;
+    simulation.setSeed(11);
+    simulation.initialize("");
+    
+    // Pas fixe : le temps inférieur à un pas est reporté à l'appel suivant
+    CHECK(simulation.advance(0.02f) == 0);
+    CHECK(simulation.getSimulationTime() == 0.0f);
+    CHECK(simulation.advance(0.03f) == 1);
+    CHECK(std::abs(simulation.getSimulationTime() - Simulation::FIXED_TIME_STEP) < 1e-5f);
+    
+    simulation.setTimeScale(5000.0f);
+    CHECK(simulation.getTimeScale() == Simulation::MAX_TIME_SCALE);
+    simulation.setTimeScale(1.0f);
+    
+    // Avance rapide avec un budget large : 250 s simulées en 5000 pas fixes
+    simulation.setFastForward(true);
+    simulation.setFrameBudget(60.0f);
+    CHECK(simulation.advance(0.25f) == 5000);
+    CHECK(std::abs(simulation.getSimulationTime() - 250.05f) < 0.05f);
+    // Facteur mesuré sur la fenêtre (0,3 s réelles dont 0,05 s à vitesse normale)
+    CHECK(simulation.getEffectiveTimeScale() > 0.5f * Simulation::MAX_TIME_SCALE);
+    
+    // Budget minimal : au moins un pas, le retard est abandonné
+    simulation.setFrameBudget(0.0f);
+    float before = simulation.getSimulationTime();
+    int steps = simulation.advance(0.1f);
+    float covered = simulation.getSimulationTime() - before;
+    CHECK(steps >= 1 && steps < 2000);
+    CHECK(std::abs(covered - steps * Simulation::FIXED_TIME_STEP) < 0.01f);
+    
+    std::cout << "Test avance rapide: OK" << std::endl;
+}
+
+static void checkCheckpoint(TrafficModel model) {
+    const std::string path = "test_checkpoint.bin";
+    Simulation original;
+    original.setSeed(21);
+    original.setTrafficModel(model);
+    original.setFocusArea(0.0f, 0.0f, 300.0f, 300.0f);
+    original.initialize("");
+    original.setVehicleCount(400);
+    for (int step = 0; step < 300; step++) {
+        if (step % 60 == 0) {
+            original.triggerRandomEvent();
+        }
+        original.update(0.05f);
+    }
+    original.triggerRandomEvent();   // Changement de route en attente au moment de la sauvegarde
+    CHECK(original.saveCheckpoint(path));
+    
+    // Autre graine et autres véhicules : tout est remplacé par le point de reprise
+    Simulation restored;
+    restored.setSeed(99);
+    restored.initialize("");
+    CHECK(restored.loadCheckpoint(path));
+    CHECK(restored.getTrafficModel() == model);
+    CHECK(restored.getSimulationTime() == original.getSimulationTime());
+    CHECK(restored.getEvents().size() == original.getEvents().size());
+    CHECK(simulationState(restored) == simulationState(original));
+    
+    // La suite est identique (générateur aléatoire, files, voies, événements)
+    for (int step = 0; step < 300; step++) {
+        if (step % 60 == 30) {
+            original.triggerRandomEvent();
+            restored.triggerRandomEvent();
+        }
+        original.update(0.05f);
+        restored.update(0.05f);
+    }
+    CHECK(simulationState(restored) == simulationState(original));
+    const auto& routes = original.getGraph()->getRoutes();
+    for (size_t i = 0; i < routes.size(); i++) {
+        const Route* route = restored.getGraph()->getRoutes()[i].get();
+        CHECK(route->getState() == routes[i]->getState());
+        CHECK(route->getVehicleCount() == routes[i]->getVehicleCount());
+    }
+    std::remove(path.c_str());
+}
+
+void testSimulationCheckpoint() {
+    checkCheckpoint(TrafficModel::CONTINUOUS);
+    checkCheckpoint(TrafficModel::MESOSCOPIC);
+    checkCheckpoint(TrafficModel::MICROSCOPIC);
+    checkCheckpoint(TrafficModel::HYBRID);
+    
+    // Sauvegarde en arrière-plan : l'état est celui du moment de l'appel
+    const std::string path = "test_checkpoint_fork.bin";
+    Simulation simulation;
+    simulation.setSeed(4);
+    simulation.initialize("");
+    for (int step = 0; step < 100; step++) {
+        simulation.update(0.05f);
+    }
+    std::vector<float> saved = simulationState(simulation);
+    float savedTime = simulation.getSimulationTime();
+    CHECK(simulation.saveCheckpointInBackground(path));
+    for (int step = 0; step < 100; step++) {
+        simulation.update(0.05f);
+    }
+    CHECK(simulation.waitForCheckpoint());
+    
+    Simulation restored;
+    restored.initialize("");
+    CHECK(restored.loadCheckpoint(path));
+    CHECK(restored.getSimulationTime() == savedTime);
+    CHECK(simulationState(restored) == saved);
+    
+    // Fichier corrompu ou absent : refusé, simulation inchangée
+    {
+        std::fstream file(path, std::ios::in | std::ios::out | std::ios::binary);
+        file.seekp(40);
+        file.put('\x7f');
+    }
+    Simulation untouched;
+    untouched.setSeed(4);
+    untouched.initialize("");
+    std::vector<float> before = simulationState(untouched);
+    CHECK(!untouched.loadCheckpoint(path));
+    CHECK(!untouched.loadCheckpoint("introuvable.bin"));
+    CHECK(simulationState(untouched) == before);
+    std::remove(path.c_str());
+    
+    std::cout << "Test points de reprise: OK" << std::endl;
+}
+
+void testSimulationFork() {
+    Simulation simulation;
+    simulation.setSeed(8);
+    simulation.setTrafficModel(TrafficModel::MESOSCOPIC);
+    simulation.initialize("");
+    simulation.setVehicleCount(300);
+    for (int step = 0; step < 200; step++) {
+        simulation.update(0.05f);
+    }
+    simulation.setPaused(true);
+    
+    // Copie : même état, topologie partagée, pas de pause
+    std::unique_ptr<Simulation> copy = simulation.fork();
+    CHECK(copy);
+    CHECK(copy->getTopology() == simulation.getTopology());
+    CHECK(!copy->getIsPaused());
+    CHECK(simulationState(*copy) == simulationState(simulation));
+    
+    // Même suite que l'originale, et un incident dans la copie ne touche pas l'originale
+    simulation.setPaused(false);
+    for (int step = 0; step < 200; step++) {
+        simulation.update(0.05f);
+        copy->update(0.05f);
+    }
+    CHECK(simulationState(*copy) == simulationState(simulation));
+    size_t events = simulation.getEvents().size();
+    copy->addEvent(EventType::ROAD_CLOSURE, 7, 1.0f, 60.0f);
+    CHECK(copy->getGraph()->getRoute(7)->getState() == RouteState::BLOCKED);
+    CHECK(simulation.getGraph()->getRoute(7)->getState() != RouteState::BLOCKED);
+    CHECK(simulation.getEvents().size() == events);
+    
+    std::cout << "Test copie de simulation: OK" << std::endl;
+}
+
+void testSimulationConfig() {
+    std::ofstream("test_simulation_config.json") << R"({
+  "simulation": {"vehicleCount": 12, "eventCount": 2, "timeScale": 2.0, "mode": "NORMAL"},
+  "graph": {
+    "nodes": [{"id": 0, "x": 0, "y": 0}, {"id": 1, "x": 100, "y": 0}, {"id": 2, "x": 100, "y": 100}],
+    "routes": [{"id": 0, "from": 0, "to": 1, "speed": 60, "capacity": 20},
+               {"id": 1, "from": 1, "to": 2, "speed": 60, "capacity": 20}]
+  },
+  "events": {"interval": 15.0, "types": ["ROAD_CLOSURE", "INONDATION"]}
+})";
+    Simulation simulation;
+    simulation.setSeed(3);
+    simulation.initialize("test_simulation_config.json");
+    std::remove("test_simulation_config.json");
+    
+    // Paramètres appliqués avant la création des véhicules ; type inconnu ignoré
+    CHECK(simulation.getGraph()->getRoutes().size() == 2);
+    CHECK(simulation.getVehicleCount() == 12 && simulation.getVehicles().size() == 12);
+    CHECK(simulation.getMode() == SimulationMode::NORMAL);
+    CHECK(simulation.getTimeScale() == 2.0f && simulation.getEventInterval() == 15.0f);
+    CHECK(simulation.getEventTypes().size() == 1 && simulation.getEventTypes()[0] == EventType::ROAD_CLOSURE);
+    simulation.triggerRandomEvent();
+    CHECK(simulation.getEvents().back()->getType() == EventType::ROAD_CLOSURE);
+    
+    std::cout << "Test configuration de simulation: OK" << std::endl;
+}
+
+void testSimulationSetupOrder() {
+    // Nombre de véhicules fixé avant initialize : une seule création, avec le réseau
+    Simulation simulation(1);
+    simulation.setVerbose(false);
+    simulation.setSeed(3);
+    simulation.setVehicleCount(20);
+    CHECK(simulation.getVehicles().empty());
+    simulation.initialize("");
+    CHECK(simulation.getThreadCount() == 1);
+    CHECK(simulation.getVehicles().size() == 20);
+    CHECK(simulation.getVehicles().front()->getId() == 0);   // Pas de première série jetée
+    
+    std::cout << "Test ordre d'initialisation: OK" << std::endl;
+}
+
+int main() {
+    std::cout << "=== Tests Simulation ===" << std::endl;
+    testSimulationDeterminism();
+    testSimulationRegions();
+    testSimulationTrafficModels();
+    testSimulationClosureWithoutRerouting();
+    testSimulationFastForward();
+    testSimulationCheckpoint();
+    testSimulationFork();
+    testSimulationConfig();
+    testSimulationSetupOrder();
+    std::cout << "Tous les tests Simulation sont passes!" << std::endl;
+    return 0;
+}
@@ -0,0 +1,169 @@
+#include "../include/SimulationRunner.h"
+#include "TestCheck.h"
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <thread>
+
+void testTripleBuffer() {
+    TripleBuffer<int> buffer;
+    CHECK(!buffer.update());
+
+    // Deux publications avant lecture : le lecteur obtient la dernière
+    buffer.writeBuffer() = 1;
+    buffer.publish();
+    buffer.writeBuffer() = 2;
+    buffer.publish();
+    CHECK(buffer.update() && buffer.readBuffer() == 2);
+    CHECK(!buffer.update() && buffer.readBuffer() == 2);
+
+    // Producteur et consommateur concurrents : valeurs lues croissantes
+    std::thread producer([&buffer] {
+        for (int i = 3; i <= 20000; i++) {
+            buffer.writeBuffer() = i;
+            buffer.publish();
+        }
+    });
+    int last = 2;
+    while (last < 20000) {
+        if (buffer.update()) {
+            CHECK(buffer.readBuffer() > last);
+            last = buffer.readBuffer();
+        }
+    }
+    producer.join();
+
+    std::cout << "Test triple tampon: OK" << std::endl;
+}
+
+void testSpscQueue() {
+    SpscQueue<int, 4> queue;
+    int value = 0;
+    CHECK(!queue.pop(value));
+    for (int i = 0; i < 4; i++) {
+        CHECK(queue.push(i));
+    }
+    CHECK(!queue.push(4));   // Pleine
+    CHECK(queue.pop(value) && value == 0);
+    CHECK(queue.push(4));
+    for (int i = 1; i <= 4; i++) {
+        CHECK(queue.pop(value) && value == i);
+    }
+    CHECK(!queue.pop(value));
+
+    std::cout << "Test file sans verrou: OK" << std::endl;
+}
+
+void testRunnerCommands() {
+    Simulation simulation;
+    simulation.setSeed(5);
+    simulation.initialize("");
+    SimulationRunner runner(simulation);
+
+    // Commandes appliquées au cycle suivant, dans l'ordre d'envoi
+    runner.post(SimulationCommand::make(CommandType::SET_VEHICLE_COUNT, 80));
+    runner.post(SimulationCommand::make(CommandType::TRIGGER_EVENT));
+    runner.post(SimulationCommand::make(CommandType::SET_TIME_SCALE, 0, 2.0f));
+    runner.runOnce(0.02f);
+
+    const FrameSnapshot& frame = runner.acquireSnapshot();
+    CHECK(frame.vehicleCount == simulation.getVehicles().size());
+    CHECK(frame.vehicleCount >= 70);
+    CHECK(frame.triggeredEvents == 1);
+    CHECK(!frame.events.empty());
+    CHECK(frame.timeScale == 2.0f);
+    CHECK(frame.routeStates.size() == simulation.getGraph()->getRoutes().size());
+    CHECK(frame.vehicles.size() <= frame.vehicleCount);
+
+    runner.post(SimulationCommand::make(CommandType::TOGGLE_PAUSE));
+    runner.runOnce(0.02f);
+    CHECK(runner.acquireSnapshot().paused);
+
+    std::cout << "Test commandes et instantane: OK" << std::endl;
+}
+
+void testInterpolation() {
+    // L'angle suit le plus court chemin : de 350° à 10° en passant par 0°
+    const float pi = 3.14159265359f;
+    VehicleSnapshot vehicle{0, 0, 10.0f, 0.0f, 10.0f * pi / 180.0f, 0.0f, 0.0f, 350.0f * pi / 180.0f};
+    float x, y, angle;
+    vehicle.interpolate(0.5f, x, y, angle);
+    CHECK(std::fabs(x - 5.0f) < 1e-4f && y == 0.0f);
+    CHECK(std::fabs(std::remainder(angle, 2.0f * pi)) < 1e-4f);
+
+    FrameSnapshot timing;
+    timing.tickTime = 10.0;
+    timing.tickInterval = 0.1f;
+    CHECK(std::fabs(timing.interpolation(10.05) - 0.5f) < 1e-3f);
+    CHECK(timing.interpolation(9.0) == 0.0f && timing.interpolation(11.0) == 1.0f);
+
+    Simulation simulation;
+    simulation.setSeed(3);
+    simulation.initialize("");
+    simulation.setFixedTimeStep(0.1f);
+    SimulationRunner runner(simulation);
+
+    // Sans tick ni commande, rien n'est publié
+    runner.runOnce(0.05f);
+    CHECK(runner.acquireSnapshot().simulationTime == 0.0f);
+
+    // Après deux ticks, la position précédente est celle du premier
+    runner.runOnce(0.05f);
+    std::vector<VehicleSnapshot> firstTick = runner.acquireSnapshot().vehicles;
+    runner.runOnce(0.1f);
+    const FrameSnapshot& frame = runner.acquireSnapshot();
+    CHECK(std::fabs(frame.simulationTime - 0.2f) < 1e-4f);
+    CHECK(frame.tickInterval > 0.0f);
+    bool moved = false;
+    for (const VehicleSnapshot& current : frame.vehicles) {
+        for (const VehicleSnapshot& previous : firstTick) {
+            if (previous.id == current.id) {
+                CHECK(current.previousX == previous.x && current.previousY == previous.y);
+                moved = moved || current.x != previous.x || current.y != previous.y;
+            }
+        }
+    }
+    CHECK(moved);
+
+    std::cout << "Test interpolation entre ticks: OK" << std::endl;
+}
+
+void testRunnerThread() {
+    Simulation simulation;
+    simulation.setSeed(9);
+    simulation.initialize("");
+    SimulationRunner runner(simulation);
+    runner.start();
+    CHECK(runner.isRunning());
+
+    // Le rendu voit le temps de simulation avancer sans toucher à la simulation
+    float firstTime = runner.acquireSnapshot().simulationTime;
+    runner.post(SimulationCommand::make(CommandType::TRIGGER_EVENT));
+    float lastTime = firstTime;
+    int triggered = 0;
+    for (int i = 0; i < 200 && (lastTime <= firstTime || triggered == 0); i++) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        const FrameSnapshot& frame = runner.acquireSnapshot();
+        CHECK(frame.simulationTime >= lastTime);
+        lastTime = frame.simulationTime;
+        triggered = frame.triggeredEvents;
+    }
+    CHECK(lastTime > firstTime);
+    CHECK(triggered == 1);
+
+    runner.stop();
+    CHECK(!runner.isRunning() && !runner.hasFailed());
+
+    std::cout << "Test thread de simulation: OK" << std::endl;
+}
+
+int main() {
+    std::cout << "=== Tests SimulationRunner ===" << std::endl;
+    testTripleBuffer();
+    testSpscQueue();
+    testRunnerCommands();
+    testInterpolation();
+    testRunnerThread();
+    std::cout << "Tous les tests SimulationRunner sont passes!" << std::endl;
+    return 0;
+}
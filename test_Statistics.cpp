@@ -0,0 +1,151 @@
+#include "../include/Histogram.h"
+#include "../include/StatisticsEngine.h"
+#include "../include/Simulation.h"
+#include "TestCheck.h"
+#include <chrono>
+#include <cmath>
+#include <iostream>
+
+void testHistogramPrecision() {
+    Histogram histogram;
+    CHECK(histogram.getCount() == 0 && histogram.percentile(0.5) == 0);
+
+    // Valeurs exactes sous SUB_COUNT, puis erreur relative bornée à toutes les échelles
+    for (uint64_t value = 1; value <= 100000; value++) {
+        histogram.record(value);
+    }
+    CHECK(histogram.getCount() == 100000);
+    CHECK(histogram.getMax() == 100000);
+    CHECK(std::fabs(histogram.getMean() - 50000.5) < 1e-6);
+    double tolerance = 1.0 / Histogram::SUB_COUNT;
+    for (double quantile : {0.5, 0.95, 0.99}) {
+        double exact = quantile * 100000;
+        CHECK(std::fabs(histogram.percentile(quantile) - exact) / exact <= tolerance);
+    }
+    for (uint64_t value : {uint64_t(0), uint64_t(31), uint64_t(32), uint64_t(1000), uint64_t(123456789)}) {
+        size_t index = Histogram::bucketIndex(value);
+        CHECK(value >= Histogram::bucketLowest(index));
+        CHECK(value < Histogram::bucketLowest(index) + Histogram::bucketWidth(index));
+    }
+    // Au-delà de la plage : dernier seau, maximum exact
+    histogram.record(uint64_t(1) << 50);
+    CHECK(Histogram::bucketIndex(uint64_t(1) << 50) == Histogram::BUCKET_COUNT - 1);
+    CHECK(histogram.getMax() == uint64_t(1) << 50);
+
+    // Fusion : identique à l'enregistrement dans un seul histogramme
+    Histogram even, odd, all;
+    for (uint64_t value = 0; value < 5000; value++) {
+        (value % 2 ? odd : even).record(value * 7);
+        all.record(value * 7);
+    }
+    even.merge(odd);
+    CHECK(even.getCount() == all.getCount() && even.getSum() == all.getSum());
+    for (double quantile : {0.1, 0.5, 0.99}) {
+        CHECK(even.percentile(quantile) == all.percentile(quantile));
+    }
+
+    // Coût d'un enregistrement
+    Histogram timing;
+    const int samples = 10000000;
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < samples; i++) {
+        timing.record(static_cast<uint64_t>(i) * 2654435761u >> 12);
+    }
+    double nanoseconds = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / samples;
+    CHECK(timing.getCount() == static_cast<uint64_t>(samples));
+    std::cout << "Test precision de l'histogramme: OK (" << nanoseconds << " ns par enregistrement)" << std::endl;
+}
+
+void testEngineSlots() {
+    StatisticsEngine engine;
+    engine.setRouteCount(3);
+    engine.setSlotCount(4);
+    engine.reset(10.0f);
+    for (unsigned int slot = 0; slot < 4; slot++) {
+        engine.recordTrip(slot, 60.0f + slot, 5.0f);
+        engine.recordRouteExit(slot, 1);
+        engine.recordReroute(slot, 2000);
+    }
+    engine.recordRouteExit(0, 7);          // Hors du réseau : ignoré
+    engine.recordTrip(2, 30.0f, -1.0f);    // Plus rapide qu'à vide : retard nul
+
+    CHECK(std::fabs(engine.getMeanTravelTime() - (60 + 61 + 62 + 63 + 30) / 5.0f) < 1e-3f);
+    StatisticsReport report = engine.report(70.0f);
+    CHECK(report.window == 60.0f);
+    CHECK(report.travelTime.count == 5 && report.delay.count == 5);
+    CHECK(report.travelTime.max == 63.0);
+    CHECK(report.delay.p50 == 5.0);
+    CHECK(report.rerouteLatency.count == 4 && report.rerouteLatency.p99 == 2.0);
+    CHECK(report.routeExits.size() == 3 && report.routeExits[1] == 4);
+    CHECK(report.getRouteThroughput(1) == 4.0f);
+
+    // Changer le nombre de threads conserve les mesures
+    engine.setSlotCount(2);
+    StatisticsReport folded = engine.report(70.0f);
+    CHECK(folded.travelTime.count == 5 && folded.routeExits[1] == 4);
+
+    BinaryWriter out;
+    engine.write(out);
+    StatisticsEngine restored;
+    restored.setRouteCount(3);
+    BinaryReader in(out.data().data(), out.size());
+    CHECK(restored.read(in) && in.atEnd());
+    StatisticsReport copy = restored.report(70.0f);
+    CHECK(copy.window == 60.0f && copy.travelTime.p95 == folded.travelTime.p95 && copy.routeExits == folded.routeExits);
+
+    std::cout << "Test accumulateurs par thread: OK" << std::endl;
+}
+
+static StatisticsReport runSimulation(unsigned int threads, TrafficModel model) {
+    Simulation simulation;
+    simulation.setSeed(11);
+    simulation.setThreadCount(threads);
+    simulation.initialize("");
+    simulation.setTrafficModel(model);
+    simulation.setVehicleCount(150);
+    for (int step = 0; step < 1500; step++) {
+        simulation.update(0.1f);
+    }
+    StatisticsReport report = simulation.getStatistics();
+    CHECK(std::fabs(simulation.getAverageTravelTime() - report.travelTime.mean) < 0.01f);
+    CHECK(report.rerouteLatency.count > 0 && report.rerouteLatency.count <= static_cast<uint64_t>(simulation.getTotalReroutings()));
+    return report;
+}
+
+void testSimulationStatistics() {
+    for (TrafficModel model : {TrafficModel::CONTINUOUS, TrafficModel::MESOSCOPIC}) {
+        StatisticsReport report = runSimulation(1, model);
+        CHECK(std::fabs(report.window - 150.0f) < 0.01f);
+        CHECK(report.travelTime.count > 0);
+        CHECK(report.travelTime.p50 <= report.travelTime.p95 && report.travelTime.p95 <= report.travelTime.p99);
+        CHECK(report.travelTime.p99 <= report.travelTime.max);
+        // Retard (négatif ramené à zéro) toujours inférieur au temps de parcours
+        CHECK(report.delay.mean >= 0.0 && report.delay.mean < report.travelTime.mean);
+        uint64_t exits = 0;
+        for (uint64_t count : report.routeExits) {
+            exits += count;
+        }
+        CHECK(exits >= report.travelTime.count);
+
+        // Mêmes mesures de trafic quel que soit le nombre de threads (seule la latence dépend de la machine)
+        StatisticsReport parallel = runSimulation(4, model);
+        CHECK(parallel.travelTime.count == report.travelTime.count && parallel.travelTime.p95 == report.travelTime.p95);
+        CHECK(parallel.delay.p99 == report.delay.p99);
+        CHECK(parallel.routeExits == report.routeExits);
+        std::cout << "  " << report.travelTime.count << " trajets, parcours p50 " << report.travelTime.p50
+                  << " s p99 " << report.travelTime.p99 << " s, retard moyen " << report.delay.mean
+                  << " s, reroutage p50 " << report.rerouteLatency.p50 << " us" << std::endl;
+    }
+    std::cout << "Test statistiques de simulation: OK" << std::endl;
+}
+
+int main() {
+    std::cout << "=== Tests Statistics ===" << std::endl;
+
+    testHistogramPrecision();
+    testEngineSlots();
+    testSimulationStatistics();
+
+    std::cout << "Tous les tests Statistics sont passes!" << std::endl;
+    return 0;
+}
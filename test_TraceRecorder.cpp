@@ -0,0 +1,151 @@
+#include "../include/TraceRecorder.h"
+#include "../include/TraceReplayer.h"
+#include "../include/Simulation.h"
+#include "TestCheck.h"
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <map>
+#include <utility>
+#include <vector>
+
+// Arête (nœuds de départ et d'arrivée) de chaque véhicule en circulation
+static std::map<int, std::pair<int, int>> vehicleEdges(const Simulation& simulation) {
+    std::map<int, std::pair<int, int>> edges;
+    for (const auto& vehicle : simulation.getVehicles()) {
+        const auto& path = vehicle->getPath();
+        size_t edge = static_cast<size_t>(vehicle->getCurrentRouteIndex());
+        if (!vehicle->hasReachedDestination() && edge + 1 < path.size()) {
+            edges[vehicle->getId()] = std::make_pair(path[edge], path[edge + 1]);
+        }
+    }
+    return edges;
+}
+
+// Même information reconstruite à partir de la trace
+static std::map<int, std::pair<int, int>> replayedEdges(const TraceReplayer& replayer, float time) {
+    std::map<int, std::pair<int, int>> edges;
+    for (const VehicleTrack& track : replayer.getVehicleTracks()) {
+        if (track.startTime > time || time >= track.endTime) {
+            continue;
+        }
+        for (const TraceLeg& leg : track.legs) {
+            if (leg.startTime <= time) {
+                edges[track.id] = std::make_pair(leg.fromNode, leg.toNode);
+            }
+        }
+    }
+    return edges;
+}
+
+void testRecordAndReplay() {
+    const std::string path = "test_trace.bin";
+    Simulation simulation;
+    simulation.setSeed(17);
+    simulation.setTrafficModel(TrafficModel::MESOSCOPIC);
+    simulation.initialize("");
+    simulation.setVehicleCount(600);
+
+    TraceRecorder recorder;
+    CHECK(recorder.start(path, simulation) && recorder.isRecording());
+
+    // État intermédiaire relevé par un second observateur
+    float middleTime = 0.0f;
+    std::map<int, std::pair<int, int>> middleEdges;
+    int ticks = 0;
+    int observer = simulation.addTickObserver([&](const Simulation& current) {
+        if (++ticks == 200) {
+            middleTime = current.getSimulationTime();
+            middleEdges = vehicleEdges(current);
+        }
+    });
+    for (int step = 0; step < 400; step++) {
+        if (step % 50 == 0) {
+            simulation.triggerRandomEvent();
+        }
+        simulation.update(0.05f);
+    }
+    simulation.removeTickObserver(observer);
+    CHECK(recorder.stop());
+    CHECK(recorder.getTickCount() == 401);
+
+    TraceReplayer replayer(*simulation.getGraph());
+    CHECK(replayer.open(path));
+    CHECK(replayer.isComplete());
+    CHECK(replayer.getTickTimes().size() == 401);
+    CHECK(replayer.getEndTime() == simulation.getSimulationTime());
+
+    // Fin de la trace : mêmes véhicules sur les mêmes arêtes, mêmes routes, mêmes événements
+    FrameSnapshot frame;
+    replayer.frameAt(replayer.getEndTime(), frame);
+    std::map<int, std::pair<int, int>> finalEdges = vehicleEdges(simulation);
+    CHECK(replayedEdges(replayer, replayer.getEndTime()) == finalEdges);
+    CHECK(frame.vehicles.size() == finalEdges.size());
+    const auto& routes = simulation.getGraph()->getRoutes();
+    for (size_t i = 0; i < routes.size(); i++) {
+        CHECK(frame.routeStates[i] == routes[i]->getState());
+    }
+    CHECK(frame.events.size() == simulation.getEvents().size());
+    CHECK(frame.totalReroutings > 0);
+
+    // Instant intermédiaire : l'état de ce tick est retrouvé sans rejouer la simulation
+    CHECK(!middleEdges.empty());
+    CHECK(replayedEdges(replayer, middleTime) == middleEdges);
+
+    // Des véhicules sont arrivés et d'autres sont apparus pendant l'enregistrement
+    int arrived = 0;
+    for (const VehicleTrack& track : replayer.getVehicleTracks()) {
+        arrived += track.arrived ? 1 : 0;
+    }
+    CHECK(arrived > 0 && replayer.getVehicleTracks().size() > 600);
+
+    // Changements seulement : bien moins d'un octet par véhicule et par tick
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    long size = static_cast<long>(file.tellg());
+    CHECK(size == static_cast<long>(recorder.getBytesRecorded()));
+    CHECK(size < 600L * 401 / 4);
+
+    std::remove(path.c_str());
+    std::cout << "Test enregistrement et relecture: OK" << std::endl;
+}
+
+void testTruncatedTrace() {
+    const std::string path = "test_trace_truncated.bin";
+    Simulation simulation;
+    simulation.setSeed(3);
+    simulation.initialize("");
+
+    TraceRecorder recorder;
+    CHECK(recorder.start(path, simulation));
+    CHECK(!recorder.start(path, simulation));   // Déjà en cours
+    for (int step = 0; step < 100; step++) {
+        simulation.update(0.05f);
+    }
+    CHECK(recorder.stop());
+
+    // Arrêt brutal simulé : la trace est relue jusqu'à la partie tronquée
+    std::ifstream input(path, std::ios::binary);
+    std::vector<char> data((std::istreambuf_iterator<char>(input)), std::istreambuf_iterator<char>());
+    input.close();
+    {
+        std::ofstream output(path, std::ios::binary | std::ios::trunc);
+        output.write(data.data(), static_cast<std::streamsize>(data.size() / 2));
+    }
+    TraceReplayer replayer(*simulation.getGraph());
+    CHECK(replayer.open(path));
+    CHECK(!replayer.isComplete());
+    CHECK(!replayer.getTickTimes().empty() && replayer.getTickTimes().size() < 101);
+    CHECK(!replayer.open("introuvable.bin"));
+
+    std::remove(path.c_str());
+    std::cout << "Test trace interrompue: OK" << std::endl;
+}
+
+int main() {
+    std::cout << "=== Tests TraceRecorder ===" << std::endl;
+    testRecordAndReplay();
+    testTruncatedTrace();
+    std::cout << "Tous les tests TraceRecorder sont passes!" << std::endl;
+    return 0;
+}
@@ -0,0 +1,93 @@
+#ifndef ROUTAGE_TRACING
+#define ROUTAGE_TRACING
+#endif
+
+#include "../include/Tracing.h"
+#include "TestCheck.h"
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+static std::string readFile(const std::string& path) {
+    std::ifstream file(path);
+    std::stringstream content;
+    content << file.rdbuf();
+    return content.str();
+}
+
+static size_t countOccurrences(const std::string& text, const std::string& pattern) {
+    size_t count = 0;
+    for (size_t pos = text.find(pattern); pos != std::string::npos; pos = text.find(pattern, pos + 1)) {
+        count++;
+    }
+    return count;
+}
+
+void testZonesPerThread() {
+    uint64_t before = Tracer::getEventCount();
+    TRACE_THREAD_NAME("principal");
+    {
+        TRACE_ZONE("outer");
+        TRACE_ZONE("inner");
+    }
+
+    // Plus d'un bloc par thread : les blocs sont chaînés sans perte
+    const int threadCount = 4;
+    const int zonesPerThread = static_cast<int>(Tracer::BLOCK_EVENTS) + 100;
+    std::vector<std::thread> threads;
+    for (int t = 0; t < threadCount; t++) {
+        threads.emplace_back([t] {
+            TRACE_THREAD_NAME("travailleur " + std::to_string(t));
+            for (int i = 0; i < zonesPerThread; i++) {
+                TRACE_ZONE("work");
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    CHECK(Tracer::getEventCount() == before + 2 + threadCount * zonesPerThread);
+    CHECK(Tracer::getDroppedCount() == 0);
+    std::cout << "Test zones par thread: OK" << std::endl;
+}
+
+void testChromeTraceExport() {
+    const std::string path = "test_trace.json";
+    CHECK(Tracer::writeChromeTrace(path));
+    std::string json = readFile(path);
+
+    // Zones complètes ("X") et un nom par thread ("M"), tableau JSON fermé
+    CHECK(json.compare(0, 15, "{\"displayTimeUn") == 0);
+    CHECK(json.find("]}") != std::string::npos);
+    CHECK(countOccurrences(json, "\"ph\":\"X\"") == Tracer::getEventCount());
+    CHECK(countOccurrences(json, "\"ph\":\"M\"") == 5);
+    CHECK(json.find("\"name\":\"principal\"") != std::string::npos);
+    CHECK(json.find("\"name\":\"travailleur 3\"") != std::string::npos);
+    CHECK(countOccurrences(json, "\"name\":\"outer\"") == 1);
+
+    // La zone englobante commence avant et finit après la zone interne (même thread)
+    size_t inner = json.find("\"name\":\"inner\"");
+    size_t outer = json.find("\"name\":\"outer\"");
+    CHECK(inner < outer);   // Enregistrée à la sortie de portée : la plus interne d'abord
+    double innerTs = 0.0, innerDur = 0.0, outerTs = 0.0, outerDur = 0.0;
+    std::sscanf(json.c_str() + json.find("\"ts\":", inner), "\"ts\":%lf,\"dur\":%lf", &innerTs, &innerDur);
+    std::sscanf(json.c_str() + json.find("\"ts\":", outer), "\"ts\":%lf,\"dur\":%lf", &outerTs, &outerDur);
+    CHECK(outerTs <= innerTs && innerTs + innerDur <= outerTs + outerDur + 0.001);
+
+    CHECK(!Tracer::writeChromeTrace("repertoire_inexistant/trace.json"));
+    std::cout << "Test export Chrome trace: OK" << std::endl;
+    std::remove(path.c_str());
+}
+
+int main() {
+    std::cout << "=== Tests Tracing ===" << std::endl;
+    testZonesPerThread();
+    testChromeTraceExport();
+    std::cout << "Tous les tests Tracing sont passes!" << std::endl;
+    return 0;
+}
@@ -1,5 +1,6 @@
 #include "../include/Vehicle.h"
 #include "../include/Graph.h"
+#include "TestCheck.h"
 #include <cassert>
 #include <iostream>
 
@@ -17,10 +18,10 @@ void testVehiclePath() {
     vehicle.setPath(path);
     
     const auto& vehiclePath = vehicle.getPath();
-    assert(vehiclePath.size() == 3);
-    assert(vehiclePath[0] == 0);
-    assert(vehiclePath[1] == 1);
-    assert(vehiclePath[2] == 2);
+    CHECK(vehiclePath.size() == 3);
+    CHECK(vehiclePath[0] == 0);
+    CHECK(vehiclePath[1] == 1);
+    CHECK(vehiclePath[2] == 2);
     
     std::cout << "Test chemin vehicule: OK" << std::endl;
 }
@@ -44,11 +45,33 @@ void testVehicleUpdate() {
     std::cout << "Test mise a jour vehicule: OK" << std::endl;
 }
 
+void testVehiclePathRoutes() {
+    Graph graph;
+    graph.addNode(0, 0.0f, 0.0f);
+    graph.addNode(1, 100.0f, 0.0f);
+    graph.addNode(2, 200.0f, 0.0f);
+    graph.addRoute(0, 1, 2, 100.0f, 60.0f, 20);
+    graph.addRoute(1, 0, 1, 100.0f, 60.0f, 20);
+    
+    Vehicle vehicle(0, 0, 2);
+    vehicle.setPath({0, 1, 2}, graph);
+    
+    // Les routes du chemin sont résolues une fois pour toutes
+    const auto& routes = vehicle.getPathRoutes();
+    CHECK(routes.size() == 2);
+    CHECK(routes[0] == 1);
+    CHECK(routes[1] == 0);
+    CHECK(vehicle.getCurrentRouteIndex() == 0);
+    
+    std::cout << "Test routes du chemin: OK" << std::endl;
+}
+
 int main() {
     std::cout << "=== Tests Vehicle ===" << std::endl;
     testVehicleCreation();
     testVehiclePath();
     testVehicleUpdate();
+    testVehiclePathRoutes();
     std::cout << "Tous les tests Vehicle sont passes!" << std::endl;
     return 0;
 }